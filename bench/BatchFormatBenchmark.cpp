@@ -0,0 +1,55 @@
+/**
+ * @file BatchFormatBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/BasicFormattedDate.hpp"
+#include "../include/dt/utils/DateBatchFormatter.hpp"
+
+int main() {
+    constexpr std::size_t count{1'000'000};
+    constexpr std::size_t stride{dt::consts::DATE_STRING_LENGTH + 1};
+    std::vector<dt::Date> dates;
+    dates.reserve(count);
+    for (std::size_t i{0}; i < count; ++i) {
+        dates.emplace_back(1 + static_cast<int>(i % 28), 1 + static_cast<int>(i % 12),
+                           1900 + static_cast<int>(i % 200));
+    }
+    std::vector<char> buffer(count * stride);
+
+    dt::bench::run("Date::toString", count, [&] {
+        for (const dt::Date& date : dates) {
+            dt::bench::doNotOptimize(date.toString());
+        }
+    });
+    dt::bench::run("BasicFormattedDate::format loop", count, [&] {
+        char* out{buffer.data()};
+        for (const dt::Date& date : dates) {
+            out = dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{date}.format(out);
+            *out++ = '\n';
+        }
+        dt::bench::doNotOptimize(buffer.data());
+    });
+
+    const dt::BatchBackend backends[] {dt::BatchBackend::Scalar, dt::BatchBackend::AVX2};
+    const char* names[] {"Scalar", "AVX2"};
+    for (std::size_t b{0}; b < 2; ++b) {
+        const std::string delimited{std::string{"DateBatchFormatter::formatDelimited "} + names[b]};
+        dt::bench::run(delimited.c_str(), count, [&] {
+            dt::bench::doNotOptimize(dt::DateBatchFormatter::formatDelimited(
+                    dates.data(), count, dt::DateFormat::YYYY_MM_DD, buffer.data(), '\n', backends[b]));
+        });
+        const std::string fixed{std::string{"DateBatchFormatter::formatFixed "} + names[b]};
+        dt::bench::run(fixed.c_str(), count, [&] {
+            dt::DateBatchFormatter::formatFixed(dates.data(), count, dt::DateFormat::DD__MM__YYYY, buffer.data(),
+                                                stride, backends[b]);
+            dt::bench::doNotOptimize(buffer.data());
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file BatchParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/DateBatchParser.hpp"
+
+int main() {
+    constexpr std::size_t count{1'000'000};
+    constexpr std::size_t stride{11};
+
+    // Newline separated column mixing YYYY-MM-DD and DD/MM/YYYY, like our CSV exports.
+    std::mt19937 rng{42};
+    std::string buffer;
+    buffer.reserve(count * stride);
+    for (std::size_t i{0}; i < count; ++i) {
+        char date[16];
+        int day{1 + static_cast<int>(rng() % 28)};
+        int month{1 + static_cast<int>(rng() % 12)};
+        int year{1900 + static_cast<int>(rng() % 200)};
+        if (i % 2 == 0) {
+            std::snprintf(date, sizeof(date), "%04d-%02d-%02d\n", year, month, day);
+        } else {
+            std::snprintf(date, sizeof(date), "%02d/%02d/%04d\n", day, month, year);
+        }
+        buffer += date;
+    }
+
+    std::vector<std::string_view> views;
+    views.reserve(count);
+    for (std::size_t i{0}; i < count; ++i) {
+        views.emplace_back(buffer.data() + i * stride, dt::consts::DATE_STRING_LENGTH);
+    }
+
+    std::vector<dt::Date> dates(count);
+    std::vector<std::uint64_t> validMask(dt::DateBatchParser::validMaskSize(count));
+
+    dt::bench::run("Date(std::string_view) per row", count, [&] {
+        for (std::size_t i{0}; i < count; ++i) {
+            dates[i] = dt::Date{views[i]};
+        }
+        dt::bench::doNotOptimize(dates.data());
+    });
+
+    const std::pair<const char*, dt::BatchBackend> backends[] {
+        {"buffer: Scalar", dt::BatchBackend::Scalar},
+        {"buffer: SSSE3", dt::BatchBackend::SSSE3},
+        {"buffer: AVX2", dt::BatchBackend::AVX2},
+    };
+    for (const auto& [name, backend] : backends) {
+        dt::bench::run(name, count, [&] {
+            dt::bench::doNotOptimize(dt::DateBatchParser::parse(buffer.data(), count, stride, dates.data(),
+                                                                validMask.data(), backend));
+        });
+    }
+    for (const auto& [name, backend] : backends) {
+        std::string viewName{std::string{"views: "} + (name + 8)};
+        dt::bench::run(viewName.c_str(), count, [&] {
+            dt::bench::doNotOptimize(dt::DateBatchParser::parse(views.data(), count, dates.data(),
+                                                                validMask.data(), backend));
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file Benchmark.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_BENCHMARK_HPP
+#define DATEANDTIME_LIB_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+
+namespace dt {
+    /**
+     * @brief Minimal timing helpers shared by the benchmark executables.
+     *
+     * <b>Note:</b> Build with @c -DCMAKE_BUILD_TYPE=Release, the numbers are meaningless otherwise.
+     * @namespace @c dt::bench
+     */
+    namespace bench {
+        /**
+         * @brief Stops the compiler from optimising away a value that is computed but never used.
+         * @param value
+         *          The value to keep alive.
+         */
+        template<typename T>
+        inline void doNotOptimize(const T& value) {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        /**
+         * @brief Times a benchmark body and prints the cost per operation and the throughput.
+         * @param name
+         *          The name of the benchmark.
+         * @param operations
+         *          The number of operations performed by one call of @p body.
+         * @param body
+         *          The code to time.
+         * @return The number of nanoseconds per operation.
+         */
+        template<typename Body>
+        double run(const char* name, std::size_t operations, Body&& body) {
+            body(); // Warm up caches & branch predictors.
+
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+
+            double nanoseconds{std::chrono::duration<double, std::nano>(end - start).count()};
+            double nsPerOp{nanoseconds / static_cast<double>(operations)};
+            double opsPerSecond{static_cast<double>(operations) / (nanoseconds / 1e9)};
+
+            std::cout << std::left << std::setw(48) << name
+                      << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << nsPerOp << " ns/op"
+                      << std::setw(16) << opsPerSecond / 1e6 << " Mops/s\n";
+            return nsPerOp;
+        }
+    }
+}
+
+#endif //DATEANDTIME_LIB_BENCHMARK_HPP
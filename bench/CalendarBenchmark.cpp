@@ -0,0 +1,85 @@
+/**
+ * @file CalendarBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/Calendar.hpp"
+
+namespace {
+    /**
+     * @brief The previous rendering, a day of the week string per day & a @c std::stringstream, kept here as the
+     * baseline to compare against.
+     */
+    std::string legacyToString(const dt::Calendar& calendar) {
+        const char* weekdays[] {dt::consts::MONDAY, dt::consts::TUESDAY, dt::consts::WEDNESDAY, dt::consts::THURSDAY,
+                                dt::consts::FRIDAY, dt::consts::SATURDAY, dt::consts::SUNDAY};
+        std::stringstream ss;
+        ss << dt::DateTimeUtils::getMonthShortStr(calendar.getCurrentMonth()) << " " << calendar.getCurrentYear()
+           << "\nMo Tu We Th Fr Sa Su\n";
+        for (const auto& date : calendar.getDates()) {
+            int column{0};
+            while (date.getDayOfWeek() != weekdays[column]) {
+                ++column;
+            }
+            if (date.getDay() == 1) {
+                ss << std::string(static_cast<std::size_t>(column * 3), ' ');
+            }
+            const char* colour{date.getDay() == calendar.getCurrentDay() ? dt::consts::COLOR_GREEN
+                                                                         : dt::consts::COLOR_WHITE};
+            ss << (column == 0 ? "" : " ") << (date.getDay() < 10 ? " " : "") << colour << date.getDay()
+               << dt::consts::COLOR_RESET << (column == 6 ? "\n" : "");
+        }
+        return ss.str();
+    }
+}
+
+int main() {
+    std::vector<dt::Calendar> calendars;
+    for (int year{1990}; year < 2030; ++year) {
+        for (int month{1}; month <= 12; ++month) {
+            calendars.emplace_back(month + 10, month, year);
+        }
+    }
+
+    constexpr std::size_t legacyRounds{20};
+    constexpr std::size_t rounds{500};
+    constexpr int years{8'000};
+    char buffer[dt::Calendar::maxLength()];
+    std::vector<char> yearBuffer(dt::Calendar::maxLength(12, 3, dt::CalendarStyle::Plain));
+
+    dt::bench::run("calendar: month, stringstream (legacy)", legacyRounds * calendars.size(), [&] {
+        for (std::size_t i{0}; i < legacyRounds; ++i) {
+            for (const auto& c : calendars) {
+                dt::bench::doNotOptimize(legacyToString(c));
+            }
+        }
+    });
+    dt::bench::run("calendar: month, toString", rounds * calendars.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& c : calendars) {
+                dt::bench::doNotOptimize(c.toString());
+            }
+        }
+    });
+    dt::bench::run("calendar: month, toChars", rounds * calendars.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& c : calendars) {
+                dt::bench::doNotOptimize(c.toChars(buffer, buffer + sizeof(buffer)));
+            }
+        }
+    });
+    dt::bench::run("calendar: year, formatYear (plain)", years, [&] {
+        for (int year{0}; year < years; ++year) {
+            dt::bench::doNotOptimize(dt::Calendar::formatYear(dt::consts::MIN_YEAR + year, yearBuffer.data(),
+                                                              yearBuffer.data() + yearBuffer.size()));
+        }
+    });
+    return 0;
+}
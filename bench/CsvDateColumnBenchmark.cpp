@@ -0,0 +1,78 @@
+/**
+ * @file CsvDateColumnBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/BasicFormattedDate.hpp"
+#include "../include/dt/utils/CsvDateColumn.hpp"
+
+int main() {
+    constexpr std::size_t rows{2'000'000};
+    const std::string path{"/tmp/dt_csv_date_column_benchmark.csv"};
+    std::vector<dt::Date> dates;
+    dates.reserve(rows);
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "id,traded,symbol,price\n";
+        for (std::size_t i{0}; i < rows; ++i) {
+            dates.emplace_back(1 + static_cast<int>(i % 28), 1 + static_cast<int>(i % 12),
+                               1990 + static_cast<int>(i % 35));
+            char date[dt::consts::DATE_MAX_STRING_LENGTH];
+            const char* end{dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{dates.back()}.format(date)};
+            file << i << ',';
+            file.write(date, end - date);
+            file << ",ACME,101.25\n";
+        }
+    }
+
+    dt::bench::run("getline + split + Date(std::string)", rows, [&] {
+        std::ifstream file{path};
+        std::string line;
+        std::getline(file, line);
+        std::vector<dt::Date> out;
+        while (std::getline(file, line)) {
+            std::stringstream fields{line};
+            std::string field;
+            std::getline(fields, field, ',');
+            std::getline(fields, field, ',');
+            out.emplace_back(field);
+        }
+        dt::bench::doNotOptimize(out.data());
+    });
+
+    std::vector<dt::Date> chunk(4'096);
+    std::vector<std::uint64_t> chunkMask(dt::DateBatchParser::validMaskSize(chunk.size()));
+    dt::bench::run("CsvDateColumnReader::read (4096 row chunks)", rows, [&] {
+        dt::CsvDateColumnReader reader{path, 1};
+        while (reader.read(chunk.data(), chunkMask.data(), chunk.size()) > 0) {
+            dt::bench::doNotOptimize(chunk.data());
+        }
+    });
+    dt::bench::run("CsvDateColumnReader::readAll", rows, [&] {
+        std::vector<dt::Date> out;
+        std::vector<std::uint64_t> validMask;
+        dt::bench::doNotOptimize(dt::CsvDateColumnReader{path, 1}.readAll(out, validMask));
+    });
+
+    std::vector<char> buffer(dt::CsvDateColumnWriter::bufferSize(rows));
+    dt::bench::run("CsvDateColumnWriter::write", rows, [&] {
+        dt::bench::doNotOptimize(dt::CsvDateColumnWriter::write(dates.data(), rows, dt::DateFormat::YYYY_MM_DD,
+                                                                buffer.data()));
+    });
+    dt::bench::run("CsvDateColumnWriter::writeFile", rows, [&] {
+        dt::CsvDateColumnWriter::writeFile(path + ".out", "traded", dates.data(), rows, dt::DateFormat::YYYY_MM_DD);
+    });
+
+    std::remove(path.c_str());
+    std::remove((path + ".out").c_str());
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file CurrentTimeBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/time/CurrentTime.hpp"
+#include "../include/dt/utils/DateTimeUtils.hpp"
+
+namespace {
+    /**
+     * @brief The previous @c DateTimeUtils::getCurrentTimeStr, kept here as the baseline to compare against.
+     */
+    std::string legacyCurrentTimeStr() {
+        std::stringstream ss;
+        std::chrono::system_clock::time_point now{std::chrono::system_clock::now()};
+        std::time_t now_c{std::chrono::system_clock::to_time_t(now)};
+        const std::tm* timePtr{std::localtime(&now_c)};
+        ss << std::put_time(timePtr, "%H:%M:%S:");
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+        ss << std::setfill('0') << std::setw(3) << milliseconds;
+        return ss.str();
+    }
+
+    /**
+     * @brief Runs @p body @p calls times on each of @p threadCount threads at once.
+     */
+    template<typename Body>
+    void runConcurrently(unsigned int threadCount, std::size_t calls, Body body) {
+        std::vector<std::thread> threads;
+        for (unsigned int t{0}; t < threadCount; ++t) {
+            threads.emplace_back([&] {
+                for (std::size_t i{0}; i < calls; ++i) {
+                    body();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+int main() {
+    constexpr std::size_t calls{1'000'000};
+    constexpr unsigned int writers{16};
+
+    dt::bench::run("legacy stringstream + localtime + put_time", calls / 10, [&] {
+        for (std::size_t i{0}; i < calls / 10; ++i) {
+            dt::bench::doNotOptimize(legacyCurrentTimeStr());
+        }
+    });
+    dt::bench::run("legacy TimeStamp::setToCurrentTime", calls / 10, [&] {
+        dt::TimeStamp timeStamp;
+        for (std::size_t i{0}; i < calls / 10; ++i) {
+            timeStamp = dt::TimeStamp{legacyCurrentTimeStr()};
+            dt::bench::doNotOptimize(timeStamp);
+        }
+    });
+    dt::bench::run("std::chrono::system_clock::now", calls, [&] {
+        for (std::size_t i{0}; i < calls; ++i) {
+            dt::bench::doNotOptimize(std::chrono::system_clock::now());
+        }
+    });
+    dt::bench::run("CurrentTime::formatNow", calls, [&] {
+        char buffer[dt::consts::TIME_STAMP_STRING_LENGTH];
+        for (std::size_t i{0}; i < calls; ++i) {
+            dt::bench::doNotOptimize(dt::CurrentTime::formatNow(buffer));
+        }
+    });
+    dt::bench::run("DateTimeUtils::getCurrentTimeStr", calls, [&] {
+        for (std::size_t i{0}; i < calls; ++i) {
+            dt::bench::doNotOptimize(dt::DateTimeUtils::getCurrentTimeStr());
+        }
+    });
+    dt::bench::run("TimeStamp::setToCurrentTime", calls, [&] {
+        dt::TimeStamp timeStamp;
+        for (std::size_t i{0}; i < calls; ++i) {
+            timeStamp.setToCurrentTime();
+            dt::bench::doNotOptimize(timeStamp);
+        }
+    });
+
+    // Total calls over the wall time, all writers sharing the one cache.
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << ", writers: " << writers << "\n";
+    dt::bench::run("legacy stringstream path, 16 writers", writers * calls / 10, [&] {
+        runConcurrently(writers, calls / 10, [] {
+            dt::bench::doNotOptimize(legacyCurrentTimeStr());
+        });
+    });
+    dt::bench::run("CurrentTime::formatNow, 16 writers", writers * calls, [&] {
+        runConcurrently(writers, calls, [] {
+            char buffer[dt::consts::TIME_STAMP_STRING_LENGTH];
+            dt::bench::doNotOptimize(dt::CurrentTime::formatNow(buffer));
+        });
+    });
+    return 0;
+}
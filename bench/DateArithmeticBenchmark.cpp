@@ -0,0 +1,86 @@
+/**
+ * @file DateArithmeticBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/Date.hpp"
+
+namespace {
+    /**
+     * @brief The previous @c DateTimeUtils::daysSinceReferenceDate, a loop over every year since 1583, kept here as
+     * the baseline to compare against.
+     */
+    int legacyDaysSinceReferenceDate(const dt::Date& date) {
+        int days{0};
+        for (int year{dt::consts::MIN_YEAR}; year < date.getYear(); ++year) {
+            days += dt::DateTimeUtils::daysInYear(year);
+        }
+        for (int month{1}; month < date.getMonth(); ++month) {
+            days += dt::DateTimeUtils::daysInMonth(date.getYear(), month);
+        }
+        return days + date.getDay() - 1;
+    }
+}
+
+int main() {
+    std::vector<dt::Date> dates;
+    for (int year{1990}; year < 2030; ++year) {
+        for (int month{1}; month <= 12; ++month) {
+            dates.emplace_back(month + 10, month, year);
+        }
+    }
+
+    constexpr std::size_t legacyRounds{20};
+    constexpr std::size_t rounds{2'000};
+    const dt::Date reference{1, 1, 2000};
+
+    dt::bench::run("daysBetween: year loop (legacy)", legacyRounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < legacyRounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(legacyDaysSinceReferenceDate(d) - legacyDaysSinceReferenceDate(reference));
+            }
+        }
+    });
+    dt::bench::run("daysBetween: serial", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(dt::DateTimeUtils::daysBetween(d, reference));
+            }
+        }
+    });
+    dt::bench::run("addDays(100000) & back", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (auto& d : dates) {
+                d.addDays(100'000);
+                d.addDays(-100'000);
+                dt::bench::doNotOptimize(d);
+            }
+        }
+    });
+    dt::bench::run("addMonths(25)", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (auto& d : dates) {
+                dt::Date copy{d};
+                copy.addMonths(25);
+                dt::bench::doNotOptimize(copy);
+            }
+        }
+    });
+
+    std::vector<dt::Date> shuffled;
+    for (std::size_t i{0}; i < 1'000'000; ++i) {
+        shuffled.push_back(dates[i * 7'919 % dates.size()]);
+    }
+    dt::bench::run("sort 1M dates", shuffled.size(), [&] {
+        std::vector<dt::Date> copy{shuffled};
+        std::sort(copy.begin(), copy.end());
+        dt::bench::doNotOptimize(copy.front());
+    });
+    return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file DateTimeFormatBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/FormattedDate.hpp"
+#include "../include/dt/time/DateTime.hpp"
+
+namespace {
+    /**
+     * @brief Builds an RFC 3339 string by concatenating the date & time strings, the way callers did before
+     * @c DateTime::toChars, kept here as the baseline to compare against.
+     */
+    std::string concatenate(const dt::DateTime& dateTime) {
+        std::string text{dt::FormattedDate{dateTime.getDate(), dt::DateFormat::YYYY_MM_DD}.toString()};
+        text += dt::consts::DATE_TIME_SEPARATOR;
+        text += dateTime.getTimeStamp().toString();
+        text += "+01:00";
+        return text;
+    }
+}
+
+int main() {
+    std::vector<dt::DateTime> dateTimes;
+    for (int year{1990}; year < 2030; ++year) {
+        for (int month{1}; month <= 12; ++month) {
+            dateTimes.emplace_back(dt::Date{month + 10, month, year}, month, year % 60, month * 4,
+                                   year * 123'457 + month, 60);
+        }
+    }
+
+    constexpr std::size_t rounds{2'000};
+    char buffer[dt::consts::DATE_TIME_MAX_STRING_LENGTH];
+
+    dt::bench::run("rfc3339: FormattedDate + TimeStamp strings", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(concatenate(d));
+            }
+        }
+    });
+    dt::bench::run("rfc3339: DateTime::toString (ms)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(d.toString(dt::FractionPrecision::Milliseconds));
+            }
+        }
+    });
+    dt::bench::run("rfc3339: DateTime::toChars (ms)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(d.toChars(buffer, buffer + sizeof(buffer),
+                                                   dt::FractionPrecision::Milliseconds));
+            }
+        }
+    });
+    dt::bench::run("rfc3339: DateTime::toChars (ns, +00:00)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(d.toChars(buffer, buffer + sizeof(buffer),
+                                                   dt::FractionPrecision::Nanoseconds, dt::UtcStyle::Numeric));
+            }
+        }
+    });
+    return 0;
+}
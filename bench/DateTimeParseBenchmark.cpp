@@ -0,0 +1,72 @@
+/**
+ * @file DateTimeParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/time/DateTime.hpp"
+
+namespace {
+    /**
+     * @brief Splits an RFC 3339 date time by hand & feeds the pieces into @c Date & @c TimeStamp, the way it had to
+     * be done before @c DateTime existed. Only handles a millisecond fraction & a 'Z' or @c ±HH:MM offset.
+     */
+    int splitParse(const std::string& dateTime) {
+        dt::Date date{std::string_view{dateTime}.substr(0, 10)};
+        std::string time{dateTime.substr(11, 8) + ":" + dateTime.substr(20, 3)};
+        dt::TimeStamp timeStamp{time};
+
+        int offset{0};
+        std::size_t sign{dateTime.find_first_of("+-", 19)};
+        if (sign != std::string::npos) {
+            offset = std::stoi(dateTime.substr(sign + 1, 2)) * 60 + std::stoi(dateTime.substr(sign + 4, 2));
+            offset = dateTime[sign] == '-' ? -offset : offset;
+        }
+        return date.getDay() + timeStamp.getMillisecond() + offset;
+    }
+}
+
+int main() {
+    const std::vector<std::string> dateTimes {
+        "2023-07-09T18:46:37.123Z",
+        "2023-07-09T18:46:37.456+01:00",
+        "2001-12-22T00:00:00.000-05:30",
+        "2024-02-29T23:59:59.999Z",
+    };
+    const std::vector<std::string> precise {
+        "2023-07-09T18:46:37.123456789Z",
+        "2023-07-09T18:46:37.456789+01:00",
+        "2001-12-22T00:00:00.000000001-05:30",
+        "2024-02-29T23:59:59.999999Z",
+    };
+
+    constexpr std::size_t rounds{1'000'000};
+
+    dt::bench::run("split + Date + TimeStamp (ms)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(splitParse(d));
+            }
+        }
+    });
+    dt::bench::run("DateTime::tryParse (ms)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(dt::DateTime::tryParse(d));
+            }
+        }
+    });
+    dt::bench::run("DateTime::tryParse (us/ns)", rounds * precise.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : precise) {
+                dt::bench::doNotOptimize(dt::DateTime::tryParse(d));
+            }
+        }
+    });
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file EpochParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/EpochParser.hpp"
+
+int main() {
+    constexpr std::size_t count{1'000'000};
+    std::vector<std::int64_t> milliseconds(count);
+    std::vector<std::string> strings(count);
+    for (std::size_t i{0}; i < count; ++i) {
+        milliseconds[i] = 1'697'545'200'123 + static_cast<std::int64_t>(i) * 86'399'937;
+        strings[i] = std::to_string(milliseconds[i]);
+    }
+    std::vector<std::string_view> views(strings.begin(), strings.end());
+    std::vector<dt::DateTime> out(count);
+    std::vector<std::uint64_t> mask((count + 63) / 64);
+
+    dt::bench::run("chrono + gmtime_r", count, [&] {
+        for (std::int64_t value : milliseconds) {
+            const std::chrono::system_clock::time_point time{std::chrono::milliseconds{value}};
+            const std::time_t seconds{std::chrono::system_clock::to_time_t(time)};
+            std::tm tm{};
+            gmtime_r(&seconds, &tm);
+            const auto millis{std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()) % 1000};
+            dt::bench::doNotOptimize(dt::Date{tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900});
+            dt::bench::doNotOptimize(dt::TimeStamp{tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(millis.count())});
+        }
+    });
+    dt::bench::run("EpochParser::fromValue (Auto)", count, [&] {
+        for (std::int64_t value : milliseconds) {
+            dt::bench::doNotOptimize(dt::EpochParser::fromValue(value));
+        }
+    });
+    dt::bench::run("EpochParser::parse int64 (Auto)", count, [&] {
+        dt::bench::doNotOptimize(dt::EpochParser::parse(milliseconds.data(), count, dt::EpochUnit::Auto, out.data(),
+                                                        mask.data()));
+    });
+    dt::bench::run("EpochParser::parse int64 (Milliseconds)", count, [&] {
+        dt::bench::doNotOptimize(dt::EpochParser::parse(milliseconds.data(), count, dt::EpochUnit::Milliseconds,
+                                                        out.data(), mask.data()));
+    });
+    dt::bench::run("EpochParser::parse string_view (Auto)", count, [&] {
+        dt::bench::doNotOptimize(dt::EpochParser::parse(views.data(), count, dt::EpochUnit::Auto, out.data(),
+                                                        mask.data()));
+    });
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file FormatBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/FormattedDate.hpp"
+#include "../include/dt/time/TimeStamp.hpp"
+
+namespace {
+    /**
+     * @brief The previous @c std::stringstream based @c FormattedDate::toString for @c DateFormat::YYYY_MM_DD, kept
+     * here as the baseline to compare against.
+     */
+    std::string legacyToString(const dt::Date& date) {
+        auto component = [](int c) {
+            return (c < 10) ? dt::consts::LEADING_ZERO + std::to_string(c) : std::to_string(c);
+        };
+        std::stringstream ss;
+        ss << date.getYear() << dt::consts::DATE_SEPARATOR_DASH;
+        ss << component(date.getMonth()) << dt::consts::DATE_SEPARATOR_DASH;
+        ss << component(date.getDay());
+        return ss.str();
+    }
+}
+
+int main() {
+    using IsoDate = dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>;
+
+    std::vector<dt::Date> dates;
+    std::vector<std::string> strings;
+    for (int year{1990}; year < 2030; ++year) {
+        for (int month{1}; month <= 12; ++month) {
+            dates.emplace_back(month + 10, month, year);
+            strings.push_back(IsoDate{dates.back()}.toString());
+        }
+    }
+
+    std::vector<dt::FormattedDate> runtimeDates;
+    std::vector<IsoDate> compileTimeDates;
+    for (const auto& d : dates) {
+        runtimeDates.emplace_back(d, dt::DateFormat::YYYY_MM_DD);
+        compileTimeDates.emplace_back(d);
+    }
+
+    constexpr std::size_t legacyRounds{200};
+    constexpr std::size_t rounds{5'000};
+    char buffer[dt::consts::DATE_MAX_STRING_LENGTH];
+
+    dt::bench::run("format: stringstream (legacy)", legacyRounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < legacyRounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(legacyToString(d));
+            }
+        }
+    });
+    dt::bench::run("format: FormattedDate::toString", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : runtimeDates) {
+                dt::bench::doNotOptimize(d.toString());
+            }
+        }
+    });
+    dt::bench::run("format: BasicFormattedDate::toString", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : compileTimeDates) {
+                dt::bench::doNotOptimize(d.toString());
+            }
+        }
+    });
+    dt::bench::run("format: FormattedDate::format (runtime)", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : runtimeDates) {
+                d.format(buffer);
+                dt::bench::doNotOptimize(buffer);
+            }
+        }
+    });
+    dt::bench::run("format: BasicFormattedDate::format (compile)", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : compileTimeDates) {
+                d.format(buffer);
+                dt::bench::doNotOptimize(buffer);
+            }
+        }
+    });
+    dt::bench::run("format: Date::toString", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(d.toString());
+            }
+        }
+    });
+    dt::bench::run("format: Date::toChars", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(d.toChars(buffer, buffer + sizeof(buffer)));
+            }
+        }
+    });
+    dt::bench::run("format: Date::toInlineString", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(d.toInlineString());
+            }
+        }
+    });
+
+    std::vector<dt::TimeStamp> timeStamps;
+    for (int i{0}; i < 480; ++i) {
+        timeStamps.emplace_back(i % 24, i % 60, (i * 7) % 60, (i * 37) % 1'000);
+    }
+    char timeBuffer[dt::consts::TIME_STAMP_STRING_LENGTH];
+    dt::bench::run("format: TimeStamp::toString", rounds * timeStamps.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& t : timeStamps) {
+                dt::bench::doNotOptimize(t.toString());
+            }
+        }
+    });
+    dt::bench::run("format: TimeStamp::toChars", rounds * timeStamps.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& t : timeStamps) {
+                dt::bench::doNotOptimize(t.toChars(timeBuffer, timeBuffer + sizeof(timeBuffer)));
+            }
+        }
+    });
+
+    dt::bench::run("parse: FormattedDate(std::string_view)", rounds * strings.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& s : strings) {
+                dt::bench::doNotOptimize(dt::FormattedDate{s, dt::DateFormat::YYYY_MM_DD});
+            }
+        }
+    });
+    dt::bench::run("parse: BasicFormattedDate::tryParse", rounds * strings.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& s : strings) {
+                dt::bench::doNotOptimize(IsoDate::tryParse(s));
+            }
+        }
+    });
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file FormatterBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/Formatters.hpp"
+
+int main() {
+    std::vector<dt::Date> dates;
+    std::vector<dt::TimeStamp> timeStamps;
+    for (int year{1990}; year < 2030; ++year) {
+        for (int month{1}; month <= 12; ++month) {
+            dates.emplace_back(month + 10, month, year);
+            timeStamps.emplace_back(month + 6, month * 4, year % 60, year % 1'000);
+        }
+    }
+    const std::size_t count{dates.size()};
+
+    std::ostringstream stream;
+    dt::bench::run("std::ostringstream << date << ' ' << timeStamp", count, [&] {
+        for (std::size_t i{0}; i < count; ++i) {
+            stream.str({});
+            stream << dates[i] << ' ' << timeStamps[i];
+            dt::bench::doNotOptimize(stream);
+        }
+    });
+    dt::bench::run("std::ostringstream << FormattedDate", count, [&] {
+        for (const dt::Date& date : dates) {
+            stream.str({});
+            stream << dt::FormattedDate{date, dt::DateFormat::YYYY_MM_DD};
+            dt::bench::doNotOptimize(stream);
+        }
+    });
+
+#ifdef DT_HAS_FMT
+    fmt::memory_buffer buffer;
+    dt::bench::run("fmt::format_to(\"{} {}\", date, timeStamp)", count, [&] {
+        for (std::size_t i{0}; i < count; ++i) {
+            buffer.clear();
+            fmt::format_to(std::back_inserter(buffer), "{} {}", dates[i], timeStamps[i]);
+            dt::bench::doNotOptimize(buffer.data());
+        }
+    });
+    dt::bench::run("fmt::format_to(\"{:YYYY-MM-DD}\", date)", count, [&] {
+        for (const dt::Date& date : dates) {
+            buffer.clear();
+            fmt::format_to(std::back_inserter(buffer), "{:YYYY-MM-DD}", date);
+            dt::bench::doNotOptimize(buffer.data());
+        }
+    });
+    dt::bench::run("fmt::format(\"{} {}\", date, timeStamp)", count, [&] {
+        for (std::size_t i{0}; i < count; ++i) {
+            dt::bench::doNotOptimize(fmt::format("{} {}", dates[i], timeStamps[i]));
+        }
+    });
+#endif
+
+#ifdef DT_HAS_STD_FORMAT
+    std::string text;
+    dt::bench::run("std::format_to(\"{} {}\", date, timeStamp)", count, [&] {
+        for (std::size_t i{0}; i < count; ++i) {
+            text.clear();
+            std::format_to(std::back_inserter(text), "{} {}", dates[i], timeStamps[i]);
+            dt::bench::doNotOptimize(text.data());
+        }
+    });
+    dt::bench::run("std::format_to(\"{:YYYY-MM-DD}\", date)", count, [&] {
+        for (const dt::Date& date : dates) {
+            text.clear();
+            std::format_to(std::back_inserter(text), "{:YYYY-MM-DD}", date);
+            dt::bench::doNotOptimize(text.data());
+        }
+    });
+#endif
+    return 0;
+}
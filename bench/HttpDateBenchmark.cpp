@@ -0,0 +1,83 @@
+/**
+ * @file HttpDateBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/time/HttpDate.hpp"
+#include "../include/dt/utils/DateTimeUtils.hpp"
+
+namespace {
+    /**
+     * @brief Builds an HTTP-date from the existing string helpers, the way it had to be done before @c HttpDate
+     * existed.
+     */
+    std::string legacyFormat(const dt::DateTime& dateTime) {
+        dt::Date date{dateTime.getDate()};
+        std::ostringstream ss;
+        ss << date.getDayOfWeek().substr(0, 3) << ", " << (date.getDay() < 10 ? "0" : "") << date.getDay() << " "
+           << dt::DateTimeUtils::getMonthShortStr(date.getMonth()) << " " << date.getYear() << " "
+           << dateTime.getTimeStamp().toString().substr(0, 8) << " GMT";
+        return ss.str();
+    }
+}
+
+int main() {
+    using namespace std::chrono;
+    const std::vector<dt::DateTime> dateTimes {
+        dt::DateTime{"2023-07-09T18:46:37Z"},
+        dt::DateTime{"2001-12-22T00:00:00Z"},
+        dt::DateTime{"2024-02-29T23:59:59Z"},
+        dt::DateTime{"1994-11-06T08:49:37Z"},
+    };
+    const std::vector<std::string> httpDates {
+        "Sun, 09 Jul 2023 18:46:37 GMT",
+        "Sat, 22 Dec 2001 00:00:00 GMT",
+        "Thu, 29 Feb 2024 23:59:59 GMT",
+        "Sun, 06 Nov 1994 08:49:37 GMT",
+    };
+    const system_clock::time_point now{seconds{1'688'928'397}};
+
+    constexpr std::size_t rounds{1'000'000};
+    char buffer[dt::consts::HTTP_DATE_STRING_LENGTH];
+
+    dt::bench::run("getDayOfWeek + getMonthShortStr + stringstream", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(legacyFormat(d));
+            }
+        }
+    });
+    dt::bench::run("HttpDate::format(DateTime)", rounds * dateTimes.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dateTimes) {
+                dt::bench::doNotOptimize(dt::HttpDate::format(d, buffer));
+            }
+        }
+    });
+    dt::bench::run("HttpDate::format(time_point), same second", rounds * 4, [&] {
+        for (std::size_t i{0}; i < rounds * 4; ++i) {
+            dt::bench::doNotOptimize(dt::HttpDate::format(now + milliseconds{i % 1'000}, buffer));
+        }
+    });
+    dt::bench::run("HttpDate::format(time_point), new second", rounds * 4, [&] {
+        for (std::size_t i{0}; i < rounds * 4; ++i) {
+            dt::bench::doNotOptimize(dt::HttpDate::format(now + seconds{i}, buffer));
+        }
+    });
+    dt::bench::run("HttpDate::tryParse", rounds * httpDates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : httpDates) {
+                dt::bench::doNotOptimize(dt::HttpDate::tryParse(d));
+            }
+        }
+    });
+    return 0;
+}
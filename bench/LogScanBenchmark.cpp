@@ -0,0 +1,96 @@
+/**
+ * @file LogScanBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/LogScanner.hpp"
+
+namespace {
+    /**
+     * @brief Builds a log of typical lines: a date & time stamp, a host, a pid & a message with a few numbers.
+     */
+    std::string makeLog(std::size_t size) {
+        const char* messages[] {
+            "GET /api/v1/orders?page=12 200 1532 bytes in 0.042s",
+            "connection from 10.0.14.201:55312 closed after 120 requests",
+            "checkpoint complete: wrote 2817 buffers (17.2%); 0 WAL file(s) added",
+            "user 48213 logged in from session 9f2c1e",
+        };
+        std::mt19937 random{2001};
+        std::uniform_int_distribution<int> day{1, 28};
+        std::uniform_int_distribution<int> second{0, 86'399};
+        std::uniform_int_distribution<std::size_t> message{0, std::size(messages) - 1};
+
+        std::string log;
+        log.reserve(size + 256);
+        char prefix[64];
+        while (log.size() < size) {
+            int s{second(random)};
+            std::snprintf(prefix, sizeof(prefix), "2023-07-%02d %02d:%02d:%02d:%03d web%02d app[%d]: ", day(random),
+                          s / 3'600, s / 60 % 60, s % 60, s % 1'000, s % 16, s % 30'000);
+            log += prefix;
+            log += messages[message(random)];
+            log += '\n';
+        }
+        return log;
+    }
+}
+
+int main() {
+    const std::string log{makeLog(64 << 20)};
+    const std::string small{log.substr(0, log.find('\n', 1 << 20) + 1)};
+    std::cout << "Throughput in MB/s (bytes as operations), " << log.size() / (1 << 20) << " MiB log\n";
+
+    // The hand rolled regex a free-form log had to be searched with before.
+    const std::regex pattern{R"(\d{4}[-/]\d{2}[-/]\d{2}|\d{2}[-/]\d{2}[-/]\d{4}|\d{2}:\d{2}:\d{2}:\d{3})"};
+    dt::bench::run("std::regex + tryParse (1 MiB)", small.size(), [&] {
+        std::size_t found{0};
+        for (std::sregex_iterator it{small.begin(), small.end(), pattern}, end; it != end; ++it) {
+            std::string_view match{small.data() + it->position(), static_cast<std::size_t>(it->length())};
+            found += match.size() == dt::consts::DATE_STRING_LENGTH ? static_cast<bool>(dt::Date::tryParse(match))
+                                                                    : static_cast<bool>(dt::TimeStamp::tryParse(match));
+        }
+        dt::bench::doNotOptimize(found);
+    });
+    dt::bench::run("StreamTokenizer", log.size(), [&] {
+        std::size_t found{0};
+        dt::StreamTokenizer tokenizer;
+        auto onToken = [&found](const dt::StreamToken&) { ++found; };
+        tokenizer.feed(log, onToken);
+        tokenizer.finish(onToken);
+        dt::bench::doNotOptimize(found);
+    });
+
+    std::vector<dt::StreamToken> tokens;
+    const std::pair<const char*, dt::BatchBackend> backends[] {
+        {"LogScanner (Scalar)", dt::BatchBackend::Scalar},
+        {"LogScanner (SSSE3)", dt::BatchBackend::SSSE3},
+        {"LogScanner (AVX2)", dt::BatchBackend::AVX2},
+    };
+    for (const auto& [name, backend] : backends) {
+        dt::bench::run(name, log.size(), [&, backend = backend] {
+            tokens.clear();
+            dt::LogScanner::scan(log, tokens, backend);
+            dt::bench::doNotOptimize(tokens.data());
+        });
+    }
+    std::cout << tokens.size() << " tokens\n";
+
+    // The cost of classifying the bytes alone, on text without a single token character.
+    const std::string text(log.size(), 'x');
+    dt::bench::run("LogScanner (AVX2), text only", text.size(), [&] {
+        tokens.clear();
+        dt::LogScanner::scan(text, tokens, dt::BatchBackend::AVX2);
+        dt::bench::doNotOptimize(tokens.data());
+    });
+    return 0;
+}
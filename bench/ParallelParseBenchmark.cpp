@@ -0,0 +1,49 @@
+/**
+ * @file ParallelParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/DateTimeUtils.hpp"
+
+int main() {
+    constexpr std::size_t count{4'000'000};
+
+    std::mt19937 rng{42};
+    std::vector<std::string> dates;
+    dates.reserve(count);
+    for (std::size_t i{0}; i < count; ++i) {
+        char date[16];
+        int day{1 + static_cast<int>(rng() % 28)};
+        int month{1 + static_cast<int>(rng() % 12)};
+        int year{1900 + static_cast<int>(rng() % 200)};
+        std::snprintf(date, sizeof(date), "%04d-%02d-%02d", year, month, day);
+        dates.emplace_back(date);
+    }
+
+    // Scaling across 1..N threads, N being twice the hardware threads to show where it flattens out.
+    unsigned int maxThreads{std::max(1U, std::thread::hardware_concurrency()) * 2};
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    std::vector<std::uint64_t> validMask;
+    double single{dt::bench::run("tryParseDateStrings (sequential)", count, [&] {
+        dt::bench::doNotOptimize(dt::DateTimeUtils::tryParseDateStrings(dates));
+    })};
+    for (unsigned int threads{1}; threads <= maxThreads; threads *= 2) {
+        std::string name{"parseDateStrings, " + std::to_string(threads) + " thread(s)"};
+        double nsPerOp{dt::bench::run(name.c_str(), count, [&] {
+            dt::bench::doNotOptimize(dt::DateTimeUtils::parseDateStrings(dates, validMask, threads));
+        })};
+        std::cout << "    speedup vs sequential: " << single / nsPerOp << "x\n";
+    }
+    return 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file ParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <array>
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/BasicFormattedDate.hpp"
+#include "../include/dt/date/Date.hpp"
+#include "../include/dt/time/TimeStamp.hpp"
+#include "../include/dt/utils/DateTimeUtils.hpp"
+
+namespace {
+    /**
+     * @brief The previous regex based @c Date parser, kept here as the baseline to compare against.
+     */
+    int legacyParseDate(const std::string& date) {
+        static const std::array<std::string, 4> datePatterns {
+            "^\\d{4}-\\d{2}-\\d{2}$",
+            "^\\d{2}-\\d{2}-\\d{4}$",
+            "^\\d{4}/\\d{2}/\\d{2}$",
+            "^\\d{2}/\\d{2}/\\d{4}$",
+        };
+        for (std::size_t i{0}; i < datePatterns.size(); ++i) {
+            std::regex regexPattern{datePatterns[i]};
+            if (std::regex_match(date, regexPattern)) {
+                if (i % 2 == 0) {
+                    return std::stoi(date.substr(0, 4)) + std::stoi(date.substr(5, 2)) + std::stoi(date.substr(8, 2));
+                }
+                return std::stoi(date.substr(0, 2)) + std::stoi(date.substr(3, 2)) + std::stoi(date.substr(6, 4));
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief The previous regex based @c TimeStamp parser, kept here as the baseline to compare against.
+     */
+    int legacyParseTimeStamp(const std::string& timeStamp) {
+        static const std::string timeStampPattern{"^\\d{2}:\\d{2}:\\d{2}:\\d{3}"};
+        if (std::regex regexPattern{timeStampPattern}; std::regex_match(timeStamp, regexPattern)) {
+            return std::stoi(timeStamp.substr(0, 2)) + std::stoi(timeStamp.substr(3, 2)) +
+                   std::stoi(timeStamp.substr(6, 2)) + std::stoi(timeStamp.substr(9, 4));
+        }
+        return 0;
+    }
+}
+
+int main() {
+    const std::vector<std::string> dates {
+        "22-12-2001", "2001/12/22", "09/07/2023", "2023-07-09", "12-22-2001", "31/01/2024", "2024-02-29", "01-01-1583"
+    };
+    const std::vector<std::string> timeStamps {
+        "18:46:37:123", "00:00:00:000", "23:59:59:999", "12:30:45:500"
+    };
+
+    constexpr std::size_t legacyRounds{200};
+    constexpr std::size_t rounds{2'000'000};
+
+    dt::bench::run("Date: regex + stoi (legacy)", legacyRounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < legacyRounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(legacyParseDate(d));
+            }
+        }
+    });
+    dt::bench::run("Date: Date(std::string_view)", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(dt::Date{d});
+            }
+        }
+    });
+
+    const std::vector<std::string> textDates {
+        "22 Dec 2001", "22-DEC-2001", "December 22, 2001", "9 Jul 2023", "Jul 9, 2023", "31-JAN-2024", "29 Feb 2024",
+        "1 January 1583"
+    };
+    dt::bench::run("Date: Date::tryParse (numeric)", rounds * dates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : dates) {
+                dt::bench::doNotOptimize(dt::Date::tryParse(d));
+            }
+        }
+    });
+    dt::bench::run("Date: Date::tryParseText (month names)", rounds * textDates.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& d : textDates) {
+                dt::bench::doNotOptimize(dt::Date::tryParseText(d));
+            }
+        }
+    });
+
+    // A dirty feed: 1 row in 10 is malformed or doesn't exist.
+    const std::vector<std::string> dirtyDates {
+        "22-12-2001", "2001/12/22", "09/07/2023", "2023-07-09", "12-22-2001",
+        "31/01/2024", "2024-02-29", "01-01-1583", "2023-02-29", "30/11/1999",
+        "2001-12-22", "22/12/2001", "07-09-2023", "2023/07/09", "12/22/2001",
+        "01-31-2024", "2024/02/29", "1583-01-01", "22.12.2001", "1999-11-30"
+    };
+    constexpr std::size_t dirtyRounds{100'000};
+
+    dt::bench::run("Date: 10% bad rows, Date() + try/catch", dirtyRounds * dirtyDates.size(), [&] {
+        for (std::size_t i{0}; i < dirtyRounds; ++i) {
+            for (const auto& d : dirtyDates) {
+                try {
+                    dt::bench::doNotOptimize(dt::Date{d});
+                } catch (const std::exception& ex) {
+                    dt::bench::doNotOptimize(ex);
+                }
+            }
+        }
+    });
+    dt::bench::run("Date: 10% bad rows, Date::tryParse", dirtyRounds * dirtyDates.size(), [&] {
+        for (std::size_t i{0}; i < dirtyRounds; ++i) {
+            for (const auto& d : dirtyDates) {
+                dt::bench::doNotOptimize(dt::Date::tryParse(d));
+            }
+        }
+    });
+
+    // One column in a single layout: both orders are tried on every row vs one inferred layout for the column.
+    std::vector<std::string> column;
+    for (std::size_t i{0}; i < 100'000; ++i) {
+        column.push_back(dt::BasicFormattedDate<dt::DateFormat::DD__MM__YYYY>{
+            dt::Date{1 + static_cast<int>(i % 28), 1 + static_cast<int>(i % 12), 1990 + static_cast<int>(i % 30)}
+        }.toString());
+    }
+    constexpr std::size_t columnRounds{20};
+    std::vector<std::size_t> contradictingRows;
+
+    dt::bench::run("Column: tryParseDateStrings", columnRounds * column.size(), [&] {
+        for (std::size_t i{0}; i < columnRounds; ++i) {
+            dt::bench::doNotOptimize(dt::DateTimeUtils::tryParseDateStrings(column));
+        }
+    });
+    dt::bench::run("Column: inferDateFormat + parseDateStrings", columnRounds * column.size(), [&] {
+        for (std::size_t i{0}; i < columnRounds; ++i) {
+            dt::DateFormat format{dt::DateTimeUtils::inferDateFormat(column).value()};
+            dt::bench::doNotOptimize(dt::DateTimeUtils::parseDateStrings(column, format, contradictingRows));
+        }
+    });
+
+    dt::bench::run("TimeStamp: regex + stoi (legacy)", legacyRounds * timeStamps.size(), [&] {
+        for (std::size_t i{0}; i < legacyRounds; ++i) {
+            for (const auto& t : timeStamps) {
+                dt::bench::doNotOptimize(legacyParseTimeStamp(t));
+            }
+        }
+    });
+    dt::bench::run("TimeStamp: TimeStamp(std::string_view)", rounds * timeStamps.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& t : timeStamps) {
+                dt::bench::doNotOptimize(dt::TimeStamp{t});
+            }
+        }
+    });
+
+    // Warehouse style integers, 20231017 & 184637123, through a string vs decoded directly.
+    std::vector<std::int32_t> ymdInts;
+    std::vector<std::int32_t> hmsmInts;
+    for (int i{0}; i < 4'096; ++i) {
+        ymdInts.push_back(20230101 + (i % 12) * 100 + i % 28);
+        hmsmInts.push_back((i % 24) * 10'000'000 + (i % 60) * 100'000 + (i * 7 % 60) * 1'000 + i % 1'000);
+    }
+    constexpr std::size_t intRounds{500};
+    std::vector<dt::Date> intDates(ymdInts.size());
+    std::vector<dt::TimeStamp> intTimeStamps(hmsmInts.size());
+    std::vector<std::uint64_t> intValidMask(ymdInts.size() / 64);
+
+    dt::bench::run("Int: to_string + Date(std::string_view)", intRounds / 10 * ymdInts.size(), [&] {
+        for (std::size_t i{0}; i < intRounds / 10; ++i) {
+            for (std::int32_t ymd : ymdInts) {
+                std::string s{std::to_string(ymd)};
+                dt::bench::doNotOptimize(dt::Date{s.substr(0, 4) + "-" + s.substr(4, 2) + "-" + s.substr(6, 2)});
+            }
+        }
+    });
+    dt::bench::run("Int: Date::fromYmdInt", intRounds * ymdInts.size(), [&] {
+        for (std::size_t i{0}; i < intRounds; ++i) {
+            for (std::int32_t ymd : ymdInts) {
+                dt::bench::doNotOptimize(dt::Date::fromYmdInt(ymd));
+            }
+        }
+    });
+    dt::bench::run("Int: Date::fromYmdInts", intRounds * ymdInts.size(), [&] {
+        for (std::size_t i{0}; i < intRounds; ++i) {
+            dt::bench::doNotOptimize(dt::Date::fromYmdInts(ymdInts.data(), ymdInts.size(), intDates.data(),
+                                                           intValidMask.data()));
+        }
+    });
+    dt::bench::run("Int: Date::toYmdInts", intRounds * ymdInts.size(), [&] {
+        for (std::size_t i{0}; i < intRounds; ++i) {
+            dt::Date::toYmdInts(intDates.data(), intDates.size(), ymdInts.data());
+            dt::bench::doNotOptimize(ymdInts.data());
+        }
+    });
+    dt::bench::run("Int: TimeStamp::fromHmsmInts", intRounds * hmsmInts.size(), [&] {
+        for (std::size_t i{0}; i < intRounds; ++i) {
+            dt::bench::doNotOptimize(dt::TimeStamp::fromHmsmInts(hmsmInts.data(), hmsmInts.size(),
+                                                                 intTimeStamps.data(), intValidMask.data()));
+        }
+    });
+    return 0;
+}
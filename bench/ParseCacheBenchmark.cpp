@@ -0,0 +1,92 @@
+/**
+ * @file ParseCacheBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/date/BasicFormattedDate.hpp"
+#include "../include/dt/utils/ParseCache.hpp"
+
+namespace {
+    /**
+     * @brief Draws @p count indices into @p distinct values, where value @c k has a weight of @c 1/(k+1)^s, like the
+     * few hundred dates that dominate a log or transaction feed.
+     */
+    std::vector<std::size_t> zipf(std::size_t count, std::size_t distinct, double s) {
+        std::vector<double> weights;
+        for (std::size_t k{0}; k < distinct; ++k) {
+            weights.push_back(1.0 / std::pow(static_cast<double>(k + 1), s));
+        }
+        std::mt19937 rng{42};
+        std::discrete_distribution<std::size_t> distribution{weights.begin(), weights.end()};
+        std::vector<std::size_t> indices(count);
+        for (auto& index : indices) {
+            index = distribution(rng);
+        }
+        return indices;
+    }
+}
+
+int main() {
+    constexpr std::size_t count{2'000'000};
+    constexpr std::size_t distinct{500};
+
+    std::vector<std::string> dates;
+    std::vector<std::string> timeStamps;
+    for (std::size_t k{0}; k < distinct; ++k) {
+        int i{static_cast<int>(k)};
+        dates.push_back(dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{
+            dt::Date{1 + i % 28, 1 + i % 12, 2000 + i % 25}
+        }.toString());
+        timeStamps.push_back(dt::TimeStamp{i % 24, (i * 7) % 60, (i * 13) % 60, 0}.toString());
+    }
+
+    for (double s : {0.8, 1.1}) {
+        std::vector<std::size_t> indices{zipf(count, distinct, s)};
+        std::vector<std::string> dateFeed;
+        std::vector<std::string> timeStampFeed;
+        for (std::size_t i{0}; i < count; ++i) {
+            dateFeed.push_back(dates[indices[i]]);
+            // Same second, different milliseconds.
+            std::string t{timeStamps[indices[i]]};
+            t.replace(9, 3, std::to_string(100 + i % 900));
+            timeStampFeed.push_back(t);
+        }
+        std::cout << "Zipf s=" << s << ", " << distinct << " distinct values\n";
+
+        dt::DateParseCache dateCache;
+        dt::TimeStampParseCache timeStampCache;
+        dt::bench::run("  Date::tryParse", count, [&] {
+            for (const auto& d : dateFeed) {
+                dt::bench::doNotOptimize(dt::Date::tryParse(d));
+            }
+        });
+        dt::bench::run("  DateParseCache::tryParse", count, [&] {
+            for (const auto& d : dateFeed) {
+                dt::bench::doNotOptimize(dateCache.tryParse(d));
+            }
+        });
+        std::cout << "    hits: " << dateCache.getHits() << ", misses: " << dateCache.getMisses() << "\n";
+
+        dt::bench::run("  TimeStamp::tryParse", count, [&] {
+            for (const auto& t : timeStampFeed) {
+                dt::bench::doNotOptimize(dt::TimeStamp::tryParse(t));
+            }
+        });
+        dt::bench::run("  TimeStampParseCache::tryParse", count, [&] {
+            for (const auto& t : timeStampFeed) {
+                dt::bench::doNotOptimize(timeStampCache.tryParse(t));
+            }
+        });
+        std::cout << "    hits: " << timeStampCache.getHits() << ", misses: " << timeStampCache.getMisses() << "\n";
+    }
+    return 0;
+}
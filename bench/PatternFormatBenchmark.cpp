@@ -0,0 +1,118 @@
+/**
+ * @file PatternFormatBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/time/DateTimePattern.hpp"
+
+int main() {
+    std::vector<dt::DateTime> dateTimes;
+    std::vector<std::tm> tms;
+    for (int i{0}; i < 1'000; ++i) {
+        dateTimes.emplace_back(dt::Date{1 + i % 28, 1 + i % 12, 1990 + i % 40}, i % 24, i % 60, (i * 7) % 60,
+                               (i * 7'919) % 1'000 * 1'000'000);
+        std::tm tm{};
+        tm.tm_year = 90 + i % 40;
+        tm.tm_mon = i % 12;
+        tm.tm_mday = 1 + i % 28;
+        tm.tm_hour = i % 24;
+        tm.tm_min = i % 60;
+        tm.tm_sec = (i * 7) % 60;
+        std::mktime(&tm);
+        tms.push_back(tm);
+    }
+
+    constexpr std::size_t rounds{200};
+    constexpr std::size_t putTimeRounds{20};
+    char buffer[64];
+
+    // The shape of DateTimeUtils::getCurrentTimeStr, minus the clock read.
+    dt::bench::run("%H:%M:%S: stringstream + std::put_time", putTimeRounds * tms.size(), [&] {
+        for (std::size_t r{0}; r < putTimeRounds; ++r) {
+            for (const auto& tm : tms) {
+                std::stringstream ss;
+                ss << std::put_time(&tm, "%H:%M:%S:");
+                dt::bench::doNotOptimize(ss.str());
+            }
+        }
+    });
+    dt::bench::run("%H:%M:%S: std::strftime", rounds * tms.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& tm : tms) {
+                dt::bench::doNotOptimize(std::strftime(buffer, sizeof(buffer), "%H:%M:%S:", &tm));
+            }
+        }
+    });
+    const dt::DateTimePattern timePattern{"%H:%M:%S:"};
+    dt::bench::run("%H:%M:%S: DateTimePattern::format", rounds * dateTimes.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& dateTime : dateTimes) {
+                dt::bench::doNotOptimize(timePattern.format(dateTime, buffer, buffer + sizeof(buffer)));
+            }
+        }
+    });
+
+    dt::bench::run("%a %d %b %Y %T std::put_time", putTimeRounds * tms.size(), [&] {
+        for (std::size_t r{0}; r < putTimeRounds; ++r) {
+            for (const auto& tm : tms) {
+                std::stringstream ss;
+                ss << std::put_time(&tm, "%a %d %b %Y %T");
+                dt::bench::doNotOptimize(ss.str());
+            }
+        }
+    });
+    dt::bench::run("%a %d %b %Y %T std::strftime", rounds * tms.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& tm : tms) {
+                dt::bench::doNotOptimize(std::strftime(buffer, sizeof(buffer), "%a %d %b %Y %T", &tm));
+            }
+        }
+    });
+    const dt::DateTimePattern longPattern{"%a %d %b %Y %T"};
+    dt::bench::run("%a %d %b %Y %T DateTimePattern::format", rounds * dateTimes.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& dateTime : dateTimes) {
+                dt::bench::doNotOptimize(longPattern.format(dateTime, buffer, buffer + sizeof(buffer)));
+            }
+        }
+    });
+    dt::bench::run("%a %d %b %Y %T DateTimePattern::toString", rounds * dateTimes.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& dateTime : dateTimes) {
+                dt::bench::doNotOptimize(longPattern.toString(dateTime));
+            }
+        }
+    });
+
+    std::vector<std::string> strings;
+    for (const auto& dateTime : dateTimes) {
+        strings.push_back(longPattern.toString(dateTime));
+    }
+    dt::bench::run("%a %d %b %Y %T std::get_time", putTimeRounds * strings.size(), [&] {
+        for (std::size_t r{0}; r < putTimeRounds; ++r) {
+            for (const auto& s : strings) {
+                std::istringstream ss{s};
+                std::tm tm{};
+                ss >> std::get_time(&tm, "%a %d %b %Y %T");
+                dt::bench::doNotOptimize(tm);
+            }
+        }
+    });
+    dt::bench::run("%a %d %b %Y %T DateTimePattern::tryParse", rounds * strings.size(), [&] {
+        for (std::size_t r{0}; r < rounds; ++r) {
+            for (const auto& s : strings) {
+                dt::bench::doNotOptimize(longPattern.tryParse(s));
+            }
+        }
+    });
+    return 0;
+}
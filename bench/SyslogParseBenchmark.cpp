@@ -0,0 +1,47 @@
+/**
+ * @file SyslogParseBenchmark.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../include/dt/utils/SyslogParser.hpp"
+
+int main() {
+    const std::vector<std::string> lines {
+        "Oct 17 12:34:56 web01 sshd[4242]: Accepted publickey for deploy",
+        "Oct  7 00:00:01 web02 CRON[17]: (root) CMD (run-parts /etc/cron.hourly)",
+        "Dec 31 23:59:59 db01 postgres[900]: checkpoint complete",
+        "Jan  1 00:00:00 db01 postgres[900]: checkpoint starting",
+    };
+    const std::vector<std::string> rfc5424 {
+        "2023-10-17T12:34:56.123456Z",
+        "2023-10-07T00:00:01+01:00",
+        "2023-12-31T23:59:59.5-05:00",
+        "2024-01-01T00:00:00Z",
+    };
+
+    constexpr std::size_t rounds{1'000'000};
+    const dt::SyslogParser parser{dt::Date{17, 10, 2023}};
+
+    dt::bench::run("SyslogParser::tryParseRfc3164 (line prefix)", rounds * lines.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& line : lines) {
+                std::string_view timeStamp{std::string_view{line}.substr(0, dt::consts::SYSLOG_TIMESTAMP_STRING_LENGTH)};
+                dt::bench::doNotOptimize(parser.tryParseRfc3164(timeStamp));
+            }
+        }
+    });
+    dt::bench::run("SyslogParser::tryParseRfc5424", rounds * rfc5424.size(), [&] {
+        for (std::size_t i{0}; i < rounds; ++i) {
+            for (const auto& timeStamp : rfc5424) {
+                dt::bench::doNotOptimize(dt::SyslogParser::tryParseRfc5424(timeStamp));
+            }
+        }
+    });
+    return 0;
+}
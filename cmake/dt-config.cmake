@@ -1,4 +1,5 @@
 include(CMakeFindDependencyMacro)
+find_dependency(Threads)
 
 set(DT_INCLUDE_DIRS "${CMAKE_INSTALL_PREFIX}/include/")
 set(DT_LIBRARIES "/usr/local/lib/libdt.a")
@@ -12,7 +13,7 @@ set(DT_FOUND TRUE)
 add_library(dt::dt INTERFACE IMPORTED)
 set_target_properties(dt::dt PROPERTIES
         INTERFACE_INCLUDE_DIRECTORIES "${DT_INCLUDE_DIRS}"
-        INTERFACE_LINK_LIBRARIES "${DT_LIBRARIES}"
+        INTERFACE_LINK_LIBRARIES "${DT_LIBRARIES};Threads::Threads"
 )
 
 # Notify dependent projects that this package has been found
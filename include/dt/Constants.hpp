@@ -8,7 +8,9 @@
 #ifndef DATEANDTIME_LIB_CONSTANTS_HPP
 #define DATEANDTIME_LIB_CONSTANTS_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 namespace dt {
     /**
@@ -20,8 +22,22 @@ namespace dt {
         static constexpr char DATE_SEPARATOR_DASH{'-'};
         static constexpr char DATE_SEPARATOR_SLASH{'/'};
         static constexpr char TIME_SEPARATOR{':'};
+        static constexpr char DATE_TIME_SEPARATOR{'T'};
+        static constexpr char UTC_DESIGNATOR{'Z'};
 
         static constexpr int DATE_PATTERNS{4};
+        static constexpr int DATE_STRING_LENGTH{10};
+        static constexpr int DATE_MAX_STRING_LENGTH{17}; // DD-MM- & a year of any width, e.g. -2147483648.
+        static constexpr int TIME_STAMP_STRING_LENGTH{12};
+        static constexpr int DATE_TIME_MIN_STRING_LENGTH{19};
+        static constexpr int DATE_TIME_MAX_STRING_LENGTH{35};
+        static constexpr int HTTP_DATE_STRING_LENGTH{29};
+        static constexpr int SYSLOG_TIMESTAMP_STRING_LENGTH{15};
+        static constexpr int SYSLOG_MAX_MONTHS_AHEAD{1};
+
+        static constexpr std::size_t PARALLEL_PARSE_MIN_CHUNK_SIZE{16'384};
+        static constexpr std::size_t DATE_FORMAT_SAMPLE_SIZE{1'000};
+        static constexpr std::size_t PARSE_CACHE_CAPACITY{1'024};
 
         static constexpr int MIN_YEAR{1583};
         static constexpr int MAX_YEAR{9999};
@@ -44,6 +60,11 @@ namespace dt {
         static constexpr int MILLISECOND_MIN{0};
         static constexpr int MILLISECOND_MAX{999};
         static constexpr int MILLISECOND_ADJUST{1000};
+        static constexpr int NANOSECOND_MIN{0};
+        static constexpr int NANOSECOND_MAX{999'999'999};
+        static constexpr int NANOSECONDS_PER_MILLISECOND{1'000'000};
+        static constexpr int FRACTION_MAX_DIGITS{9};
+        static constexpr int UTC_OFFSET_MAX_MINUTES{23 * 60 + 59};
 
         static constexpr const char* MONDAY{"Monday"};
         static constexpr const char* TUESDAY{"Tuesday"};
@@ -79,6 +100,60 @@ namespace dt {
             November,
             December
         };
+
+        /**
+         * @brief The days of the week, numbered from Monday like ISO 8601.
+         */
+        enum class Weekday : uint8_t {
+            Monday = 1,
+            Tuesday,
+            Wednesday,
+            Thursday,
+            Friday,
+            Saturday,
+            Sunday
+        };
+
+        // English names, index 0 is Monday & January.
+        static constexpr std::string_view WEEKDAY_NAMES[] {
+            "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"
+        };
+        static constexpr std::string_view WEEKDAY_SHORT_NAMES[] {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+        static constexpr std::string_view MONTH_LONG_NAMES[] {
+            "January", "February", "March", "April", "May", "June",
+            "July", "August", "September", "October", "November", "December"
+        };
+        static constexpr std::string_view MONTH_SHORT_NAMES[] {
+            "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+        };
+
+        /**
+         * @brief Gets the name of a day of the week, e.g. "Monday", without allocating.
+         */
+        constexpr std::string_view getName(Weekday weekday) {
+            return WEEKDAY_NAMES[static_cast<int>(weekday) - 1];
+        }
+
+        /**
+         * @brief Gets the three letter name of a day of the week, e.g. "Mon", without allocating.
+         */
+        constexpr std::string_view getShortName(Weekday weekday) {
+            return WEEKDAY_SHORT_NAMES[static_cast<int>(weekday) - 1];
+        }
+
+        /**
+         * @brief Gets the name of a month, e.g. "January", without allocating.
+         */
+        constexpr std::string_view getName(Month month) {
+            return MONTH_LONG_NAMES[static_cast<int>(month) - 1];
+        }
+
+        /**
+         * @brief Gets the three letter name of a month, e.g. "Jan", without allocating.
+         */
+        constexpr std::string_view getShortName(Month month) {
+            return MONTH_SHORT_NAMES[static_cast<int>(month) - 1];
+        }
     }
 }
 
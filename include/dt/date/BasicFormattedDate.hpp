@@ -0,0 +1,383 @@
+/**
+ * @file BasicFormattedDate.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_BASICFORMATTEDDATE_HPP
+#define DATEANDTIME_LIB_BASICFORMATTEDDATE_HPP
+
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "Date.hpp"
+#include "DateFormat.hpp"
+#include "../utils/FormatUtils.hpp"
+#include "../utils/InlineString.hpp"
+#include "../utils/ParseResult.hpp"
+#include "../utils/ParseUtils.hpp"
+
+namespace dt {
+    /**
+     * @brief @c BasicFormattedDate class.
+     *
+     * This class represents a specific date with a format that is fixed at compile time. The offsets of every
+     * component are constants & the components are held inline, so formatting is a handful of digit stores & parsing
+     * only accepts the exact layout of @p F, unlike @c FormattedDate which accepts any of the supported layouts.
+     *
+     * <b>Example:</b> @c dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD> date{"2001-12-22"};
+     * @tparam F
+     *          The date format.
+     * @namespace @c dt
+     * @see @c FormattedDate for a date with a format chosen at runtime.
+     */
+    template<DateFormat F>
+    class BasicFormattedDate {
+    public:
+        BasicFormattedDate() = default;
+        BasicFormattedDate(int d, int m, int y);
+        explicit BasicFormattedDate(const Date& date);
+        explicit BasicFormattedDate(std::string_view date);
+        ~BasicFormattedDate() = default;
+
+        static ParseResult<BasicFormattedDate> tryParse(std::string_view date) noexcept;
+        static constexpr DateFormat getFormat();
+
+        int getDay() const;
+        int getMonth() const;
+        int getYear() const;
+        Date getDate() const;
+        bool isLeapYear() const;
+        char* format(char* out) const;
+        char* toChars(char* first, char* last) const;
+        std::string toString() const;
+        InlineString<consts::DATE_MAX_STRING_LENGTH> toInlineString() const;
+
+        bool operator<(const BasicFormattedDate& other) const;
+        bool operator>(const BasicFormattedDate& other) const;
+        bool operator<=(const BasicFormattedDate& other) const;
+        bool operator>=(const BasicFormattedDate& other) const;
+        bool operator==(const BasicFormattedDate& other) const;
+        bool operator!=(const BasicFormattedDate& other) const;
+
+    private:
+        static constexpr detail::DateLayout layout{detail::getDateLayout(F)};
+
+        int day{0};
+        int month{0};
+        int year{0};
+    };
+
+    /**
+     * @brief @c BasicFormattedDate constructor.
+     * @param d
+     *          The day.
+     * @param m
+     *          The month.
+     * @param y
+     *          The year.
+     */
+    template<DateFormat F>
+    BasicFormattedDate<F>::BasicFormattedDate(int d, int m, int y)
+        : BasicFormattedDate{Date{d, m, y}} {
+    }
+
+    /**
+     * @brief @c BasicFormattedDate constructor.
+     * @param date
+     *          The date.
+     */
+    template<DateFormat F>
+    BasicFormattedDate<F>::BasicFormattedDate(const Date& date)
+        : day{date.getDay()},
+          month{date.getMonth()},
+          year{date.getYear()} {
+    }
+
+    /**
+     * @brief @c BasicFormattedDate constructor.
+     * @param date
+     *          The string representation of a date in the layout of @p F.
+     * @throws DateParseException
+     *          If the string representation of the date doesn't match the layout.
+     * @throws InvalidDateException
+     *          If the date is invalid.
+     */
+    template<DateFormat F>
+    BasicFormattedDate<F>::BasicFormattedDate(std::string_view date) {
+        ParseResult<BasicFormattedDate> result{tryParse(date)};
+        if (result) {
+            *this = *result;
+            return;
+        }
+        if (result.getError() == ParseError::InvalidDate) {
+            throw InvalidDateException("Error parsing date: '" + std::string{date} + "'. Date is invalid.");
+        }
+        throw DateParseException("Error parsing date: '" + std::string{date} + "'. Check formatting.");
+    }
+
+    /**
+     * @brief Parses a string representation of a date in the layout of @p F without throwing.
+     * @param date
+     *          The string representation of a date.
+     * @return The parsed date, or why it could not be parsed.
+     */
+    template<DateFormat F>
+    ParseResult<BasicFormattedDate<F>> BasicFormattedDate<F>::tryParse(std::string_view date) noexcept {
+        const char* str{date.data()};
+        if (date.size() == consts::DATE_STRING_LENGTH &&
+            str[layout.firstSeparatorOffset] == layout.separator &&
+            str[layout.secondSeparatorOffset] == layout.separator &&
+            detail::isDigits(str + layout.dayOffset, 2) &&
+            detail::isDigits(str + layout.monthOffset, 2) &&
+            detail::isDigits(str + layout.yearOffset, 4)) {
+            int d{detail::parseTwoDigits(str + layout.dayOffset)};
+            int m{detail::parseTwoDigits(str + layout.monthOffset)};
+            int y{detail::parseFourDigits(str + layout.yearOffset)};
+            if (detail::isValidDate(d, m, y)) {
+                BasicFormattedDate result;
+                result.day = d;
+                result.month = m;
+                result.year = y;
+                return result;
+            }
+            if (y < consts::MIN_YEAR || y > consts::MAX_YEAR) {
+                return {ParseError::InvalidDate, layout.yearOffset};
+            }
+            if (m < consts::MIN_NUMBER_OF_MONTHS || m > consts::MAX_NUMBER_OF_MONTHS) {
+                return {ParseError::InvalidDate, layout.monthOffset};
+            }
+            return {ParseError::InvalidDate, layout.dayOffset};
+        }
+
+        std::size_t mismatch{detail::findLayoutMismatch(date, layout.pattern)};
+        return {detail::getLayoutError(date, layout.pattern, mismatch), mismatch};
+    }
+
+    /**
+     * @brief Gets the date format.
+     * @return The date format.
+     */
+    template<DateFormat F>
+    constexpr DateFormat BasicFormattedDate<F>::getFormat() {
+        return F;
+    }
+
+    /**
+     * @brief Gets the day.
+     * @return The day.
+     */
+    template<DateFormat F>
+    int BasicFormattedDate<F>::getDay() const {
+        return day;
+    }
+
+    /**
+     * @brief Gets the month.
+     * @return The month.
+     */
+    template<DateFormat F>
+    int BasicFormattedDate<F>::getMonth() const {
+        return month;
+    }
+
+    /**
+     * @brief Gets the year.
+     * @return The year.
+     */
+    template<DateFormat F>
+    int BasicFormattedDate<F>::getYear() const {
+        return year;
+    }
+
+    /**
+     * @brief Gets the date as a @c Date.
+     * @return The date.
+     */
+    template<DateFormat F>
+    Date BasicFormattedDate<F>::getDate() const {
+        return {day, month, year};
+    }
+
+    /**
+     * @brief Checks if the year is a leap year.
+     * @return @c true if the year is a leap year, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::isLeapYear() const {
+        return day != 0 && detail::isLeapYear(year);
+    }
+
+    /**
+     * @brief Writes the date in the layout of @p F. Nothing is allocated & no terminating null is written.
+     *
+     * A year outside 1000-9999, e.g. 10000 after arithmetic or 0 for a default constructed date, is written without
+     * padding like @c Date writes it, so the date is then shorter or longer than @c consts::DATE_STRING_LENGTH.
+     * @param out
+     *          The buffer to write to, at least @c consts::DATE_MAX_STRING_LENGTH characters long, or
+     *          @c consts::DATE_STRING_LENGTH if the year has four digits.
+     * @return A pointer one past the last character written.
+     */
+    template<DateFormat F>
+    char* BasicFormattedDate<F>::format(char* out) const {
+        if (year >= 1'000 && year <= 9'999) {
+            detail::writeTwoDigits(out + layout.dayOffset, day);
+            detail::writeTwoDigits(out + layout.monthOffset, month);
+            detail::writeFourDigits(out + layout.yearOffset, year);
+            out[layout.firstSeparatorOffset] = layout.separator;
+            out[layout.secondSeparatorOffset] = layout.separator;
+            return out + consts::DATE_STRING_LENGTH;
+        }
+
+        // The layout is written with a placeholder year & the real year spliced in, moving what follows it.
+        char fixed[consts::DATE_STRING_LENGTH];
+        detail::writeTwoDigits(fixed + layout.dayOffset, day);
+        detail::writeTwoDigits(fixed + layout.monthOffset, month);
+        fixed[layout.firstSeparatorOffset] = layout.separator;
+        fixed[layout.secondSeparatorOffset] = layout.separator;
+        constexpr std::size_t yearEnd{layout.yearOffset + 4};
+        std::memcpy(out, fixed, layout.yearOffset);
+        char* end{std::to_chars(out + layout.yearOffset, out + consts::DATE_MAX_STRING_LENGTH, year).ptr};
+        std::memcpy(end, fixed + yearEnd, consts::DATE_STRING_LENGTH - yearEnd);
+        return end + (consts::DATE_STRING_LENGTH - yearEnd);
+    }
+
+    /**
+     * @brief Writes the date in the layout of @p F into a caller provided buffer, like @c std::to_chars. Nothing is
+     * allocated & no terminating null is written.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer. @c consts::DATE_STRING_LENGTH characters are enough for a
+     *          four digit year & @c consts::DATE_MAX_STRING_LENGTH for any year.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    template<DateFormat F>
+    char* BasicFormattedDate<F>::toChars(char* first, char* last) const {
+        if (last - first >= consts::DATE_MAX_STRING_LENGTH ||
+            (last - first >= consts::DATE_STRING_LENGTH && year >= 1'000 && year <= 9'999)) {
+            return format(first);
+        }
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        const std::ptrdiff_t length{format(buffer) - buffer};
+        if (last - first < length) {
+            return nullptr;
+        }
+        std::memcpy(first, buffer, static_cast<std::size_t>(length));
+        return first + length;
+    }
+
+    /**
+     * @brief Converts the date to a string.
+     * @return The date as a string.
+     */
+    template<DateFormat F>
+    std::string BasicFormattedDate<F>::toString() const {
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        return {buffer, format(buffer)};
+    }
+
+    /**
+     * @brief Converts the date to a string stored inline, without allocating.
+     * @return The date as an inline string.
+     */
+    template<DateFormat F>
+    InlineString<consts::DATE_MAX_STRING_LENGTH> BasicFormattedDate<F>::toInlineString() const {
+        InlineString<consts::DATE_MAX_STRING_LENGTH> string;
+        string.resize(static_cast<std::size_t>(format(string.data()) - string.data()));
+        return string;
+    }
+
+    /**
+     * @brief Compares two date objects to determine if the current date is earlier than the given date.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the current date is earlier than the given date, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator<(const BasicFormattedDate& other) const {
+        if (year != other.year) {
+            return year < other.year;
+        }
+        if (month != other.month) {
+            return month < other.month;
+        }
+        return day < other.day;
+    }
+
+    /**
+     * @brief Compares two date objects to determine if the current date is later than the given date.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the current date is later than the given date, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator>(const BasicFormattedDate& other) const {
+        return other < *this;
+    }
+
+    /**
+     * @brief Compares two date objects to determine if the current date is less than or equal to the given date.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the current date is less than or equal to the given date, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator<=(const BasicFormattedDate& other) const {
+        return !(other < *this);
+    }
+
+    /**
+     * @brief Compares two date objects to determine if the current date is greater than or equal to the given date.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the current date is greater than or equal to the given date, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator>=(const BasicFormattedDate& other) const {
+        return !(*this < other);
+    }
+
+    /**
+     * @brief Compares two date objects to determine if they are equal.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the dates are equal, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator==(const BasicFormattedDate& other) const {
+        return year == other.year && month == other.month && day == other.day;
+    }
+
+    /**
+     * @brief Compares two date objects to determine if they are not equal.
+     * @param other
+     *          The date to compare against.
+     * @return @c true if the dates are not equal, @c false otherwise.
+     */
+    template<DateFormat F>
+    bool BasicFormattedDate<F>::operator!=(const BasicFormattedDate& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Overloaded stream output operator.
+     * @param os
+     *          The output stream.
+     * @param date
+     *          The date object to output.
+     * @return The output stream.
+     */
+    template<DateFormat F>
+    std::ostream& operator<<(std::ostream& os, const BasicFormattedDate<F>& date) {
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        os.write(buffer, date.format(buffer) - buffer);
+        return os;
+    }
+}
+
+#endif //DATEANDTIME_LIB_BASICFORMATTEDDATE_HPP
@@ -8,13 +8,43 @@
 #ifndef DATEANDTIME_LIB_CALENDAR_HPP
 #define DATEANDTIME_LIB_CALENDAR_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
 #include <vector>
 
 #include "Date.hpp"
 
 namespace dt {
+    /**
+     * @brief @c CalendarStyle enum class.
+     *
+     * Whether a rendered calendar contains ANSI colour codes. <br>
+     *
+     * The available styles are:
+     * <ul>
+     *  <li>@c CalendarStyle::Plain  - Text only, e.g. for files or batch jobs.</li>
+     *  <li>@c CalendarStyle::Colour - Days in white & the current day in green, for terminals.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class CalendarStyle : uint8_t {
+        Plain,
+        Colour,
+    };
+
     /**
      * @brief @c Calendar class.
+     *
+     * A month of dates that can be rendered as a grid, alone or with the following months side by side, e.g. a
+     * quarter or a year. The first weekday is worked out once per month & the week rows are copied from a table of
+     * the 28 possible month layouts, so rendering writes straight into the caller's buffer without allocating.
+     *
+     * <b>Example:</b>
+     * @code
+     * std::vector<char> buffer(dt::Calendar::maxLength(12, 3, dt::CalendarStyle::Plain));
+     * char* end{dt::Calendar::formatYear(2023, buffer.data(), buffer.data() + buffer.size())};
+     * @endcode
      * @namespace @c dt
      */
     class Calendar {
@@ -31,6 +61,12 @@ namespace dt {
         Calendar& operator--(int);
 
         std::string toString() const;
+        char* toChars(char* first, char* last, int months = 1, int monthsPerRow = 3,
+                      CalendarStyle style = CalendarStyle::Colour) const;
+        static char* formatYear(int year, char* first, char* last, int monthsPerRow = 3,
+                                CalendarStyle style = CalendarStyle::Plain);
+        static constexpr std::size_t maxLength(int months = 1, int monthsPerRow = 3,
+                                               CalendarStyle style = CalendarStyle::Colour);
         void displayAllDates();
 
         int getCurrentDay() const;
@@ -44,13 +80,36 @@ namespace dt {
 
     private:
         void setDates();
-        std::string formatCalendar() const;
+        static char* formatMonths(int month, int year, int months, int monthsPerRow, int highlightDay,
+                                  CalendarStyle style, char* first, char* last);
 
         int currentDay{1};
         int currentMonth{1};
         int currentYear{1583};
         std::vector<Date> dates;
     };
+
+    /**
+     * @brief Gets the number of characters that is always enough to render a number of months.
+     * @param months
+     *          The number of months rendered.
+     * @param monthsPerRow
+     *          The number of months side by side.
+     * @param style
+     *          Whether the calendar is rendered with colours.
+     * @return The maximum length of the rendered calendar.
+     */
+    constexpr std::size_t Calendar::maxLength(int months, int monthsPerRow, CalendarStyle style) {
+        // A row of months has a title, a weekday header & up to 6 weeks, each month 20 wide with 2 spaces between
+        // them. Every coloured day adds a colour & a reset code.
+        const auto count{static_cast<std::size_t>(months < 1 ? 1 : months)};
+        const auto perRow{monthsPerRow < 1 ? std::size_t{1} : std::min(static_cast<std::size_t>(monthsPerRow), count)};
+        const std::size_t rows{(count + perRow - 1) / perRow};
+        const std::size_t colourLength{std::string_view{consts::COLOR_WHITE}.size() +
+                                       std::string_view{consts::COLOR_RESET}.size()};
+        return rows * (8 * (perRow * 22) + 1) +
+               (style == CalendarStyle::Colour ? count * consts::MAX_NUMBER_DAYS_IN_A_MONTH * colourLength : 0);
+    }
 }
 
 #endif //DATEANDTIME_LIB_CALENDAR_HPP
@@ -9,14 +9,18 @@
 #define DATEANDTIME_LIB_DATE_HPP
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <regex>
 #include <string_view>
 #include <sstream>
 #include <ostream>
 
 #include "../Constants.hpp"
 #include "../utils/DateTimeUtils.hpp"
+#include "../utils/ParseUtils.hpp"
+#include "../utils/ParseResult.hpp"
+#include "../utils/InlineString.hpp"
 #include "../exceptions/DateParseException.hpp"
 #include "../exceptions/InvalidDateException.hpp"
 
@@ -25,15 +29,26 @@ namespace dt {
      * @brief @c Date class.
      *
      * This class represents a specific date in the format @c DD-MM-YYYY.
+     *
+     * A date is stored as the number of days since @c 1970-01-01, which the comparisons & the arithmetic work on
+     * directly, next to its day, month & year so that the getters & formatting need no conversion. It is 8 bytes, so
+     * the year is 16 bits & arithmetic that would move the year outside the range of @c std::int16_t throws.
      * @namespace @c dt
      */
     class Date {
     public:
         Date() = default;
         Date(int d, int m, int y);
-        Date(const std::string& date);
+        Date(std::string_view date);
         ~Date() = default;
 
+        static ParseResult<Date> tryParse(std::string_view date) noexcept;
+        static ParseResult<Date> tryParseText(std::string_view date) noexcept;
+        static ParseResult<Date> fromYmdInt(std::int32_t ymd) noexcept;
+        static std::size_t fromYmdInts(const std::int32_t* ymd, std::size_t count, Date* out,
+                                       std::uint64_t* validMask);
+        static void toYmdInts(const Date* dates, std::size_t count, std::int32_t* out);
+
         void addDays(int days);
         void addMonths(int months);
         void addYears(int years);
@@ -43,8 +58,13 @@ namespace dt {
         int getMonth() const;
         int getYear() const;
         std::string getDayOfWeek() const;
+        consts::Weekday weekday() const;
         bool isLeapYear() const;
         std::string toString() const;
+        char* toChars(char* first, char* last) const;
+        InlineString<consts::DATE_MAX_STRING_LENGTH> toInlineString() const;
+        std::int32_t toYmdInt() const;
+        std::int32_t toDays() const;
 
         bool operator<(const Date& other) const;
         bool operator>(const Date& other) const;
@@ -53,20 +73,28 @@ namespace dt {
         bool operator==(const Date& other) const;
         bool operator!=(const Date& other) const;
         friend std::ostream& operator<<(std::ostream& os, const Date& date);
+        friend class DateBatchParser;
+        friend class DateBatchFormatter;
+        friend class DateTime;
+        friend class DateTimeUtils;
+        friend class HttpDate;
+        friend class SyslogParser;
+        friend class EpochParser;
+        friend class DateTimePattern;
 
     private:
         bool isValidDate(int d, int m, int y);
-        void adjustDate();
-        std::string addLeadingZerosToDateComponent(int component) const;
-        void parse(const std::string& date);
-        void convertStrToDate(std::string_view pattern, const std::string& date);
-        std::string getDayOfWeek(int d) const;
+        void assignDate(int d, int m, int y);
+        void assignDays(std::int32_t days);
+        void parse(std::string_view date);
+
+        // The days since 1970-01-01 of a default constructed date, earlier than every valid date.
+        static constexpr std::int32_t NO_DATE{INT32_MIN};
 
-        int day{0};
-        int month{0};
-        int year{0};
-        bool leapYear{false};
-        static const std::array<std::string, consts::DATE_PATTERNS> datePatterns;
+        std::int32_t serial{NO_DATE};
+        std::int16_t year{0};
+        std::uint8_t month{0};
+        std::uint8_t day{0};
     };
 }
 
@@ -0,0 +1,92 @@
+/**
+ * @file DateFormat.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 02/08/2023
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_DATEFORMAT_HPP
+#define DATEANDTIME_LIB_DATEFORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../Constants.hpp"
+
+namespace dt {
+    /**
+     * @brief @c DateFormat enum class.
+     *
+     * This enum class is used to define the various formats a date can be represented in. <br>
+     *
+     * The available formats are:
+     * <ul>
+     *  <li>@c DateFormat::DD_MM_YYYY   - Represents the date format as "DD-MM-YYYY" (e.g., 22-12-2001)</li>
+     *  <li>@c DateFormat::MM_DD_YYYY   - Represents the date format as "MM-DD-YYYY" (e.g., 12-22-2001)</li>
+     *  <li>@c DateFormat::YYYY_MM_DD   - Represents the date format as "YYYY-MM-DD" (e.g., 2001-12-22)</li>
+     *  <li>@c DateFormat::YYYY_DD_MM   - Represents the date format as "YYYY-DD-MM" (e.g., 2001-22-12)</li>
+     *  <li>@c DateFormat::DD__MM__YYYY - Represents the date format as "DD/MM/YYYY" (e.g., 22/12/2001)</li>
+     *  <li>@c DateFormat::MM__DD__YYYY - Represents the date format as "MM/DD/YYYY" (e.g., 12/22/2001)</li>
+     *  <li>@c DateFormat::YYYY__MM__DD - Represents the date format as "YYYY/MM/DD" (e.g., 2001/12/22)</li>
+     *  <li>@c DateFormat::YYYY__DD__MM-  Represents the date format as "YYYY/DD/MM" (e.g., 2001/22/12)</li>
+     * @namespace @c dt
+     */
+    enum class DateFormat : uint8_t {
+        DD_MM_YYYY,     // 22-12-2001
+        MM_DD_YYYY,     // 12-22-2001
+        YYYY_MM_DD,     // 2001-12-22
+        YYYY_DD_MM,     // 2001-22-12
+        DD__MM__YYYY,   // 22/12/2001
+        MM__DD__YYYY,   // 12/22/2001
+        YYYY__MM__DD,   // 2001/12/22
+        YYYY__DD__MM,   // 2001/22/12
+    };
+
+    namespace detail {
+        /**
+         * @brief Where each component of a @c DateFormat lives in its fixed width string representation.
+         */
+        struct DateLayout {
+            std::size_t dayOffset;
+            std::size_t monthOffset;
+            std::size_t yearOffset;
+            std::size_t firstSeparatorOffset;
+            std::size_t secondSeparatorOffset;
+            char separator;
+            std::string_view pattern; // For findLayoutMismatch, 'D' is a digit.
+        };
+
+        /**
+         * @brief Gets the layout of a date format.
+         * @param format
+         *          The date format.
+         * @return The layout.
+         */
+        constexpr DateLayout getDateLayout(DateFormat format) {
+            constexpr char dash{consts::DATE_SEPARATOR_DASH};
+            constexpr char slash{consts::DATE_SEPARATOR_SLASH};
+            switch (format) {
+                case DateFormat::DD_MM_YYYY:
+                    return {0, 3, 6, 2, 5, dash, "DD-DD-DDDD"};
+                case DateFormat::MM_DD_YYYY:
+                    return {3, 0, 6, 2, 5, dash, "DD-DD-DDDD"};
+                case DateFormat::YYYY_MM_DD:
+                    return {8, 5, 0, 4, 7, dash, "DDDD-DD-DD"};
+                case DateFormat::YYYY_DD_MM:
+                    return {5, 8, 0, 4, 7, dash, "DDDD-DD-DD"};
+                case DateFormat::DD__MM__YYYY:
+                    return {0, 3, 6, 2, 5, slash, "DD/DD/DDDD"};
+                case DateFormat::MM__DD__YYYY:
+                    return {3, 0, 6, 2, 5, slash, "DD/DD/DDDD"};
+                case DateFormat::YYYY__MM__DD:
+                    return {8, 5, 0, 4, 7, slash, "DDDD/DD/DD"};
+                case DateFormat::YYYY__DD__MM:
+                    return {5, 8, 0, 4, 7, slash, "DDDD/DD/DD"};
+            }
+            return {0, 3, 6, 2, 5, dash, "DD-DD-DDDD"};
+        }
+    }
+}
+
+#endif //DATEANDTIME_LIB_DATEFORMAT_HPP
@@ -9,48 +9,24 @@
 #define DATEANDTIME_LIB_FORMATTEDDATE_HPP
 
 #include "Date.hpp"
+#include "DateFormat.hpp"
+#include "BasicFormattedDate.hpp"
 
 namespace dt {
-    /**
-     * @brief @c DateFormat enum class.
-     *
-     * This enum class is used to define the various formats a date can be represented in. <br>
-     *
-     * The available formats are:
-     * <ul>
-     *  <li>@c DateFormat::DD_MM_YYYY   - Represents the date format as "DD-MM-YYYY" (e.g., 22-12-2001)</li>
-     *  <li>@c DateFormat::MM_DD_YYYY   - Represents the date format as "MM-DD-YYYY" (e.g., 12-22-2001)</li>
-     *  <li>@c DateFormat::YYYY_MM_DD   - Represents the date format as "YYYY-MM-DD" (e.g., 2001-12-22)</li>
-     *  <li>@c DateFormat::YYYY_DD_MM   - Represents the date format as "YYYY-DD-MM" (e.g., 2001-22-12)</li>
-     *  <li>@c DateFormat::DD__MM__YYYY - Represents the date format as "DD/MM/YYYY" (e.g., 22/12/2001)</li>
-     *  <li>@c DateFormat::MM__DD__YYYY - Represents the date format as "MM/DD/YYYY" (e.g., 12/22/2001)</li>
-     *  <li>@c DateFormat::YYYY__MM__DD - Represents the date format as "YYYY/MM/DD" (e.g., 2001/12/22)</li>
-     *  <li>@c DateFormat::YYYY__DD__MM-  Represents the date format as "YYYY/DD/MM" (e.g., 2001/22/12)</li>
-     * @namespace @c dt
-     */
-    enum class DateFormat : u_int8_t {
-        DD_MM_YYYY,     // 22-12-2001
-        MM_DD_YYYY,     // 12-22-2001
-        YYYY_MM_DD,     // 2001-12-22
-        YYYY_DD_MM,     // 2001-22-12
-        DD__MM__YYYY,   // 22/12/2001
-        MM__DD__YYYY,   // 12/22/2001
-        YYYY__MM__DD,   // 2001/12/22
-        YYYY__DD__MM,   // 2001/22/12
-    };
-
     /**
      * @brief @c FormattedDate class.
      *
-     * This class represents a specific date with a specified format.
+     * This class represents a specific date with a specified format. The format is chosen at runtime & dispatches to
+     * the matching @c BasicFormattedDate.
      * @namespace @c dt
      * @see @c DateFormat for the available date formats.
+     * @see @c BasicFormattedDate for a date with a format fixed at compile time.
      */
     class FormattedDate {
     public:
         FormattedDate() = default;
         FormattedDate(int d, int m, int y, DateFormat format);
-        FormattedDate(const std::string& date, DateFormat format);
+        FormattedDate(std::string_view date, DateFormat format);
         FormattedDate(const Date& date, DateFormat format);
         ~FormattedDate() = default;
 
@@ -64,8 +40,13 @@ namespace dt {
         int getYear() const;
         Date getDate() const;
         std::string getDayOfWeek();
+        consts::Weekday weekday() const;
         bool isLeapYear() const;
+        DateFormat getFormat() const;
+        char* format(char* out) const;
+        char* toChars(char* first, char* last) const;
         std::string toString() const;
+        InlineString<consts::DATE_MAX_STRING_LENGTH> toInlineString() const;
 
         bool operator<(const FormattedDate& other) const;
         bool operator>(const FormattedDate& other) const;
@@ -76,10 +57,8 @@ namespace dt {
         friend std::ostream& operator<<(std::ostream& os, const FormattedDate& date);
 
     private:
-        std::string addLeadingZerosToDateComponent(int component) const;
-
         Date date;
-        DateFormat format{DateFormat::DD_MM_YYYY};
+        DateFormat dateFormat{DateFormat::DD_MM_YYYY};
     };
 }
 
@@ -0,0 +1,48 @@
+/**
+ * @file CurrentTime.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_CURRENTTIME_HPP
+#define DATEANDTIME_LIB_CURRENTTIME_HPP
+
+#include <chrono>
+
+#include "../Constants.hpp"
+#include "TimeStamp.hpp"
+#include "../utils/InlineString.hpp"
+
+namespace dt {
+    /**
+     * @brief @c CurrentTime class.
+     *
+     * Formats the current local time as @c HH:MM:SS:mmm, the layout of @c TimeStamp, for loggers that stamp every
+     * line. The @c HH:MM:SS of the last second formatted is cached, so a call within the same second only reads the
+     * clock, copies the cached 8 characters & writes the 3 millisecond digits.
+     *
+     * The cache is shared by all threads & guarded by a sequence lock: readers never block or write, and a thread
+     * that misses the cache, or finds another thread updating it, converts the second itself with
+     * @c localtime_r, @c localtime_s on Windows. A change of time zone shows from the next second on.
+     *
+     * <b>Example:</b>
+     * @code
+     * char prefix[dt::consts::TIME_STAMP_STRING_LENGTH];
+     * std::string_view value{prefix, static_cast<std::size_t>(dt::CurrentTime::formatNow(prefix) - prefix)};
+     * @endcode
+     * @namespace @c dt
+     */
+    class CurrentTime {
+    public:
+        CurrentTime() = default;
+        ~CurrentTime() = default;
+
+        static char* format(std::chrono::system_clock::time_point time, char* out);
+        static char* formatNow(char* out);
+        static InlineString<consts::TIME_STAMP_STRING_LENGTH> toInlineString();
+        static TimeStamp getTimeStamp();
+    };
+}
+
+#endif //DATEANDTIME_LIB_CURRENTTIME_HPP
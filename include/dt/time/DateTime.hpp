@@ -0,0 +1,128 @@
+/**
+ * @file DateTime.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_DATETIME_HPP
+#define DATEANDTIME_LIB_DATETIME_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "TimeStamp.hpp"
+#include "../utils/FormatUtils.hpp"
+#include "../utils/InlineString.hpp"
+#include "../utils/ParseResult.hpp"
+#include "../utils/ParseUtils.hpp"
+
+namespace dt {
+    /**
+     * @brief @c FractionPrecision enum class.
+     *
+     * The number of fractional second digits written by @c DateTime::toChars. The fixed precisions truncate, they
+     * never round. <br>
+     *
+     * The available precisions are:
+     * <ul>
+     *  <li>@c FractionPrecision::Auto         - 3, 6 or 9 digits, whichever is exact, none when it is zero.</li>
+     *  <li>@c FractionPrecision::Seconds      - No fraction, e.g. @c 18:46:37.</li>
+     *  <li>@c FractionPrecision::Milliseconds - 3 digits, e.g. @c 18:46:37.120.</li>
+     *  <li>@c FractionPrecision::Microseconds - 6 digits, e.g. @c 18:46:37.120000.</li>
+     *  <li>@c FractionPrecision::Nanoseconds  - 9 digits, e.g. @c 18:46:37.120000000.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class FractionPrecision : uint8_t {
+        Auto,
+        Seconds,
+        Milliseconds,
+        Microseconds,
+        Nanoseconds,
+    };
+
+    /**
+     * @brief @c UtcStyle enum class.
+     *
+     * How @c DateTime::toChars writes a zero UTC offset. <br>
+     *
+     * The available styles are:
+     * <ul>
+     *  <li>@c UtcStyle::Designator - @c Z, e.g. @c 2023-07-09T18:46:37Z.</li>
+     *  <li>@c UtcStyle::Numeric    - @c +00:00, e.g. @c 2023-07-09T18:46:37+00:00.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class UtcStyle : uint8_t {
+        Designator,
+        Numeric,
+    };
+
+    /**
+     * @brief @c DateTime class.
+     *
+     * This class represents a date & a time of day with up to nanosecond precision & an optional UTC offset, e.g.
+     * @c 2023-07-09T18:46:37.123456789+01:00.
+     * @namespace @c dt
+     */
+    class DateTime {
+    public:
+        DateTime() = default;
+        DateTime(const Date& date, int h, int m, int s, int nano);
+        DateTime(const Date& date, int h, int m, int s, int nano, int offsetMinutes);
+        DateTime(const Date& date, const TimeStamp& timeStamp);
+        DateTime(std::string_view dateTime);
+        ~DateTime() = default;
+
+        static ParseResult<DateTime> tryParse(std::string_view dateTime) noexcept;
+
+        Date getDate() const;
+        TimeStamp getTimeStamp() const;
+        int getYear() const;
+        int getMonth() const;
+        int getDay() const;
+        int getHour() const;
+        int getMinute() const;
+        int getSecond() const;
+        int getMillisecond() const;
+        int getNanosecond() const;
+        bool hasUtcOffset() const;
+        int getUtcOffsetMinutes() const;
+        char* toChars(char* first, char* last, FractionPrecision precision = FractionPrecision::Auto,
+                      UtcStyle utcStyle = UtcStyle::Designator) const;
+        InlineString<consts::DATE_TIME_MAX_STRING_LENGTH>
+        toInlineString(FractionPrecision precision = FractionPrecision::Auto,
+                       UtcStyle utcStyle = UtcStyle::Designator) const;
+        std::string toString(FractionPrecision precision = FractionPrecision::Auto,
+                             UtcStyle utcStyle = UtcStyle::Designator) const;
+
+        bool operator==(const DateTime& other) const;
+        bool operator!=(const DateTime& other) const;
+        friend std::ostream& operator<<(std::ostream& os, const DateTime& dateTime);
+        friend class HttpDate;
+        friend class SyslogParser;
+        friend class EpochParser;
+        friend class DateTimePattern;
+
+    private:
+        DateTime(const Date& date, int h, int m, int s, int nano, int offsetMinutes, bool hasOffset);
+
+        static bool isValidTime(int h, int m, int s, int nano);
+        static bool isValidOffset(int offsetMinutes);
+
+        Date date;
+        int hour{0};
+        int minute{0};
+        int second{0};
+        int nanosecond{0};
+        int utcOffsetMinutes{0};
+        bool utcOffset{false};
+    };
+}
+
+#endif //DATEANDTIME_LIB_DATETIME_HPP
@@ -0,0 +1,112 @@
+/**
+ * @file DateTimePattern.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_DATETIMEPATTERN_HPP
+#define DATEANDTIME_LIB_DATETIMEPATTERN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../date/Date.hpp"
+#include "DateTime.hpp"
+#include "../utils/ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief @c PatternField enum class.
+     *
+     * One instruction of a compiled @c DateTimePattern: a run of literal characters or one field.
+     * @namespace @c dt
+     */
+    enum class PatternField : uint8_t {
+        Literal,
+        Year,             // %Y 2001
+        Month,            // %m 12
+        Day,              // %d 22
+        Hour,             // %H 18
+        Minute,           // %M 46
+        Second,           // %S 37
+        Millisecond,      // %L 123
+        Microsecond,      // %f 123456
+        Nanosecond,       // %N 123456789
+        MonthShortName,   // %b Dec
+        MonthName,        // %B December
+        WeekdayShortName, // %a Sat
+        WeekdayName,      // %A Saturday
+        UtcOffset,        // %z +0100
+    };
+
+    /**
+     * @brief @c DateTimePattern class.
+     *
+     * A strftime-like pattern, e.g. @c %Y%m%d or @c %d @c %b @c %Y @c %H:%M:%S.%f, compiled once into a short
+     * program of literal runs & field instructions. Formatting & parsing then run the program, so the pattern is
+     * never looked at again & nothing is allocated per value.
+     *
+     * The supported fields are:
+     * <ul>
+     *  <li>@c %Y - The year, 4 digits. A year outside 0-9999 is written with as many digits as it needs & its sign.
+     *  </li>
+     *  <li>@c %m, @c %d - The month & the day, 2 digits.</li>
+     *  <li>@c %H, @c %M, @c %S - The hour, minute & second, 2 digits.</li>
+     *  <li>@c %L, @c %f, @c %N - The fraction of the second as milliseconds, microseconds & nanoseconds, 3, 6 & 9
+     *  digits.</li>
+     *  <li>@c %b, @c %B - The English month name, abbreviated or in full. Parsing accepts either, in any case.</li>
+     *  <li>@c %a, @c %A - The English weekday name, abbreviated or in full. Parsing checks it is a weekday name but not
+     *  that it matches the date.</li>
+     *  <li>@c %z - The UTC offset as @c +hhmm, left out if the date time has none. Parsing also accepts @c +hh:mm &
+     *  @c Z.</li>
+     *  <li>@c %F, @c %T - Short for @c %Y-%m-%d & @c %H:%M:%S.</li>
+     *  <li>@c %% - A literal '%'.</li>
+     * </ul>
+     * Every other character is a literal that must match exactly when parsing. Fields missing from a parsed string
+     * default to @c 1970-01-01T00:00:00.
+     *
+     * <b>Example:</b>
+     * @code
+     * static const dt::DateTimePattern pattern{"%d %b %Y %H:%M:%S.%f"};
+     * char buffer[64];
+     * char* end{pattern.format(dateTime, buffer, buffer + sizeof(buffer))};
+     * dt::ParseResult<dt::DateTime> parsed{pattern.tryParse("22 Dec 2001 18:46:37.123456")};
+     * @endcode
+     * @namespace @c dt
+     */
+    class DateTimePattern {
+    public:
+        explicit DateTimePattern(std::string_view pattern);
+        ~DateTimePattern() = default;
+
+        char* format(const DateTime& dateTime, char* first, char* last) const;
+        char* format(const Date& date, char* first, char* last) const;
+        std::string toString(const DateTime& dateTime) const;
+        std::string toString(const Date& date) const;
+        ParseResult<DateTime> tryParse(std::string_view dateTime) const noexcept;
+
+        std::string_view getPattern() const;
+        std::size_t getMaxLength() const;
+
+    private:
+        struct Instruction {
+            PatternField field{PatternField::Literal};
+            std::uint16_t literalOffset{0}; // Into literals, for PatternField::Literal.
+            std::uint16_t literalLength{0};
+        };
+
+        void addField(PatternField field);
+        void addLiteral(char c);
+
+        std::string pattern;
+        std::string literals;
+        std::vector<Instruction> program;
+        std::size_t maxLength{0};
+    };
+}
+
+#endif //DATEANDTIME_LIB_DATETIMEPATTERN_HPP
@@ -0,0 +1,55 @@
+/**
+ * @file HttpDate.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_HTTPDATE_HPP
+#define DATEANDTIME_LIB_HTTPDATE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "DateTime.hpp"
+#include "../utils/ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief @c HttpDate class.
+     *
+     * Formats & parses the HTTP-date of RFC 7231 section 7.1.1.1, used by the @c Date, @c Last-Modified &
+     * @c If-Modified-Since headers, e.g. @c Sun, @c 09 @c Jul @c 2023 @c 18:46:37 @c GMT.
+     *
+     * Formatting writes into a caller provided buffer of @c consts::HTTP_DATE_STRING_LENGTH characters. Servers
+     * format the same second over & over, so the last second formatted from a time point is cached & can be read
+     * from any number of threads at once without locking.
+     *
+     * <b>Example:</b>
+     * @code
+     * char header[dt::consts::HTTP_DATE_STRING_LENGTH];
+     * std::string_view value{header, static_cast<std::size_t>(dt::HttpDate::formatNow(header) - header)};
+     * @endcode
+     * @namespace @c dt
+     */
+    class HttpDate {
+    public:
+        HttpDate() = default;
+        ~HttpDate() = default;
+
+        static char* format(const DateTime& dateTime, char* out);
+        static char* format(std::chrono::system_clock::time_point time, char* out);
+        static char* formatNow(char* out);
+        static std::string toString(const DateTime& dateTime);
+
+        static ParseResult<DateTime> tryParse(std::string_view httpDate) noexcept;
+
+    private:
+        static char* formatSeconds(std::int64_t seconds, char* out);
+    };
+}
+
+#endif //DATEANDTIME_LIB_HTTPDATE_HPP
@@ -8,13 +8,17 @@
 #ifndef DATEANDTIME_LIB_TIMESTAMP_HPP
 #define DATEANDTIME_LIB_TIMESTAMP_HPP
 
+#include <cstddef>
 #include <cstdint>
-#include <regex>
 #include <sstream>
+#include <string_view>
 #include <ostream>
 
 #include "../Constants.hpp"
 #include "../utils/DateTimeUtils.hpp"
+#include "../utils/ParseUtils.hpp"
+#include "../utils/ParseResult.hpp"
+#include "../utils/InlineString.hpp"
 #include "../exceptions/InvalidTimeException.hpp"
 #include "../exceptions/TimeParseException.hpp"
 
@@ -29,9 +33,15 @@ namespace dt {
     public:
         TimeStamp() = default;
         TimeStamp(int h, int m, int s, int milli);
-        TimeStamp(const std::string& timeStamp);
+        TimeStamp(std::string_view timeStamp);
         ~TimeStamp() = default;
 
+        static ParseResult<TimeStamp> tryParse(std::string_view timeStamp) noexcept;
+        static ParseResult<TimeStamp> fromHmsmInt(std::int32_t hmsm) noexcept;
+        static std::size_t fromHmsmInts(const std::int32_t* hmsm, std::size_t count, TimeStamp* out,
+                                        std::uint64_t* validMask);
+        static void toHmsmInts(const TimeStamp* timeStamps, std::size_t count, std::int32_t* out);
+
         void addHours(int hours);
         void addMinutes(int minutes);
         void addSeconds(int seconds);
@@ -44,6 +54,9 @@ namespace dt {
         int getSecond() const;
         int getMillisecond() const;
         std::string toString() const;
+        char* toChars(char* first, char* last) const;
+        InlineString<consts::TIME_STAMP_STRING_LENGTH> toInlineString() const;
+        std::int32_t toHmsmInt() const;
 
         bool operator<(const TimeStamp& other) const;
         bool operator>(const TimeStamp& other) const;
@@ -52,6 +65,7 @@ namespace dt {
         bool operator==(const TimeStamp& other) const;
         bool operator!=(const TimeStamp& other) const;
         friend std::ostream& operator<<(std::ostream& os, const TimeStamp& timeStamp);
+        friend class TimeStampParseCache;
 
     private:
         bool isValidTime(int h, int m, int s, int milli);
@@ -59,11 +73,7 @@ namespace dt {
         void adjustMinute();
         void adjustSecond();
         void adjustMillisecond();
-        void parse(const std::string& timeStamp);
-        void convertStrToTimeStamp(const std::string& timeStamp);
-
-        std::string formatTimeStampComponent(int component) const;
-        std::string formatMillisecondComponent(int millisecondComponent) const;
+        void parse(std::string_view timeStamp);
 
         int hour{0};
         int minute{0};
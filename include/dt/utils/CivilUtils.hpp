@@ -0,0 +1,108 @@
+/**
+ * @file CivilUtils.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_CIVILUTILS_HPP
+#define DATEANDTIME_LIB_CIVILUTILS_HPP
+
+#include <cstdint>
+
+#include "../Constants.hpp"
+
+namespace dt {
+    /**
+     * @brief Closed form conversions between civil (proleptic Gregorian) dates & a count of days since
+     * @c 1970-01-01, after Howard Hinnant's @c days_from_civil & @c civil_from_days. No loops, no tables & no
+     * branches that depend on the date, so they are cheap enough to call per row.
+     * @namespace @c dt::detail
+     */
+    namespace detail {
+        static constexpr std::int64_t SECONDS_PER_DAY{86'400};
+        static constexpr int DAYS_PER_WEEK{7};
+
+        /**
+         * @brief Converts a civil date to the number of days since @c 1970-01-01.
+         * @param year
+         *          The year.
+         * @param month
+         *          The month, 1-12.
+         * @param day
+         *          The day, 1-31.
+         * @return The number of days since @c 1970-01-01, negative before it.
+         */
+        constexpr int daysFromCivil(int year, int month, int day) {
+            year -= month <= 2;
+            const int era{(year >= 0 ? year : year - 399) / 400};
+            const auto yearOfEra{static_cast<unsigned>(year - era * 400)};
+            const auto dayOfYear{static_cast<unsigned>((153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1)};
+            const unsigned dayOfEra{yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear};
+            return era * 146'097 + static_cast<int>(dayOfEra) - 719'468;
+        }
+
+        /**
+         * @brief Converts a number of days since @c 1970-01-01 to a civil date.
+         * @param days
+         *          The number of days since @c 1970-01-01, negative before it.
+         * @param year
+         *          Set to the year.
+         * @param month
+         *          Set to the month, 1-12.
+         * @param day
+         *          Set to the day, 1-31.
+         */
+        constexpr void civilFromDays(int days, int& year, int& month, int& day) {
+            days += 719'468;
+            const int era{(days >= 0 ? days : days - 146'096) / 146'097};
+            const auto dayOfEra{static_cast<unsigned>(days - era * 146'097)};
+            const unsigned yearOfEra{(dayOfEra - dayOfEra / 1'460 + dayOfEra / 36'524 - dayOfEra / 146'096) / 365};
+            const unsigned dayOfYear{dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100)};
+            const unsigned shiftedMonth{(5 * dayOfYear + 2) / 153};
+            day = static_cast<int>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+            month = static_cast<int>(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+            year = static_cast<int>(yearOfEra) + era * 400 + (month <= 2);
+        }
+
+        /**
+         * @brief Gets the day of the week of a number of days since @c 1970-01-01, which was a Thursday.
+         * @param days
+         *          The number of days since @c 1970-01-01.
+         * @return The day of the week, 0 for Sunday to 6 for Saturday.
+         */
+        constexpr int weekdayFromDays(int days) {
+            return days >= -4 ? (days + 4) % DAYS_PER_WEEK : (days + 5) % DAYS_PER_WEEK + 6;
+        }
+
+        /**
+         * @brief Gets the day of the week of a number of days since @c 1970-01-01, numbered from Monday.
+         * @param days
+         *          The number of days since @c 1970-01-01.
+         * @return The day of the week.
+         */
+        constexpr consts::Weekday isoWeekdayFromDays(int days) {
+            const int weekday{weekdayFromDays(days)};
+            return static_cast<consts::Weekday>(weekday == 0 ? DAYS_PER_WEEK : weekday);
+        }
+
+        /**
+         * @brief Divides rounding towards negative infinity, e.g. to split seconds since the epoch into days.
+         * @param value
+         *          The dividend.
+         * @param divisor
+         *          The divisor, positive.
+         * @return The quotient.
+         */
+        constexpr std::int64_t floorDivide(std::int64_t value, std::int64_t divisor) {
+            return value / divisor - (value % divisor < 0);
+        }
+
+        static_assert(daysFromCivil(1970, 1, 1) == 0);
+        static_assert(daysFromCivil(2000, 3, 1) == 11'017);
+        static_assert(weekdayFromDays(daysFromCivil(2023, 7, 9)) == 0);
+        static_assert(isoWeekdayFromDays(daysFromCivil(2023, 7, 9)) == consts::Weekday::Sunday);
+    }
+}
+
+#endif //DATEANDTIME_LIB_CIVILUTILS_HPP
@@ -0,0 +1,102 @@
+/**
+ * @file CsvDateColumn.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_CSVDATECOLUMN_HPP
+#define DATEANDTIME_LIB_CSVDATECOLUMN_HPP
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "CsvDateColumn.hpp memory maps files & is only available on POSIX systems."
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "../date/DateFormat.hpp"
+#include "DateBatchParser.hpp"
+
+namespace dt {
+    /**
+     * @brief @c CsvDateColumnReader class.
+     *
+     * Reads one date column of a CSV file without copying it into strings. The file is memory mapped & the fields of
+     * the column are handed to @c DateBatchParser straight out of the mapping, 64 rows at a time, so nothing is
+     * allocated per row. Pages that have been read are released as the reader moves on, so a 10 GB file is read with
+     * a bounded resident set as long as the caller consumes it in chunks with @c read.
+     *
+     * Fields may be quoted, a quoted field can hold delimiters, newlines & doubled quotes. Lines may end in @c \\n or
+     * @c \\r\\n. A row without the column, or with a field that is not a date, is marked invalid in the validity
+     * bitmask, which has the layout of the @c DateBatchParser one.
+     *
+     * Only available on POSIX systems, the library only builds it there. Opening or mapping the file throws
+     * @c std::system_error.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::CsvDateColumnReader reader{"trades.csv", 2};
+     * dt::Date dates[4'096];
+     * std::uint64_t valid[dt::DateBatchParser::validMaskSize(4'096)];
+     * while (std::size_t rows{reader.read(dates, valid, 4'096)}) { ... }
+     * @endcode
+     * @namespace @c dt
+     */
+    class CsvDateColumnReader {
+    public:
+        CsvDateColumnReader(const std::string& path, std::size_t column, char delimiter = ',', bool hasHeader = true);
+        CsvDateColumnReader(const CsvDateColumnReader&) = delete;
+        CsvDateColumnReader& operator=(const CsvDateColumnReader&) = delete;
+        ~CsvDateColumnReader();
+
+        std::size_t read(Date* out, std::uint64_t* validMask, std::size_t capacity,
+                         BatchBackend backend = BatchBackend::Auto);
+        std::size_t readAll(std::vector<Date>& out, std::vector<std::uint64_t>& validMask,
+                            BatchBackend backend = BatchBackend::Auto);
+        bool isAtEnd() const;
+        std::uint64_t getRowsRead() const;
+        std::size_t getFileSize() const;
+
+    private:
+        std::string_view nextField();
+        std::size_t skipRow(std::size_t i) const;
+        std::size_t skipQuoted(std::size_t i) const;
+        void release();
+
+        const char* data{nullptr};
+        std::size_t size{0};
+        std::size_t position{0};
+        std::size_t released{0};
+        std::size_t column;
+        char delimiter;
+        std::uint64_t rowsRead{0};
+    };
+
+    /**
+     * @brief @c CsvDateColumnWriter class.
+     *
+     * Formats an array of dates as a CSV column, one date per line in a @c DateFormat layout. Dates marked invalid in
+     * a validity bitmask are written as empty fields, so a column read with @c CsvDateColumnReader can be written back
+     * row for row.
+     * @namespace @c dt
+     */
+    class CsvDateColumnWriter {
+    public:
+        CsvDateColumnWriter() = default;
+        ~CsvDateColumnWriter() = default;
+
+        static std::size_t bufferSize(std::size_t count);
+        static std::size_t write(const Date* dates, std::size_t count, DateFormat format, char* out,
+                                 const std::uint64_t* validMask = nullptr);
+        static void writeFile(const std::string& path, std::string_view header, const Date* dates, std::size_t count,
+                              DateFormat format, const std::uint64_t* validMask = nullptr);
+    };
+}
+
+#endif //DATEANDTIME_LIB_CSVDATECOLUMN_HPP
@@ -0,0 +1,56 @@
+/**
+ * @file DateBatchFormatter.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_DATEBATCHFORMATTER_HPP
+#define DATEANDTIME_LIB_DATEBATCHFORMATTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "../date/DateFormat.hpp"
+#include "DateBatchParser.hpp"
+
+namespace dt {
+    /**
+     * @brief @c DateBatchFormatter class.
+     *
+     * Formats many dates in one call into one contiguous buffer, in any @c DateFormat layout, e.g. to export a date
+     * column. Every date is exactly @c consts::DATE_STRING_LENGTH characters, the same as @c BasicFormattedDate::format
+     * for a four digit year, so a year below 1000, e.g. 0 of a default constructed date, is zero padded. A batch
+     * with a year outside 0-9999 is not formatted & the call reports the error, use @c BasicFormattedDate for it.
+     *
+     * The scalar backend writes each component with the two digit lookup table. The AVX2 backend converts the
+     * components of 8 dates to digits at once & places the digits & separators of each date with a single byte
+     * shuffle. The SSSE3 backend is not implemented for formatting & runs the scalar code.
+     *
+     * <b>Example:</b>
+     * @code
+     * std::vector<char> column(dates.size() * (dt::consts::DATE_STRING_LENGTH + 1));
+     * std::size_t length{dt::DateBatchFormatter::formatDelimited(dates.data(), dates.size(),
+     *                                                            dt::DateFormat::YYYY_MM_DD, column.data(), '\n')};
+     * @endcode
+     * @namespace @c dt
+     */
+    class DateBatchFormatter {
+    public:
+        DateBatchFormatter() = default;
+        ~DateBatchFormatter() = default;
+
+        static bool formatFixed(const Date* dates, std::size_t count, DateFormat format, char* out, std::size_t stride,
+                                BatchBackend backend = BatchBackend::Auto);
+        static std::size_t formatDelimited(const Date* dates, std::size_t count, DateFormat format, char* out,
+                                           char delimiter, BatchBackend backend = BatchBackend::Auto);
+
+    private:
+        static void loadComponents(const Date* dates, std::size_t size, BatchBackend backend, std::int32_t* days,
+                                   std::int32_t* months, std::int32_t* years);
+    };
+}
+
+#endif //DATEANDTIME_LIB_DATEBATCHFORMATTER_HPP
@@ -0,0 +1,80 @@
+/**
+ * @file DateBatchParser.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_DATEBATCHPARSER_HPP
+#define DATEANDTIME_LIB_DATEBATCHPARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../date/Date.hpp"
+
+namespace dt {
+    /**
+     * @brief @c BatchBackend enum class.
+     *
+     * The instruction set used to decode a batch of dates. <br>
+     *
+     * The available backends are:
+     * <ul>
+     *  <li>@c BatchBackend::Auto   - Picks the fastest backend supported by the CPU at runtime.</li>
+     *  <li>@c BatchBackend::Scalar - Portable fallback, one date at a time.</li>
+     *  <li>@c BatchBackend::SSSE3  - One date per 128-bit register.</li>
+     *  <li>@c BatchBackend::AVX2   - Two dates per 256-bit register.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class BatchBackend : uint8_t {
+        Auto,
+        Scalar,
+        SSSE3,
+        AVX2,
+    };
+
+    /**
+     * @brief @c DateBatchParser class.
+     *
+     * Parses many fixed width date strings (@c XXXX-XX-XX, @c XX-XX-XXXX, @c XXXX/XX/XX, @c XX/XX/XXXX) in one call,
+     * writing into a preallocated array of @c Date objects and a validity bitmask. Accepts exactly the same strings
+     * as @c Date(std::string_view), including the day/month swap.
+     *
+     * The validity bitmask holds one bit per date: bit @c i%64 of word @c i/64 is set if date @c i was parsed.
+     * Invalid entries are set to a default constructed @c Date.
+     * @namespace @c dt
+     */
+    class DateBatchParser {
+    public:
+        DateBatchParser() = default;
+        ~DateBatchParser() = default;
+
+        static std::size_t parse(const char* buffer, std::size_t count, std::size_t stride, Date* out,
+                                 std::uint64_t* validMask, BatchBackend backend = BatchBackend::Auto);
+        static std::size_t parse(const std::string_view* dates, std::size_t count, Date* out,
+                                 std::uint64_t* validMask, BatchBackend backend = BatchBackend::Auto);
+
+        static BatchBackend getSupportedBackend();
+        static constexpr std::size_t validMaskSize(std::size_t count);
+        static bool isValid(const std::uint64_t* validMask, std::size_t index);
+
+    private:
+        static std::size_t storeDates(const std::int32_t* days, const std::int32_t* months, const std::int32_t* years,
+                                      const std::int32_t* serials, std::uint64_t valid, std::size_t size, Date* out);
+    };
+
+    /**
+     * @brief Gets the number of 64-bit words needed for the validity bitmask of a batch, e.g. to size an array.
+     * @param count
+     *          The number of dates in the batch.
+     * @return The number of words.
+     */
+    constexpr std::size_t DateBatchParser::validMaskSize(std::size_t count) {
+        return (count + 63) / 64;
+    }
+}
+
+#endif //DATEANDTIME_LIB_DATEBATCHPARSER_HPP
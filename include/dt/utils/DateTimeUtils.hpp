@@ -9,10 +9,15 @@
 #define DATEANDTIME_LIB_DATETIMEUTILS_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <iomanip>
+#include <optional>
+#include <vector>
 
 #include "../date/Date.hpp"
+#include "../date/DateFormat.hpp"
 #include "../time/TimeStamp.hpp"
+#include "ParseResult.hpp"
 
 namespace dt {
     class Date;
@@ -30,7 +35,7 @@ namespace dt {
         DateTimeUtils() = default;
         ~DateTimeUtils() = default;
 
-        static std::string getDayOfWeek(const std::string& date);
+        static std::string getDayOfWeek(std::string_view date);
         static int daysBetween(const Date& first, const Date& second);
         static int monthsBetween(const Date& first, const Date& second);
         static int yearsBetween(const Date& first, const Date& second);
@@ -46,6 +51,13 @@ namespace dt {
         static std::string getMonthLongStr(int month);
 
         static std::vector<Date> parseDateStrings(const std::vector<std::string>& dates);
+        static std::vector<Date> parseDateStrings(const std::vector<std::string>& dates,
+                                                  std::vector<std::uint64_t>& validMask, unsigned int threadCount);
+        static std::vector<Date> parseDateStrings(const std::vector<std::string>& dates, DateFormat format,
+                                                  std::vector<std::size_t>& contradictingRows);
+        static std::vector<ParseResult<Date>> tryParseDateStrings(const std::vector<std::string>& dates);
+        static std::optional<DateFormat> inferDateFormat(const std::vector<std::string>& dates,
+                                                         std::size_t sampleSize = consts::DATE_FORMAT_SAMPLE_SIZE);
         static long long toMilliseconds(const TimeStamp& timeStamp);
 
         static std::string getCurrentTimeStr();
@@ -53,9 +65,11 @@ namespace dt {
     private:
         static int daysSinceReferenceDate(const Date& date);
         static int monthsSinceReferenceDate(const Date& date);
-        static bool isValidDay(int day, int month, int year);
-        static bool isValidMonth(int month);
-        static bool isValidYear(int year);
+        template<DateFormat F>
+        static void parseDateStringsColumn(const std::vector<std::string>& dates, Date* out,
+                                           std::vector<std::size_t>& contradictingRows);
+        static void parseDateStringsChunk(const std::vector<std::string>& dates, std::size_t begin, std::size_t end,
+                                          Date* out, std::uint64_t* validMask);
     };
 }
 
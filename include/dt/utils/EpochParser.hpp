@@ -0,0 +1,83 @@
+/**
+ * @file EpochParser.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_EPOCHPARSER_HPP
+#define DATEANDTIME_LIB_EPOCHPARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../time/DateTime.hpp"
+#include "ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief @c EpochUnit enum class.
+     *
+     * The unit of a Unix epoch value, the time since @c 1970-01-01T00:00:00Z. <br>
+     *
+     * The units are:
+     * <ul>
+     *  <li>@c EpochUnit::Auto         - Detected from the magnitude of each value, see @c EpochParser::detectUnit.</li>
+     *  <li>@c EpochUnit::Seconds      - e.g. @c 1697545200.</li>
+     *  <li>@c EpochUnit::Milliseconds - e.g. @c 1697545200123.</li>
+     *  <li>@c EpochUnit::Microseconds - e.g. @c 1697545200123456.</li>
+     *  <li>@c EpochUnit::Nanoseconds  - e.g. @c 1697545200123456789.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class EpochUnit : uint8_t {
+        Auto,
+        Seconds,
+        Milliseconds,
+        Microseconds,
+        Nanoseconds,
+    };
+
+    /**
+     * @brief @c EpochParser class.
+     *
+     * Converts Unix epoch values, as integers or as strings of digits, to @c DateTime objects in UTC, one at a time
+     * or a column at a time. The date & time of day are computed directly from the count of days & the seconds
+     * within the day, without @c std::gmtime or @c std::localtime, so nothing is locked & nothing is allocated. Use
+     * @c DateTime::getDate & @c DateTime::getTimeStamp to split the results.
+     *
+     * The unit is either given or detected from the magnitude of the value: below 10^11 is seconds, below 10^14 is
+     * milliseconds, below 10^17 is microseconds & anything larger is nanoseconds. Each range covers up to year 5138
+     * in its own unit, so current values are never ambiguous. A column that mixes units is decoded value by value
+     * with @c EpochUnit::Auto, while @c detectUnit(values, count) picks one unit for a whole column from its largest
+     * value, for columns where small values, e.g. close to 1970, would otherwise be mistaken for a coarser unit.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::ParseResult<dt::DateTime> time{dt::EpochParser::tryParse("1697545200123")}; // 2023-10-17T12:20:00.123Z
+     * @endcode
+     * @namespace @c dt
+     */
+    class EpochParser {
+    public:
+        EpochParser() = default;
+        ~EpochParser() = default;
+
+        static EpochUnit detectUnit(std::int64_t value);
+        static EpochUnit detectUnit(const std::int64_t* values, std::size_t count);
+
+        static ParseResult<DateTime> fromValue(std::int64_t value, EpochUnit unit = EpochUnit::Auto) noexcept;
+        static ParseResult<DateTime> tryParse(std::string_view epoch, EpochUnit unit = EpochUnit::Auto) noexcept;
+
+        static std::size_t parse(const std::int64_t* values, std::size_t count, EpochUnit unit, DateTime* out,
+                                 std::uint64_t* validMask);
+        static std::size_t parse(const std::string_view* epochs, std::size_t count, EpochUnit unit, DateTime* out,
+                                 std::uint64_t* validMask);
+
+    private:
+        static bool toDateTime(std::int64_t value, EpochUnit unit, DateTime& out);
+    };
+}
+
+#endif //DATEANDTIME_LIB_EPOCHPARSER_HPP
@@ -0,0 +1,75 @@
+/**
+ * @file FormatUtils.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_FORMATUTILS_HPP
+#define DATEANDTIME_LIB_FORMATUTILS_HPP
+
+#include <cstring>
+
+namespace dt {
+    /**
+     * @brief Character level helpers shared by the hand written formatters.
+     *
+     * The helpers write into a caller provided buffer that is already known to be big enough, so they never
+     * allocate and never throw.
+     * @namespace @c dt::detail
+     */
+    namespace detail {
+        /**
+         * @brief The two character representation of every number from 0 to 99: "00", "01", ... "99".
+         */
+        struct TwoDigitTable {
+            char digits[200];
+
+            constexpr TwoDigitTable() : digits{} {
+                for (int i{0}; i < 100; ++i) {
+                    digits[i * 2] = static_cast<char>('0' + i / 10);
+                    digits[i * 2 + 1] = static_cast<char>('0' + i % 10);
+                }
+            }
+        };
+
+        inline constexpr TwoDigitTable TWO_DIGITS{};
+
+        /**
+         * @brief Writes a number as exactly two digits, with a leading zero if needed.
+         * @param out
+         *          Where to write the digits.
+         * @param value
+         *          The number, 0-99.
+         */
+        inline void writeTwoDigits(char* out, int value) {
+            std::memcpy(out, TWO_DIGITS.digits + value * 2, 2);
+        }
+
+        /**
+         * @brief Writes a number as exactly three digits, with leading zeros if needed.
+         * @param out
+         *          Where to write the digits.
+         * @param value
+         *          The number, 0-999.
+         */
+        inline void writeThreeDigits(char* out, int value) {
+            out[0] = static_cast<char>('0' + value / 100);
+            writeTwoDigits(out + 1, value % 100);
+        }
+
+        /**
+         * @brief Writes a number as exactly four digits, with leading zeros if needed.
+         * @param out
+         *          Where to write the digits.
+         * @param value
+         *          The number, 0-9999.
+         */
+        inline void writeFourDigits(char* out, int value) {
+            writeTwoDigits(out, value / 100);
+            writeTwoDigits(out + 2, value % 100);
+        }
+    }
+}
+
+#endif //DATEANDTIME_LIB_FORMATUTILS_HPP
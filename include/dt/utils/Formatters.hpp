@@ -0,0 +1,314 @@
+/**
+ * @file Formatters.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_FORMATTERS_HPP
+#define DATEANDTIME_LIB_FORMATTERS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "../date/Calendar.hpp"
+#include "../date/Date.hpp"
+#include "../date/DateFormat.hpp"
+#include "../date/FormattedDate.hpp"
+#include "../time/TimeStamp.hpp"
+#include "InlineString.hpp"
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#define DT_HAS_STD_FORMAT 1
+#include <format>
+#endif
+
+// Define DT_NO_FMT to leave out the fmt specialisations even if fmt is installed.
+#if !defined(DT_NO_FMT) && __has_include(<fmt/format.h>)
+#define DT_HAS_FMT 1
+#include <fmt/format.h>
+#endif
+
+namespace dt {
+    namespace detail {
+        /**
+         * @brief The format spec of every @c DateFormat, in the order of the enum, e.g. @c {:YYYY-MM-DD} for
+         * @c DateFormat::YYYY_MM_DD.
+         */
+        inline constexpr std::string_view DATE_FORMAT_SPECS[] {
+            "DD-MM-YYYY", "MM-DD-YYYY", "YYYY-MM-DD", "YYYY-DD-MM",
+            "DD/MM/YYYY", "MM/DD/YYYY", "YYYY/MM/DD", "YYYY/DD/MM",
+        };
+
+        /**
+         * @brief A parsed format spec: empty, or one of @c DATE_FORMAT_SPECS.
+         */
+        struct DateFormatSpec {
+            DateFormat format{DateFormat::DD_MM_YYYY};
+            bool hasFormat{false};
+            bool valid{true};
+
+            /**
+             * @brief Parses the spec between the ':' & the closing '}' of a replacement field.
+             * @param first
+             *          The first character of the spec.
+             * @param last
+             *          The end of the format string.
+             * @param allowFormat
+             *          @c false for the types that only support an empty spec.
+             * @return An iterator to the closing '}', or @p last. @c valid is cleared if the spec is not supported.
+             */
+            template<typename Iterator>
+            constexpr Iterator parse(Iterator first, Iterator last, bool allowFormat) {
+                Iterator end{first};
+                std::size_t length{0};
+                while (end != last && *end != '}') {
+                    ++end;
+                    ++length;
+                }
+                if (length == 0) {
+                    return end;
+                }
+
+                valid = false;
+                if (!allowFormat || length != consts::DATE_STRING_LENGTH) {
+                    return end;
+                }
+                for (std::size_t i{0}; i < sizeof(DATE_FORMAT_SPECS) / sizeof(DATE_FORMAT_SPECS[0]); ++i) {
+                    Iterator c{first};
+                    std::size_t matched{0};
+                    while (matched < length && *c == DATE_FORMAT_SPECS[i][matched]) {
+                        ++c;
+                        ++matched;
+                    }
+                    if (matched == length) {
+                        format = static_cast<DateFormat>(i);
+                        hasFormat = true;
+                        valid = true;
+                        break;
+                    }
+                }
+                return end;
+            }
+        };
+
+        /**
+         * @brief Formats a date, in the spec's format if it has one, without allocating.
+         */
+        inline InlineString<consts::DATE_MAX_STRING_LENGTH> formatDate(const Date& date, const DateFormatSpec& spec) {
+            return spec.hasFormat ? FormattedDate{date, spec.format}.toInlineString() : date.toInlineString();
+        }
+
+        inline InlineString<consts::DATE_MAX_STRING_LENGTH> formatDate(const FormattedDate& date,
+                                                                       const DateFormatSpec& spec) {
+            return spec.hasFormat ? FormattedDate{date.getDate(), spec.format}.toInlineString()
+                                  : date.toInlineString();
+        }
+    }
+}
+
+#ifdef DT_HAS_STD_FORMAT
+/**
+ * @brief @c std::format support for @c dt::Date, e.g. @c std::format("{}", date) or @c std::format("{:YYYY-MM-DD}",
+ * date). The spec is empty or the layout of a @c dt::DateFormat.
+ */
+template<>
+struct std::formatter<dt::Date> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), true)};
+        if (!spec.valid) {
+            throw std::format_error{"Invalid dt::Date format spec, expected e.g. YYYY-MM-DD"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::Date& date, FormatContext& ctx) const {
+        const auto text{dt::detail::formatDate(date, spec)};
+        return std::copy(text.data(), text.data() + text.size(), ctx.out());
+    }
+};
+
+/**
+ * @brief @c std::format support for @c dt::FormattedDate, in its own format unless the spec gives one.
+ */
+template<>
+struct std::formatter<dt::FormattedDate> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), true)};
+        if (!spec.valid) {
+            throw std::format_error{"Invalid dt::FormattedDate format spec, expected e.g. YYYY-MM-DD"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::FormattedDate& date, FormatContext& ctx) const {
+        const auto text{dt::detail::formatDate(date, spec)};
+        return std::copy(text.data(), text.data() + text.size(), ctx.out());
+    }
+};
+
+/**
+ * @brief @c std::format support for @c dt::TimeStamp, the spec must be empty.
+ */
+template<>
+struct std::formatter<dt::TimeStamp> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), false)};
+        if (!spec.valid) {
+            throw std::format_error{"dt::TimeStamp takes no format spec"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::TimeStamp& timeStamp, FormatContext& ctx) const {
+        const auto text{timeStamp.toInlineString()};
+        return std::copy(text.data(), text.data() + text.size(), ctx.out());
+    }
+};
+
+/**
+ * @brief @c std::format support for @c dt::Calendar, the spec must be empty.
+ */
+template<>
+struct std::formatter<dt::Calendar> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), false)};
+        if (!spec.valid) {
+            throw std::format_error{"dt::Calendar takes no format spec"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::Calendar& calendar, FormatContext& ctx) const {
+        char buffer[dt::Calendar::maxLength()];
+        char* end{calendar.toChars(buffer, buffer + sizeof(buffer))};
+        return std::copy(buffer, end == nullptr ? buffer : end, ctx.out());
+    }
+};
+#endif
+
+#ifdef DT_HAS_FMT
+namespace dt {
+    namespace detail {
+        /**
+         * @brief Appends formatted text to the output of an fmt format context in one go, rather than a character at
+         * a time.
+         */
+        template<typename FormatContext>
+        auto writeFmt(std::string_view text, FormatContext& ctx) {
+            return fmt::formatter<fmt::string_view>{}.format(fmt::string_view{text.data(), text.size()}, ctx);
+        }
+    }
+}
+
+/**
+ * @brief fmt support for @c dt::Date, e.g. @c fmt::format("{}", date) or @c fmt::format("{:YYYY-MM-DD}", date). The
+ * spec is empty or the layout of a @c dt::DateFormat.
+ */
+template<>
+struct fmt::formatter<dt::Date> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), true)};
+        if (!spec.valid) {
+            throw fmt::format_error{"Invalid dt::Date format spec, expected e.g. YYYY-MM-DD"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::Date& date, FormatContext& ctx) const {
+        const auto text{dt::detail::formatDate(date, spec)};
+        return dt::detail::writeFmt(text, ctx);
+    }
+};
+
+/**
+ * @brief fmt support for @c dt::FormattedDate, in its own format unless the spec gives one.
+ */
+template<>
+struct fmt::formatter<dt::FormattedDate> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), true)};
+        if (!spec.valid) {
+            throw fmt::format_error{"Invalid dt::FormattedDate format spec, expected e.g. YYYY-MM-DD"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::FormattedDate& date, FormatContext& ctx) const {
+        const auto text{dt::detail::formatDate(date, spec)};
+        return dt::detail::writeFmt(text, ctx);
+    }
+};
+
+/**
+ * @brief fmt support for @c dt::TimeStamp, the spec must be empty.
+ */
+template<>
+struct fmt::formatter<dt::TimeStamp> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), false)};
+        if (!spec.valid) {
+            throw fmt::format_error{"dt::TimeStamp takes no format spec"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::TimeStamp& timeStamp, FormatContext& ctx) const {
+        const auto text{timeStamp.toInlineString()};
+        return dt::detail::writeFmt(text, ctx);
+    }
+};
+
+/**
+ * @brief fmt support for @c dt::Calendar, the spec must be empty.
+ */
+template<>
+struct fmt::formatter<dt::Calendar> {
+    dt::detail::DateFormatSpec spec;
+
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        auto end{spec.parse(ctx.begin(), ctx.end(), false)};
+        if (!spec.valid) {
+            throw fmt::format_error{"dt::Calendar takes no format spec"};
+        }
+        return end;
+    }
+
+    template<typename FormatContext>
+    auto format(const dt::Calendar& calendar, FormatContext& ctx) const {
+        char buffer[dt::Calendar::maxLength()];
+        const char* end{calendar.toChars(buffer, buffer + sizeof(buffer))};
+        return dt::detail::writeFmt({buffer, end == nullptr ? 0 : static_cast<std::size_t>(end - buffer)}, ctx);
+    }
+};
+#endif
+
+#endif //DATEANDTIME_LIB_FORMATTERS_HPP
@@ -0,0 +1,201 @@
+/**
+ * @file InlineString.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_INLINESTRING_HPP
+#define DATEANDTIME_LIB_INLINESTRING_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace dt {
+    /**
+     * @brief @c InlineString class.
+     *
+     * A string of at most @p N characters stored inside the object, so it can be returned by value without touching
+     * the heap. It is always null terminated & converts implicitly to a @c std::string_view.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::InlineString<dt::consts::DATE_MAX_STRING_LENGTH> text{dt::Date{22, 12, 2001}.toInlineString()};
+     * std::puts(text.c_str());
+     * @endcode
+     * @namespace @c dt
+     */
+    template<std::size_t N>
+    class InlineString {
+    public:
+        InlineString() = default;
+        InlineString(const char* first, const char* last);
+        ~InlineString() = default;
+
+        static constexpr std::size_t capacity();
+
+        char* data();
+        const char* data() const;
+        const char* c_str() const;
+        std::size_t size() const;
+        bool empty() const;
+        void resize(std::size_t count);
+        std::string_view view() const;
+        std::string str() const;
+        operator std::string_view() const;
+
+        bool operator==(const InlineString& other) const;
+        bool operator!=(const InlineString& other) const;
+        template<std::size_t M>
+        friend std::ostream& operator<<(std::ostream& os, const InlineString<M>& string);
+
+    private:
+        char buffer[N + 1]{};
+        std::size_t length{0};
+    };
+
+    /**
+     * @brief @c InlineString constructor, copies a range of at most @p N characters.
+     * @param first
+     *          The first character.
+     * @param last
+     *          One past the last character.
+     */
+    template<std::size_t N>
+    InlineString<N>::InlineString(const char* first, const char* last) {
+        resize(static_cast<std::size_t>(last - first));
+        std::memcpy(buffer, first, length);
+    }
+
+    /**
+     * @brief Gets the maximum number of characters the string can hold.
+     * @return The capacity.
+     */
+    template<std::size_t N>
+    constexpr std::size_t InlineString<N>::capacity() {
+        return N;
+    }
+
+    /**
+     * @brief Gets the characters, to write into up to @c capacity() characters before calling @c resize.
+     * @return A pointer to the first character.
+     */
+    template<std::size_t N>
+    char* InlineString<N>::data() {
+        return buffer;
+    }
+
+    /**
+     * @brief Gets the characters.
+     * @return A pointer to the first character.
+     */
+    template<std::size_t N>
+    const char* InlineString<N>::data() const {
+        return buffer;
+    }
+
+    /**
+     * @brief Gets the characters as a null terminated string.
+     * @return A pointer to the first character.
+     */
+    template<std::size_t N>
+    const char* InlineString<N>::c_str() const {
+        return buffer;
+    }
+
+    /**
+     * @brief Gets the number of characters.
+     * @return The size.
+     */
+    template<std::size_t N>
+    std::size_t InlineString<N>::size() const {
+        return length;
+    }
+
+    /**
+     * @brief Checks if the string has no characters.
+     * @return @c true if the string is empty, @c false otherwise.
+     */
+    template<std::size_t N>
+    bool InlineString<N>::empty() const {
+        return length == 0;
+    }
+
+    /**
+     * @brief Sets the number of characters, clamped to @c capacity(), e.g. after writing into @c data().
+     * @param count
+     *          The number of characters.
+     */
+    template<std::size_t N>
+    void InlineString<N>::resize(std::size_t count) {
+        length = count < N ? count : N;
+        buffer[length] = '\0';
+    }
+
+    /**
+     * @brief Gets a view of the characters, valid while the string is alive & unchanged.
+     * @return The view.
+     */
+    template<std::size_t N>
+    std::string_view InlineString<N>::view() const {
+        return {buffer, length};
+    }
+
+    /**
+     * @brief Copies the characters into a @c std::string.
+     * @return The string.
+     */
+    template<std::size_t N>
+    std::string InlineString<N>::str() const {
+        return {buffer, length};
+    }
+
+    /**
+     * @brief Gets a view of the characters, see @c view.
+     */
+    template<std::size_t N>
+    InlineString<N>::operator std::string_view() const {
+        return view();
+    }
+
+    /**
+     * @brief Compares two strings for equality.
+     * @param other
+     *          The string to compare against.
+     * @return @c true if the strings hold the same characters, @c false otherwise.
+     */
+    template<std::size_t N>
+    bool InlineString<N>::operator==(const InlineString& other) const {
+        return view() == other.view();
+    }
+
+    /**
+     * @brief Compares two strings for inequality.
+     * @param other
+     *          The string to compare against.
+     * @return @c true if the strings hold different characters, @c false otherwise.
+     */
+    template<std::size_t N>
+    bool InlineString<N>::operator!=(const InlineString& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Writes the characters to an output stream.
+     * @param os
+     *          The output stream.
+     * @param string
+     *          The string to write.
+     * @return The output stream.
+     */
+    template<std::size_t M>
+    std::ostream& operator<<(std::ostream& os, const InlineString<M>& string) {
+        os.write(string.data(), static_cast<std::streamsize>(string.size()));
+        return os;
+    }
+}
+
+#endif //DATEANDTIME_LIB_INLINESTRING_HPP
@@ -0,0 +1,51 @@
+/**
+ * @file LogScanner.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_LOGSCANNER_HPP
+#define DATEANDTIME_LIB_LOGSCANNER_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "DateBatchParser.hpp"
+#include "StreamTokenizer.hpp"
+
+namespace dt {
+    /**
+     * @brief @c LogScanner class.
+     *
+     * Finds every date & time stamp in a buffer of free-form text, e.g. a whole log file mapped into memory, and
+     * decodes them. A token is found exactly like the @c StreamTokenizer finds one: a run of digits, '-', '/' & ':'
+     * that is 10 characters long is parsed as a @c Date & one that is 12 characters long as a @c TimeStamp.
+     *
+     * Most of a log is text & short numbers, so the scanner classifies 64 bytes at a time into a bitmask of token
+     * characters with vector compares & only looks at the bytes where a run starts or ends. The SIMD backends are
+     * picked at runtime like those of the @c DateBatchParser.
+     *
+     * To scan a file too large to hold its tokens at once, scan it in pieces split at line breaks & add the offset
+     * of each piece.
+     *
+     * <b>Example:</b>
+     * @code
+     * std::vector<dt::StreamToken> tokens;
+     * dt::LogScanner::scan("2001-12-22 18:46:37:123 login\n", tokens); // A date at 0 & a time stamp at 11.
+     * @endcode
+     * @namespace @c dt
+     */
+    class LogScanner {
+    public:
+        LogScanner() = default;
+        ~LogScanner() = default;
+
+        static std::size_t scan(std::string_view buffer, std::vector<StreamToken>& tokens,
+                                BatchBackend backend = BatchBackend::Auto);
+        static std::vector<StreamToken> scan(std::string_view buffer, BatchBackend backend = BatchBackend::Auto);
+    };
+}
+
+#endif //DATEANDTIME_LIB_LOGSCANNER_HPP
@@ -0,0 +1,98 @@
+/**
+ * @file ParseCache.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_PARSECACHE_HPP
+#define DATEANDTIME_LIB_PARSECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "../time/TimeStamp.hpp"
+#include "ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief @c DateParseCache class.
+     *
+     * A bounded cache in front of @c Date::tryParse for feeds that repeat the same date strings over & over. The
+     * cache is direct mapped & keyed on the raw bytes of the string, so a hit is a hash, one compare & a copy, and a
+     * new string simply evicts whatever was in its slot. Failed parses are cached too.
+     *
+     * A cache is not thread safe, use @c threadLocal() to get one per thread rather than sharing one.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::ParseResult<dt::Date> date{dt::DateParseCache::threadLocal().tryParse("2001-12-22")};
+     * @endcode
+     * @namespace @c dt
+     */
+    class DateParseCache {
+    public:
+        explicit DateParseCache(std::size_t capacity = consts::PARSE_CACHE_CAPACITY);
+        ~DateParseCache() = default;
+
+        static DateParseCache& threadLocal();
+
+        ParseResult<Date> tryParse(std::string_view date);
+        std::size_t getCapacity() const;
+        std::size_t getHits() const;
+        std::size_t getMisses() const;
+        void clear();
+
+    private:
+        struct Entry {
+            std::uint64_t low{0};
+            std::uint64_t high{0}; // 0 marks an empty slot.
+            ParseResult<Date> date{ParseError::None, 0};
+        };
+
+        std::vector<Entry> entries;
+        std::size_t mask;
+        std::size_t hits{0};
+        std::size_t misses{0};
+    };
+
+    /**
+     * @brief @c TimeStampParseCache class.
+     *
+     * A bounded cache in front of @c TimeStamp::tryParse. Time stamps in a feed rarely repeat to the millisecond, so
+     * the cache is keyed on the @c HH:MM:SS prefix only & the milliseconds are decoded on every call. Otherwise it
+     * behaves like @c DateParseCache.
+     * @namespace @c dt
+     */
+    class TimeStampParseCache {
+    public:
+        explicit TimeStampParseCache(std::size_t capacity = consts::PARSE_CACHE_CAPACITY);
+        ~TimeStampParseCache() = default;
+
+        static TimeStampParseCache& threadLocal();
+
+        ParseResult<TimeStamp> tryParse(std::string_view timeStamp);
+        std::size_t getCapacity() const;
+        std::size_t getHits() const;
+        std::size_t getMisses() const;
+        void clear();
+
+    private:
+        struct Entry {
+            std::uint64_t prefix{0};
+            bool used{false};
+            ParseResult<TimeStamp> timeStamp{ParseError::None, 0}; // With the milliseconds set to 0.
+        };
+
+        std::vector<Entry> entries;
+        std::size_t mask;
+        std::size_t hits{0};
+        std::size_t misses{0};
+    };
+}
+
+#endif //DATEANDTIME_LIB_PARSECACHE_HPP
@@ -0,0 +1,215 @@
+/**
+ * @file ParseResult.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_PARSERESULT_HPP
+#define DATEANDTIME_LIB_PARSERESULT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dt {
+    /**
+     * @brief @c ParseError enum class.
+     *
+     * Why a string representation could not be parsed. <br>
+     *
+     * The errors are:
+     * <ul>
+     *  <li>@c ParseError::None              - The string was parsed.</li>
+     *  <li>@c ParseError::TooShort          - The string ended before the end of the layout.</li>
+     *  <li>@c ParseError::TooLong           - The string continues after the end of the layout.</li>
+     *  <li>@c ParseError::ExpectedDigit     - A digit was expected.</li>
+     *  <li>@c ParseError::ExpectedSeparator - A separator was expected, or it didn't match the previous one.</li>
+     *  <li>@c ParseError::InvalidDate       - The layout matched but the date doesn't exist.</li>
+     *  <li>@c ParseError::InvalidTime       - The layout matched but the time doesn't exist.</li>
+     *  <li>@c ParseError::InvalidUtcOffset  - The layout matched but the UTC offset is out of range.</li>
+     *  <li>@c ParseError::InvalidMonthName  - A month name was expected but the word isn't one.</li>
+     * </ul>
+     * @namespace @c dt
+     */
+    enum class ParseError : uint8_t {
+        None,
+        TooShort,
+        TooLong,
+        ExpectedDigit,
+        ExpectedSeparator,
+        InvalidDate,
+        InvalidTime,
+        InvalidUtcOffset,
+        InvalidMonthName,
+    };
+
+    /**
+     * @brief Gets a short description of a parse error.
+     * @param error
+     *          The parse error.
+     * @return The description, a string literal.
+     */
+    constexpr const char* getParseErrorStr(ParseError error) {
+        switch (error) {
+            case ParseError::None:
+                return "No error";
+            case ParseError::TooShort:
+                return "Too short";
+            case ParseError::TooLong:
+                return "Too long";
+            case ParseError::ExpectedDigit:
+                return "Expected a digit";
+            case ParseError::ExpectedSeparator:
+                return "Expected a separator";
+            case ParseError::InvalidDate:
+                return "Date is invalid";
+            case ParseError::InvalidTime:
+                return "Time is invalid";
+            case ParseError::InvalidUtcOffset:
+                return "UTC offset is invalid";
+            case ParseError::InvalidMonthName:
+                return "Month name is invalid";
+        }
+        return "Unknown error";
+    }
+
+    /**
+     * @brief @c ParseResult class.
+     *
+     * The result of a non-throwing parse: either the parsed value, or the error & the offset of the character that
+     * caused it. Never allocates, so it is as cheap to return on failure as on success.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::ParseResult<dt::Date> result{dt::Date::tryParse("22-13-2001")};
+     * if (!result) {
+     *     // result.getError() == dt::ParseError::InvalidDate
+     * }
+     * @endcode
+     * @tparam T
+     *          The type of the parsed value.
+     * @namespace @c dt
+     */
+    template<typename T>
+    class ParseResult {
+    public:
+        constexpr ParseResult(const T& value);
+        constexpr ParseResult(ParseError error, std::size_t offset);
+
+        constexpr bool hasValue() const;
+        constexpr explicit operator bool() const;
+        constexpr const T& getValue() const;
+        constexpr T getValueOr(const T& defaultValue) const;
+        constexpr ParseError getError() const;
+        constexpr std::size_t getErrorOffset() const;
+
+        constexpr const T& operator*() const;
+        constexpr const T* operator->() const;
+
+    private:
+        T value{};
+        ParseError error{ParseError::None};
+        std::size_t offset{0};
+    };
+
+    /**
+     * @brief @c ParseResult constructor for a successful parse.
+     * @param value
+     *          The parsed value.
+     */
+    template<typename T>
+    constexpr ParseResult<T>::ParseResult(const T& value)
+        : value{value} {
+    }
+
+    /**
+     * @brief @c ParseResult constructor for a failed parse.
+     * @param error
+     *          Why the parse failed.
+     * @param offset
+     *          The offset of the character that caused the error.
+     */
+    template<typename T>
+    constexpr ParseResult<T>::ParseResult(ParseError error, std::size_t offset)
+        : error{error},
+          offset{offset} {
+    }
+
+    /**
+     * @brief Checks if the parse succeeded.
+     * @return @c true if the result holds a value, @c false otherwise.
+     */
+    template<typename T>
+    constexpr bool ParseResult<T>::hasValue() const {
+        return error == ParseError::None;
+    }
+
+    /**
+     * @brief Checks if the parse succeeded.
+     * @return @c true if the result holds a value, @c false otherwise.
+     */
+    template<typename T>
+    constexpr ParseResult<T>::operator bool() const {
+        return hasValue();
+    }
+
+    /**
+     * @brief Gets the parsed value. Only meaningful if @c hasValue() is @c true, otherwise a default constructed
+     * value is returned.
+     * @return The parsed value.
+     */
+    template<typename T>
+    constexpr const T& ParseResult<T>::getValue() const {
+        return value;
+    }
+
+    /**
+     * @brief Gets the parsed value, or a default if the parse failed.
+     * @param defaultValue
+     *          The value to return if the parse failed.
+     * @return The parsed value or @p defaultValue.
+     */
+    template<typename T>
+    constexpr T ParseResult<T>::getValueOr(const T& defaultValue) const {
+        return hasValue() ? value : defaultValue;
+    }
+
+    /**
+     * @brief Gets why the parse failed.
+     * @return The error, @c ParseError::None if the parse succeeded.
+     */
+    template<typename T>
+    constexpr ParseError ParseResult<T>::getError() const {
+        return error;
+    }
+
+    /**
+     * @brief Gets the offset of the character that caused the parse to fail. For @c ParseError::InvalidDate,
+     * @c ParseError::InvalidTime & @c ParseError::InvalidUtcOffset it is the offset of the first invalid component.
+     * @return The offset, 0 if the parse succeeded.
+     */
+    template<typename T>
+    constexpr std::size_t ParseResult<T>::getErrorOffset() const {
+        return offset;
+    }
+
+    /**
+     * @brief Gets the parsed value, see @c getValue().
+     * @return The parsed value.
+     */
+    template<typename T>
+    constexpr const T& ParseResult<T>::operator*() const {
+        return value;
+    }
+
+    /**
+     * @brief Accesses the parsed value, see @c getValue().
+     * @return A pointer to the parsed value.
+     */
+    template<typename T>
+    constexpr const T* ParseResult<T>::operator->() const {
+        return &value;
+    }
+}
+
+#endif //DATEANDTIME_LIB_PARSERESULT_HPP
@@ -0,0 +1,505 @@
+/**
+ * @file ParseUtils.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_PARSEUTILS_HPP
+#define DATEANDTIME_LIB_PARSEUTILS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief Character level helpers shared by the hand written @c Date & @c TimeStamp parsers.
+     *
+     * All the helpers operate on raw character ranges that the caller has already bounds checked, so they never
+     * allocate and never throw.
+     * @namespace @c dt::detail
+     */
+    namespace detail {
+        /**
+         * @brief Checks if a character is an ASCII digit (the same set that @c \\d matches).
+         * @param c
+         *          The character to check.
+         * @return @c true if the character is a digit, @c false otherwise.
+         */
+        constexpr bool isDigit(char c) {
+            return static_cast<unsigned char>(c - '0') < 10;
+        }
+
+        /**
+         * @brief Checks if the first @p count characters of a range are all ASCII digits.
+         * @param str
+         *          The start of the range.
+         * @param count
+         *          The number of characters to check.
+         * @return @c true if every character is a digit, @c false otherwise.
+         */
+        constexpr bool isDigits(const char* str, std::size_t count) {
+            for (std::size_t i{0}; i < count; ++i) {
+                if (!isDigit(str[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Checks the digits & separators of an @c HH:MM:SS time, without checking the ranges.
+         * @param str
+         *          The start of the time, at least 8 characters long.
+         * @return @c true if the characters match the layout, @c false otherwise.
+         */
+        constexpr bool isTimeLayout(const char* str) {
+            return isDigits(str, 2) && str[2] == consts::TIME_SEPARATOR && isDigits(str + 3, 2) &&
+                   str[5] == consts::TIME_SEPARATOR && isDigits(str + 6, 2);
+        }
+
+        /**
+         * @brief Checks if a character is one of the supported date separators, '-' or '/'.
+         * @param c
+         *          The character to check.
+         * @return @c true if the character is a date separator, @c false otherwise.
+         */
+        constexpr bool isDateSeparator(char c) {
+            return c == consts::DATE_SEPARATOR_DASH || c == consts::DATE_SEPARATOR_SLASH;
+        }
+
+        /**
+         * @brief Checks if a character is an ASCII letter.
+         * @param c
+         *          The character to check.
+         * @return @c true if the character is a letter, @c false otherwise.
+         */
+        constexpr bool isLetter(char c) {
+            return static_cast<unsigned char>((c | 0x20) - 'a') < 26;
+        }
+
+        /**
+         * @brief Converts an ASCII letter to lower case, any other character is returned as is.
+         * @param c
+         *          The character to convert.
+         * @return The lower case character.
+         */
+        constexpr char toLower(char c) {
+            return isLetter(c) ? static_cast<char>(c | 0x20) : c;
+        }
+
+        /**
+         * @brief Decodes a fixed width run of digits. The digits must have already been validated.
+         * @param str
+         *          The start of the digits.
+         * @param count
+         *          The number of digits to decode.
+         * @return The decoded value.
+         */
+        constexpr int parseDigits(const char* str, std::size_t count) {
+            int value{0};
+            for (std::size_t i{0}; i < count; ++i) {
+                value = value * 10 + (str[i] - '0');
+            }
+            return value;
+        }
+
+        /**
+         * @brief Decodes two validated digits, e.g. a day, month, hour, minute or second.
+         * @param str
+         *          The start of the digits.
+         * @return The decoded value.
+         */
+        constexpr int parseTwoDigits(const char* str) {
+            return (str[0] - '0') * 10 + (str[1] - '0');
+        }
+
+        /**
+         * @brief Decodes three validated digits, e.g. a millisecond.
+         * @param str
+         *          The start of the digits.
+         * @return The decoded value.
+         */
+        constexpr int parseThreeDigits(const char* str) {
+            return (str[0] - '0') * 100 + parseTwoDigits(str + 1);
+        }
+
+        /**
+         * @brief Decodes four validated digits, e.g. a year.
+         * @param str
+         *          The start of the digits.
+         * @return The decoded value.
+         */
+        constexpr int parseFourDigits(const char* str) {
+            return parseTwoDigits(str) * 100 + parseTwoDigits(str + 2);
+        }
+
+        /**
+         * @brief Divides by 100 with a multiply & a shift instead of a division, exact for every 32-bit value.
+         * @param value
+         *          The dividend.
+         * @return The quotient.
+         */
+        constexpr std::uint32_t divideBy100(std::uint32_t value) {
+            return static_cast<std::uint32_t>((std::uint64_t{value} * 1'374'389'535) >> 37);
+        }
+
+        /**
+         * @brief Divides by 1000, see @c divideBy100.
+         * @param value
+         *          The dividend.
+         * @return The quotient.
+         */
+        constexpr std::uint32_t divideBy1000(std::uint32_t value) {
+            return static_cast<std::uint32_t>((std::uint64_t{value} * 274'877'907) >> 38);
+        }
+
+        /**
+         * @brief Divides by 10000, see @c divideBy100.
+         * @param value
+         *          The dividend.
+         * @return The quotient.
+         */
+        constexpr std::uint32_t divideBy10000(std::uint32_t value) {
+            return static_cast<std::uint32_t>((std::uint64_t{value} * 3'518'437'209) >> 45);
+        }
+
+        static_assert(divideBy100(4'294'967'295) == 42'949'672 && divideBy100(99) == 0 && divideBy100(100) == 1);
+        static_assert(divideBy1000(4'294'967'295) == 4'294'967 && divideBy1000(999) == 0 && divideBy1000(1000) == 1);
+        static_assert(divideBy10000(4'294'967'295) == 429'496 && divideBy10000(9'999) == 0 &&
+                      divideBy10000(10'000) == 1);
+
+        /**
+         * @brief Splits a @c YYYYMMDD integer, e.g. @c 20231017, into its components without dividing. The
+         * components are not validated.
+         * @param ymd
+         *          The integer.
+         * @param year
+         *          Set to the year.
+         * @param month
+         *          Set to the month.
+         * @param day
+         *          Set to the day.
+         */
+        constexpr void decodeYmdInt(std::uint32_t ymd, int& year, int& month, int& day) {
+            const std::uint32_t y{divideBy10000(ymd)};
+            const std::uint32_t monthDay{ymd - y * 10'000};
+            const std::uint32_t m{divideBy100(monthDay)};
+            year = static_cast<int>(y);
+            month = static_cast<int>(m);
+            day = static_cast<int>(monthDay - m * 100);
+        }
+
+        /**
+         * @brief Splits an @c HHMMSSmmm integer, e.g. @c 123456789 for @c 12:34:56:789, into its components without
+         * dividing. The components are not validated.
+         * @param hmsm
+         *          The integer.
+         * @param hour
+         *          Set to the hour.
+         * @param minute
+         *          Set to the minute.
+         * @param second
+         *          Set to the second.
+         * @param millisecond
+         *          Set to the millisecond.
+         */
+        constexpr void decodeHmsmInt(std::uint32_t hmsm, int& hour, int& minute, int& second, int& millisecond) {
+            const std::uint32_t hms{divideBy1000(hmsm)};
+            const std::uint32_t hm{divideBy100(hms)};
+            const std::uint32_t h{divideBy100(hm)};
+            hour = static_cast<int>(h);
+            minute = static_cast<int>(hm - h * 100);
+            second = static_cast<int>(hms - hm * 100);
+            millisecond = static_cast<int>(hmsm - hms * 1'000);
+        }
+
+        /**
+         * @brief Checks if the year passed is a leap year.
+         *
+         * A multiple of 100 is a multiple of 400 iff it is a multiple of 16, so this needs a single cheap modulo and
+         * has no unpredictable branches.
+         * @param year
+         *          The year to check.
+         * @return @c true if the year is a leap year, @c false otherwise.
+         */
+        constexpr bool isLeapYear(int year) {
+            return (year & (year % 25 != 0 ? 3 : 15)) == 0;
+        }
+
+        /**
+         * @brief Gets the number of days in a month. The month must be valid.
+         * @param year
+         *          The year.
+         * @param month
+         *          The month, 1-12.
+         * @return The number of days in the month.
+         */
+        constexpr int daysInMonth(int year, int month) {
+            constexpr int days[13]{0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            return days[month] + (month == 2 && isLeapYear(year) ? 1 : 0);
+        }
+
+        /**
+         * @brief Checks if a date is valid, i.e. the month is 1-12, the day exists in that month & the year is in the
+         * range @c consts::MIN_YEAR - @c consts::MAX_YEAR.
+         * @param day
+         *          The day.
+         * @param month
+         *          The month.
+         * @param year
+         *          The year.
+         * @return @c true if the date is valid, @c false otherwise.
+         */
+        constexpr bool isValidDate(int day, int month, int year) {
+            return month >= consts::MIN_NUMBER_OF_MONTHS && month <= consts::MAX_NUMBER_OF_MONTHS &&
+                   year >= consts::MIN_YEAR && year <= consts::MAX_YEAR &&
+                   day >= 1 && day <= daysInMonth(year, month);
+        }
+
+        /**
+         * @brief Checks if a time is valid, i.e. every component is within its range on the 24h clock.
+         * @param hour
+         *          The hour.
+         * @param minute
+         *          The minute.
+         * @param second
+         *          The second.
+         * @param millisecond
+         *          The millisecond.
+         * @return @c true if the time is valid, @c false otherwise.
+         */
+        constexpr bool isValidTime(int hour, int minute, int second, int millisecond) {
+            return hour >= consts::HOUR_MIN && hour <= consts::HOUR_MAX &&
+                   minute >= consts::MINUTE_MIN && minute <= consts::MINUTE_MAX &&
+                   second >= consts::SECOND_MIN && second <= consts::SECOND_MAX &&
+                   millisecond >= consts::MILLISECOND_MIN && millisecond <= consts::MILLISECOND_MAX;
+        }
+
+        // English month names in lower case for the case insensitive parsers, index 0 is January. Formatting uses
+        // consts::getName & consts::getShortName.
+        static constexpr std::string_view MONTH_NAMES[] {
+            "january", "february", "march", "april", "may", "june",
+            "july", "august", "september", "october", "november", "december"
+        };
+        static constexpr std::size_t MONTH_NAME_MIN_LENGTH{3};
+        static constexpr std::size_t MONTH_NAME_MAX_LENGTH{9};
+
+        /**
+         * @brief Hashes the first three letters of a month name, case-insensitively, into one of 16 slots. The
+         * multiplier was picked so that the 12 months land in 12 different slots, which @c MONTH_NAME_SLOTS checks at
+         * compile time.
+         * @param str
+         *          The start of the name, at least 3 characters long.
+         * @return The slot, 0-15.
+         */
+        constexpr std::size_t getMonthNameSlot(const char* str) {
+            constexpr std::uint32_t multiplier{1'909'207};
+            std::uint32_t key{static_cast<std::uint32_t>(static_cast<unsigned char>(str[0] | 0x20)) << 16 |
+                              static_cast<std::uint32_t>(static_cast<unsigned char>(str[1] | 0x20)) << 8 |
+                              static_cast<std::uint32_t>(static_cast<unsigned char>(str[2] | 0x20))};
+            return static_cast<std::size_t>((key * multiplier) >> 28);
+        }
+
+        /**
+         * @brief The month in each slot of @c getMonthNameSlot, 0 if the slot is empty.
+         */
+        struct MonthNameSlots {
+            int months[16]{};
+            int used{0};
+        };
+
+        /**
+         * @brief Builds the slot table of @c getMonthNameSlot.
+         * @return The slot table, @c used is less than 12 if two months share a slot.
+         */
+        constexpr MonthNameSlots makeMonthNameSlots() {
+            MonthNameSlots slots{};
+            for (int month{1}; month <= consts::MAX_NUMBER_OF_MONTHS; ++month) {
+                std::size_t slot{getMonthNameSlot(MONTH_NAMES[month - 1].data())};
+                if (slots.months[slot] == 0) {
+                    slots.months[slot] = month;
+                    ++slots.used;
+                }
+            }
+            return slots;
+        }
+
+        static constexpr MonthNameSlots MONTH_NAME_SLOTS{makeMonthNameSlots()};
+        static_assert(MONTH_NAME_SLOTS.used == consts::MAX_NUMBER_OF_MONTHS, "The month name hash must be perfect.");
+
+        /**
+         * @brief Recognises an English month name, either abbreviated to 3 letters or in full, in any case, e.g.
+         * @c Dec, @c DEC or @c december. The name is hashed once & compared against the single candidate, no strings
+         * are constructed.
+         * @param str
+         *          The start of the name.
+         * @param length
+         *          The number of characters in the name.
+         * @return The month, 1-12, or 0 if it isn't a month name.
+         */
+        constexpr int parseMonthName(const char* str, std::size_t length) {
+            if (length < MONTH_NAME_MIN_LENGTH || length > MONTH_NAME_MAX_LENGTH) {
+                return 0;
+            }
+            int month{MONTH_NAME_SLOTS.months[getMonthNameSlot(str)]};
+            if (month == 0) {
+                return 0;
+            }
+            std::string_view name{MONTH_NAMES[month - 1]};
+            if (length != MONTH_NAME_MIN_LENGTH && length != name.size()) {
+                return 0;
+            }
+            for (std::size_t i{0}; i < length; ++i) {
+                if (toLower(str[i]) != name[i]) {
+                    return 0;
+                }
+            }
+            return month;
+        }
+
+        // English weekday names in lower case for the case insensitive parsers, index 0 is Sunday like
+        // detail::weekdayFromDays. Formatting uses consts::getName & consts::getShortName.
+        static constexpr std::string_view WEEKDAY_NAMES[] {
+            "sunday", "monday", "tuesday", "wednesday", "thursday", "friday", "saturday"
+        };
+
+        /**
+         * @brief Checks if a name is one of the days of the week, either abbreviated to 3 letters or in full, in any
+         * case.
+         * @param name
+         *          The name.
+         * @return @c true if the name is a day of the week, @c false otherwise.
+         */
+        constexpr bool isWeekdayName(std::string_view name) {
+            for (const auto& weekday : WEEKDAY_NAMES) {
+                if ((name.size() == 3 || name.size() == weekday.size()) && toLower(name[0]) == weekday[0] &&
+                    toLower(name[1]) == weekday[1] && toLower(name[2]) == weekday[2]) {
+                    std::size_t i{3};
+                    while (i < name.size() && toLower(name[i]) == weekday[i]) {
+                        ++i;
+                    }
+                    return i == name.size();
+                }
+            }
+            return false;
+        }
+
+        // Fixed width layouts for findLayoutMismatch: 'D' is a digit, 'S' is a date separator, '_' is a digit or a
+        // space & 'A' is a letter of a month name.
+        static constexpr std::string_view YEAR_FIRST_DATE_LAYOUT{"DDDDSDDSDD"};
+        static constexpr std::string_view YEAR_LAST_DATE_LAYOUT{"DDSDDSDDDD"};
+        static constexpr std::string_view TIME_STAMP_LAYOUT{"DD:DD:DD:DDD"};
+        static constexpr std::string_view DATE_TIME_LAYOUT{"DDDD-DD-DDTDD:DD:DD"};
+
+        /**
+         * @brief Finds the first character of a string that doesn't match a fixed width layout. Only used to report
+         * why a parse failed, so it favours simplicity over speed.
+         * @param str
+         *          The string to check.
+         * @param layout
+         *          The layout. 'D' matches any digit, 'S' matches a date separator that must be the same every time,
+         *          '_' matches a digit or a space, 'A' matches any letter & any other character matches itself.
+         * @return The offset of the first mismatch, @c layout.size() if the whole layout matched.
+         */
+        constexpr std::size_t findLayoutMismatch(std::string_view str, std::string_view layout) {
+            char separator{'\0'};
+            for (std::size_t i{0}; i < layout.size(); ++i) {
+                if (i >= str.size()) {
+                    return i;
+                }
+                if (layout[i] == 'D') {
+                    if (!isDigit(str[i])) {
+                        return i;
+                    }
+                } else if (layout[i] == 'S') {
+                    if (!isDateSeparator(str[i]) || (separator != '\0' && str[i] != separator)) {
+                        return i;
+                    }
+                    separator = str[i];
+                } else if (layout[i] == '_') {
+                    if (!isDigit(str[i]) && str[i] != ' ') {
+                        return i;
+                    }
+                } else if (layout[i] == 'A') {
+                    if (!isLetter(str[i])) {
+                        return i;
+                    }
+                } else if (str[i] != layout[i]) {
+                    return i;
+                }
+            }
+            return layout.size();
+        }
+
+        /**
+         * @brief Classifies why a string doesn't match a fixed width layout.
+         * @param str
+         *          The string that was checked.
+         * @param layout
+         *          The layout it was checked against.
+         * @param mismatch
+         *          The offset returned by @c findLayoutMismatch.
+         * @return The parse error.
+         */
+        constexpr ParseError getLayoutError(std::string_view str, std::string_view layout, std::size_t mismatch) {
+            if (mismatch == layout.size()) {
+                return ParseError::TooLong;
+            }
+            if (mismatch >= str.size()) {
+                return ParseError::TooShort;
+            }
+            switch (layout[mismatch]) {
+                case 'D':
+                case '_':
+                    return ParseError::ExpectedDigit;
+                case 'A':
+                    return ParseError::InvalidMonthName;
+                default:
+                    return ParseError::ExpectedSeparator;
+            }
+        }
+
+        /**
+         * @brief Decodes one of the fixed width numeric date layouts: @c XXXX-XX-XX, @c XXXX/XX/XX, @c XX-XX-XXXX or
+         * @c XX/XX/XXXX. Which of the two day/month components is the day is left to the caller.
+         * @param str
+         *          The start of the date, at least @c consts::DATE_STRING_LENGTH characters long.
+         * @param year
+         *          Set to the year component.
+         * @param first
+         *          Set to the first day/month component.
+         * @param second
+         *          Set to the second day/month component.
+         * @return @c true if the characters match one of the layouts, @c false otherwise.
+         */
+        constexpr bool decodeNumericDate(const char* str, int& year, int& first, int& second) {
+            // XXXX-XX-XX or XXXX/XX/XX
+            // 0123456789
+            if (isDateSeparator(str[4]) && str[7] == str[4] &&
+                isDigits(str, 4) && isDigits(str + 5, 2) && isDigits(str + 8, 2)) {
+                year = parseFourDigits(str);
+                first = parseTwoDigits(str + 5);
+                second = parseTwoDigits(str + 8);
+                return true;
+            }
+
+            // XX-XX-XXXX or XX/XX/XXXX
+            // 0123456789
+            if (isDateSeparator(str[2]) && str[5] == str[2] &&
+                isDigits(str, 2) && isDigits(str + 3, 2) && isDigits(str + 6, 4)) {
+                year = parseFourDigits(str + 6);
+                first = parseTwoDigits(str);
+                second = parseTwoDigits(str + 3);
+                return true;
+            }
+            return false;
+        }
+    }
+}
+
+#endif //DATEANDTIME_LIB_PARSEUTILS_HPP
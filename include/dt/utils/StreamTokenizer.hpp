@@ -0,0 +1,165 @@
+/**
+ * @file StreamTokenizer.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_STREAMTOKENIZER_HPP
+#define DATEANDTIME_LIB_STREAMTOKENIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "../time/TimeStamp.hpp"
+#include "ParseResult.hpp"
+#include "ParseUtils.hpp"
+
+namespace dt {
+    /**
+     * @brief @c StreamTokenType enum class.
+     *
+     * What a @c StreamToken holds: a @c Date or a @c TimeStamp.
+     * @namespace @c dt
+     */
+    enum class StreamTokenType : uint8_t {
+        Date,
+        TimeStamp,
+    };
+
+    /**
+     * @brief A date or time stamp found by the @c StreamTokenizer.
+     *
+     * Only the result matching @c type is set, it holds either the parsed value or why the token could not be parsed.
+     * @namespace @c dt
+     */
+    struct StreamToken {
+        StreamTokenType type{StreamTokenType::Date};
+        std::uint64_t offset{0};
+        std::size_t length{0};
+        ParseResult<Date> date{ParseError::None, 0};
+        ParseResult<TimeStamp> timeStamp{ParseError::None, 0};
+    };
+
+    /**
+     * @brief @c StreamTokenizer class.
+     *
+     * Finds dates & time stamps in a stream of bytes that arrives in arbitrary chunks, e.g. socket reads or file
+     * blocks, without copying it into strings first.
+     *
+     * A token is a run of digits, '-', '/' & ':'. Runs of 10 characters are parsed as a @c Date, runs of 12 characters
+     * as a @c TimeStamp & every other run, e.g. a plain number, is skipped. Each token is reported with its byte offset
+     * from the start of the stream, whether or not it could be parsed.
+     *
+     * A token that lies within one chunk is parsed in place. Only a token that straddles two chunks is carried over,
+     * in a small fixed size buffer inside the tokenizer, so nothing is ever allocated.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::StreamTokenizer tokenizer;
+     * auto onToken = [](const dt::StreamToken& token) { ... };
+     * tokenizer.feed("login 2001-12-", onToken);
+     * tokenizer.feed("22 18:46:37:123\n", onToken); // Reports the date at offset 6 & the time stamp at offset 17.
+     * tokenizer.finish(onToken);
+     * @endcode
+     * @namespace @c dt
+     */
+    class StreamTokenizer {
+    public:
+        StreamTokenizer() = default;
+        ~StreamTokenizer() = default;
+
+        template<typename Callback>
+        void feed(std::string_view chunk, Callback&& onToken);
+        template<typename Callback>
+        void finish(Callback&& onToken);
+
+        std::uint64_t getOffset() const;
+        void reset();
+        friend class LogScanner;
+
+    private:
+        static constexpr std::size_t MAX_TOKEN_LENGTH{consts::TIME_STAMP_STRING_LENGTH};
+
+        static bool isTokenChar(char c);
+        static bool makeToken(std::string_view text, std::uint64_t offset, StreamToken& token);
+        void carry(std::string_view text);
+
+        char pending[MAX_TOKEN_LENGTH]{};
+        std::size_t pendingLength{0};
+        std::uint64_t pendingOffset{0};
+        std::uint64_t offset{0};
+    };
+
+    /**
+     * @brief Tokenizes the next chunk of the stream. Every token that ends in this chunk is reported, a token still
+     * running at the end of the chunk is kept until the next call to @c feed or @c finish.
+     * @param chunk
+     *          The next bytes of the stream, only read during the call.
+     * @param onToken
+     *          Called with a @c const @c StreamToken& for every token, in stream order.
+     */
+    template<typename Callback>
+    void StreamTokenizer::feed(std::string_view chunk, Callback&& onToken) {
+        const char* data{chunk.data()};
+        const std::size_t size{chunk.size()};
+        std::size_t i{0};
+        StreamToken token;
+
+        // Finish the token carried over from the previous chunk.
+        if (pendingLength > 0) {
+            while (i < size && isTokenChar(data[i])) {
+                ++i;
+            }
+            carry(chunk.substr(0, i));
+            if (i == size) {
+                offset += size;
+                return;
+            }
+            if (pendingLength <= MAX_TOKEN_LENGTH && makeToken({pending, pendingLength}, pendingOffset, token)) {
+                onToken(static_cast<const StreamToken&>(token));
+            }
+            pendingLength = 0;
+        }
+
+        while (i < size) {
+            while (i < size && !isTokenChar(data[i])) {
+                ++i;
+            }
+            const std::size_t start{i};
+            while (i < size && isTokenChar(data[i])) {
+                ++i;
+            }
+            if (i == size && start < size) {
+                pendingOffset = offset + start;
+                carry(chunk.substr(start));
+                break;
+            }
+            if (start < i && makeToken(chunk.substr(start, i - start), offset + start, token)) {
+                onToken(static_cast<const StreamToken&>(token));
+            }
+        }
+        offset += size;
+    }
+
+    /**
+     * @brief Ends the stream, reporting the token carried over from the last chunk if there is one. The tokenizer
+     * can then be reused for a new stream, see @c reset.
+     * @param onToken
+     *          Called with a @c const @c StreamToken& for the last token.
+     */
+    template<typename Callback>
+    void StreamTokenizer::finish(Callback&& onToken) {
+        StreamToken token;
+        if (pendingLength > 0 && pendingLength <= MAX_TOKEN_LENGTH &&
+            makeToken({pending, pendingLength}, pendingOffset, token)) {
+            onToken(static_cast<const StreamToken&>(token));
+        }
+        reset();
+    }
+}
+
+#endif //DATEANDTIME_LIB_STREAMTOKENIZER_HPP
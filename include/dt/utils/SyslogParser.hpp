@@ -0,0 +1,63 @@
+/**
+ * @file SyslogParser.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#ifndef DATEANDTIME_LIB_SYSLOGPARSER_HPP
+#define DATEANDTIME_LIB_SYSLOGPARSER_HPP
+
+#include <string_view>
+
+#include "../Constants.hpp"
+#include "../date/Date.hpp"
+#include "../time/DateTime.hpp"
+#include "ParseResult.hpp"
+
+namespace dt {
+    /**
+     * @brief @c SyslogParser class.
+     *
+     * Parses the time stamps of syslog lines:
+     * <ul>
+     *  <li>BSD syslog (RFC 3164): @c Oct @c 17 @c 12:34:56, in local time & without a year. The day may be padded
+     *  with a space (@c Oct @c @c 7) or a zero.</li>
+     *  <li>RFC 5424: @c 2023-10-17T12:34:56.123456Z, an RFC 3339 date time with an upper case 'T', a UTC offset &
+     *  at most 6 fraction digits.</li>
+     * </ul>
+     *
+     * The year of a BSD time stamp is inferred from a reference date, e.g. today or the modification date of the log
+     * file. A time stamp up to @c consts::SYSLOG_MAX_MONTHS_AHEAD months after the reference month is taken to be
+     * clock skew, anything later to be from the year before, so @c Dec @c 31 read on the 1st of January is from last
+     * year & @c Jan @c 1 read on the 31st of December is from next year. The year of each month is worked out once,
+     * when the reference is set, so parsing a line is a handful of comparisons & never allocates.
+     *
+     * <b>Example:</b>
+     * @code
+     * dt::SyslogParser parser{dt::Date{5, 1, 2024}};
+     * std::string_view line{"Dec 31 23:59:59 host app[42]: rotated"};
+     * auto time{parser.tryParse(line.substr(0, dt::consts::SYSLOG_TIMESTAMP_STRING_LENGTH))}; // 2023-12-31T23:59:59
+     * @endcode
+     * @namespace @c dt
+     */
+    class SyslogParser {
+    public:
+        explicit SyslogParser(const Date& reference);
+        ~SyslogParser() = default;
+
+        ParseResult<DateTime> tryParse(std::string_view timeStamp) const noexcept;
+        ParseResult<DateTime> tryParseRfc3164(std::string_view timeStamp) const noexcept;
+        static ParseResult<DateTime> tryParseRfc5424(std::string_view timeStamp) noexcept;
+
+        Date getReference() const;
+        void setReference(const Date& reference);
+        int inferYear(int month) const;
+
+    private:
+        Date reference;
+        int years[consts::MAX_NUMBER_OF_MONTHS]{};
+    };
+}
+
+#endif //DATEANDTIME_LIB_SYSLOGPARSER_HPP
@@ -7,7 +7,135 @@
 
 #include "../../include/dt/date/Calendar.hpp"
 
+#include <cstring>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+
 namespace dt {
+    namespace {
+        constexpr int MONTH_WIDTH{20};
+        constexpr int MONTH_GUTTER{2};
+        constexpr int MAX_WEEKS{6};
+        constexpr int MIN_DAYS_IN_MONTH{28};
+        constexpr int CELL_WIDTH{3};
+        constexpr std::string_view WEEKDAY_HEADER{"Mo Tu We Th Fr Sa Su"};
+
+        /**
+         * @brief The week rows of every possible month: a month starts on one of 7 weekdays & has 28-31 days, so the
+         * 28 layouts here cover every month from 1583 to 9999. Built at compile time.
+         */
+        struct MonthGrids {
+            char rows[detail::DAYS_PER_WEEK][4][MAX_WEEKS][MONTH_WIDTH];
+
+            constexpr MonthGrids() : rows{} {
+                for (int firstWeekday{0}; firstWeekday < detail::DAYS_PER_WEEK; ++firstWeekday) {
+                    for (int length{0}; length < 4; ++length) {
+                        for (int week{0}; week < MAX_WEEKS; ++week) {
+                            char* row{rows[firstWeekday][length][week]};
+                            for (int i{0}; i < MONTH_WIDTH; ++i) {
+                                row[i] = ' ';
+                            }
+                            for (int column{0}; column < detail::DAYS_PER_WEEK; ++column) {
+                                const int day{week * detail::DAYS_PER_WEEK + column - firstWeekday + 1};
+                                if (day >= 1 && day <= MIN_DAYS_IN_MONTH + length) {
+                                    row[column * CELL_WIDTH] = day >= 10 ? static_cast<char>('0' + day / 10) : ' ';
+                                    row[column * CELL_WIDTH + 1] = static_cast<char>('0' + day % 10);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        constexpr MonthGrids MONTH_GRIDS{};
+
+        /**
+         * @brief What is needed to render a month, worked out once.
+         */
+        struct MonthLayout {
+            int month;
+            int year;
+            int firstWeekday; // 0 for Monday to 6 for Sunday.
+            int days;
+            int weeks;
+            int highlightDay; // 0 for none.
+        };
+
+        MonthLayout layoutMonth(int month, int year, int highlightDay) {
+            const int firstWeekday{(detail::weekdayFromDays(detail::daysFromCivil(year, month, 1)) + 6) %
+                                   detail::DAYS_PER_WEEK};
+            const int days{DateTimeUtils::daysInMonth(year, month)};
+            const int weeks{(firstWeekday + days + detail::DAYS_PER_WEEK - 1) / detail::DAYS_PER_WEEK};
+            return {month, year, firstWeekday, days, weeks, highlightDay};
+        }
+
+        /**
+         * @brief Writes a two character day cell in @p colour, keeping the padding of a single digit day outside
+         * the colour code.
+         */
+        char* writeColoured(char* out, const char* colour, const char* cell) {
+            if (cell[0] == ' ') {
+                *out++ = ' ';
+            }
+            const std::size_t colourLength{std::strlen(colour)};
+            const std::size_t resetLength{std::strlen(consts::COLOR_RESET)};
+            std::memcpy(out, colour, colourLength);
+            out += colourLength;
+            if (cell[0] != ' ') {
+                *out++ = cell[0];
+            }
+            *out++ = cell[1];
+            std::memcpy(out, consts::COLOR_RESET, resetLength);
+            return out + resetLength;
+        }
+
+        /**
+         * @brief Writes one line of a month, @c MONTH_WIDTH characters wide: the title, the weekday header or a week.
+         */
+        char* writeMonthLine(char* out, const MonthLayout& layout, int line, CalendarStyle style) {
+            if (line == 0) {
+                std::memset(out, ' ', MONTH_WIDTH);
+                const std::string_view name{consts::getShortName(static_cast<consts::Month>(layout.month))};
+                std::memcpy(out, name.data(), name.size());
+                detail::writeFourDigits(out + 4, layout.year);
+                return out + MONTH_WIDTH;
+            }
+            if (line == 1) {
+                std::memcpy(out, WEEKDAY_HEADER.data(), WEEKDAY_HEADER.size());
+                return out + MONTH_WIDTH;
+            }
+
+            const int week{line - 2};
+            if (week >= layout.weeks) {
+                std::memset(out, ' ', MONTH_WIDTH);
+                return out + MONTH_WIDTH;
+            }
+            const char* row{MONTH_GRIDS.rows[layout.firstWeekday][layout.days - MIN_DAYS_IN_MONTH][week]};
+            if (style == CalendarStyle::Plain) {
+                std::memcpy(out, row, MONTH_WIDTH);
+                return out + MONTH_WIDTH;
+            }
+
+            for (int column{0}; column < detail::DAYS_PER_WEEK; ++column) {
+                if (column != 0) {
+                    *out++ = ' ';
+                }
+                const int day{week * detail::DAYS_PER_WEEK + column - layout.firstWeekday + 1};
+                if (day < 1 || day > layout.days) {
+                    out[0] = ' ';
+                    out[1] = ' ';
+                    out += 2;
+                } else {
+                    out = writeColoured(out, day == layout.highlightDay ? consts::COLOR_GREEN : consts::COLOR_WHITE,
+                                        row + column * CELL_WIDTH);
+                }
+            }
+            return out;
+        }
+    }
+
     /**
      * @brief @c Calendar constructor.
      */
@@ -121,11 +249,55 @@ namespace dt {
     }
 
     /**
-     * @brief Converts the calendar to a string.
+     * @brief Converts the calendar to a string, the current month with the current day in green.
      * @return The calendar as a string.
      */
     std::string Calendar::toString() const {
-        return formatCalendar();
+        std::string text(maxLength(), '\0');
+        char* end{toChars(text.data(), text.data() + text.size())};
+        text.resize(end == nullptr ? 0 : static_cast<std::size_t>(end - text.data()));
+        return text;
+    }
+
+    /**
+     * @brief Renders the current month & the months after it into a caller provided buffer, like @c std::to_chars,
+     * with the current day highlighted. The lines are separated by new lines, without one at the end, & the rows of
+     * months by an empty line. Nothing is allocated & no terminating null is written.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, at least @c maxLength(months, monthsPerRow, style).
+     * @param months
+     *          The number of months rendered, e.g. 3 for a quarter.
+     * @param monthsPerRow
+     *          The number of months side by side.
+     * @param style
+     *          Whether the calendar is rendered with colours.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small or a month is
+     * after 9999.
+     */
+    char* Calendar::toChars(char* first, char* last, int months, int monthsPerRow, CalendarStyle style) const {
+        return formatMonths(currentMonth, currentYear, months, monthsPerRow, currentDay, style, first, last);
+    }
+
+    /**
+     * @brief Renders the 12 months of a year into a caller provided buffer, e.g. to render many yearly calendars in
+     * a batch. See @c toChars for the layout.
+     * @param year
+     *          The year.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, at least @c maxLength(12, monthsPerRow, style).
+     * @param monthsPerRow
+     *          The number of months side by side, e.g. 3 for a row per quarter.
+     * @param style
+     *          Whether the calendar is rendered with colours, no day is highlighted.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small or the year
+     * is invalid.
+     */
+    char* Calendar::formatYear(int year, char* first, char* last, int monthsPerRow, CalendarStyle style) {
+        return formatMonths(1, year, consts::MAX_NUMBER_OF_MONTHS, monthsPerRow, 0, style, first, last);
     }
 
     /**
@@ -198,90 +370,70 @@ namespace dt {
     }
 
     /**
-     * @brief Formats the calendar so that it is outputted correctly.
-     * @return Thr formatted calendar.
+     * @brief Renders consecutive months, a row of months at a time.
+     * @param month
+     *          The first month.
+     * @param year
+     *          The year of the first month.
+     * @param months
+     *          The number of months.
+     * @param monthsPerRow
+     *          The number of months side by side.
+     * @param highlightDay
+     *          The day highlighted in the first month, 0 for none.
+     * @param style
+     *          Whether the calendar is rendered with colours.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small or a month is
+     * invalid.
      */
-    std::string Calendar::formatCalendar() const {
-        const std::string monthStr{DateTimeUtils::getMonthShortStr(currentMonth)};
-        std::string currentDayColor{};
-        std::stringstream ss;
-
-        ss << monthStr <<  " " << currentYear << "\n";
-        ss << "Mo Tu We Th Fr Sa Su\n";
-
-        if (dates.at(0).getDayOfWeek() == consts::MONDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << " 1" << consts::COLOR_RESET;
-            } else {
-                ss << " 1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::TUESDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "    1" << consts::COLOR_RESET;
-            } else {
-                ss << "    1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::WEDNESDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "       1" << consts::COLOR_RESET;
-            } else {
-                ss << "       1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::THURSDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "          1" << consts::COLOR_RESET;
-            } else {
-                ss << "          1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::FRIDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "             1" << consts::COLOR_RESET;
-            } else {
-                ss << "             1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::SATURDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "                1" << consts::COLOR_RESET;
-            } else {
-                ss << "                1";
-            }
-        } else if (dates.at(0).getDayOfWeek() == consts::SUNDAY) {
-            if (currentDay == 1) {
-                ss << consts::COLOR_GREEN << "                   1\n" << consts::COLOR_RESET;
-            } else {
-                ss << "                   1\n";
-            }
+    char* Calendar::formatMonths(int month, int year, int months, int monthsPerRow, int highlightDay,
+                                 CalendarStyle style, char* first, char* last) {
+        const int lastMonth{year * 12 + month - 1 + months - 1};
+        if (months < 1 || monthsPerRow < 1 || month < consts::MIN_NUMBER_OF_MONTHS ||
+            month > consts::MAX_NUMBER_OF_MONTHS || monthsPerRow > consts::MAX_NUMBER_OF_MONTHS ||
+            year < consts::MIN_YEAR || lastMonth / 12 > consts::MAX_YEAR ||
+            static_cast<std::size_t>(last - first) < maxLength(months, monthsPerRow, style)) {
+            return nullptr;
         }
 
-        for (int day{2}; day <= dates.size(); ++day) {
-            if (day == currentDay) {
-                currentDayColor = consts::COLOR_GREEN;
-            } else {
-                currentDayColor = consts::COLOR_WHITE;
+        MonthLayout layouts[consts::MAX_NUMBER_OF_MONTHS];
+        char* out{first};
+        for (int rowStart{0}; rowStart < months; rowStart += monthsPerRow) {
+            const int rowLength{std::min(monthsPerRow, months - rowStart)};
+            int weeks{0};
+            for (int i{0}; i < rowLength; ++i) {
+                const int index{year * 12 + month - 1 + rowStart + i};
+                layouts[i] = layoutMonth(index % 12 + 1, index / 12, rowStart + i == 0 ? highlightDay : 0);
+                weeks = std::max(weeks, layouts[i].weeks);
             }
 
-            if (dates.at(day-1).getDayOfWeek() == consts::SUNDAY) {
-                if (day >= 10) {
-                    ss << " " << currentDayColor << day << consts::COLOR_RESET << "\n";
-                } else {
-                    ss << "  " << currentDayColor << day << consts::COLOR_RESET << "\n";
+            if (rowStart != 0) {
+                *out++ = '\n';
+                *out++ = '\n';
+            }
+            for (int line{0}; line < 2 + weeks; ++line) {
+                if (line != 0) {
+                    *out++ = '\n';
                 }
-            } else if (dates.at(day-1).getDayOfWeek() == consts::MONDAY) {
-                if (day >= 10) {
-                    ss << currentDayColor << day << consts::COLOR_RESET;
-                } else {
-                    ss << " " << currentDayColor << day << consts::COLOR_RESET;
+                for (int i{0}; i < rowLength; ++i) {
+                    if (i != 0) {
+                        std::memset(out, ' ', MONTH_GUTTER);
+                        out += MONTH_GUTTER;
+                    }
+                    out = writeMonthLine(out, layouts[i], line, style);
                 }
-            } else {
-                if (day >= 10) {
-                    ss << " " << currentDayColor << day << consts::COLOR_RESET;
-                } else {
-                    ss << "  " << currentDayColor << day << consts::COLOR_RESET;
+                // Lines end where their text ends, e.g. after the last day of a month.
+                while (out[-1] == ' ') {
+                    --out;
                 }
             }
         }
-        return ss.str();
-        }
+        return out;
+    }
 
     /**
      * @brief Overloaded stream output operator.
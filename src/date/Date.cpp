@@ -7,13 +7,77 @@
 
 #include "../../include/dt/date/Date.hpp"
 
+#include <algorithm>
+#include <charconv>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+
 namespace dt {
-    const std::array<std::string, consts::DATE_PATTERNS> Date::datePatterns {
-        "^\\d{4}-\\d{2}-\\d{2}$", // XXXX-XX-XX
-        "^\\d{2}-\\d{2}-\\d{4}$", // XX-XX-XXXX
-        "^\\d{4}/\\d{2}/\\d{2}$", // XXXX/XX/XX
-        "^\\d{2}/\\d{2}/\\d{4}$", // XX/XX/XXXX
-    };
+    namespace {
+        // Bits per word of a validity bitmask, see DateBatchParser.
+        constexpr std::size_t MASK_WORD_BITS{64};
+
+        /**
+         * @brief Skips a run of at most @p maxCount digits.
+         * @return The offset of the first character after the run.
+         */
+        std::size_t skipDigits(std::string_view str, std::size_t i, std::size_t maxCount) {
+            const std::size_t end{std::min(str.size(), i + maxCount)};
+            while (i < end && detail::isDigit(str[i])) {
+                ++i;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Skips a run of letters.
+         * @return The offset of the first character after the run.
+         */
+        std::size_t skipLetters(std::string_view str, std::size_t i) {
+            while (i < str.size() && detail::isLetter(str[i])) {
+                ++i;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Gets the error for an unexpected character at offset @p i, which is @c ParseError::TooShort if the
+         * string already ended.
+         */
+        ParseError getUnexpectedError(std::string_view str, std::size_t i, ParseError error) {
+            return i < str.size() ? error : ParseError::TooShort;
+        }
+
+        // The days since 1970-01-01 of the first & last dates whose year fits the 16 bit year of a Date.
+        constexpr std::int64_t MIN_DAYS{detail::daysFromCivil(INT16_MIN, 1, 1)};
+        constexpr std::int64_t MAX_DAYS{detail::daysFromCivil(INT16_MAX, 12, 31)};
+
+        /**
+         * @brief Checks that the result of date arithmetic can be stored in a @c Date.
+         * @return The days since @c 1970-01-01.
+         * @throws InvalidDateException
+         *          if the year is outside the range of @c std::int16_t.
+         */
+        std::int32_t checkDays(std::int64_t days) {
+            if (days < MIN_DAYS || days > MAX_DAYS) {
+                throw InvalidDateException("Date arithmetic out of range. The year must fit in 16 bits.");
+            }
+            return static_cast<std::int32_t>(days);
+        }
+
+        /**
+         * @brief Gets the days since @c 1970-01-01 of a day of a month, which may be past the end of the month.
+         * @throws InvalidDateException
+         *          if the year is outside the range of @c std::int16_t.
+         */
+        std::int32_t checkDays(std::int64_t year, int month, int day) {
+            if (year < INT16_MIN || year > INT16_MAX) {
+                throw InvalidDateException("Date arithmetic out of range. The year must fit in 16 bits.");
+            }
+            return checkDays(std::int64_t{detail::daysFromCivil(static_cast<int>(year), month, 1)} + day - 1);
+        }
+    }
 
     /**
      * @brief @c Date constructor.
@@ -26,10 +90,7 @@ namespace dt {
      */
     Date::Date(int d, int m, int y) {
         if (isValidDate(d, m, y)) {
-            day = d;
-            month = m;
-            year = y;
-            leapYear = DateTimeUtils::isLeapYear(y);
+            assignDate(d, m, y);
         }
     }
 
@@ -38,10 +99,222 @@ namespace dt {
      * @param date
      *          The string representation of a date to parse.
      */
-    Date::Date(const std::string& date) {
+    Date::Date(std::string_view date) {
         parse(date);
     }
 
+    /**
+     * @brief Parses a string representation of a date without throwing, see @c Date(std::string_view) for the
+     * accepted formats.
+     *
+     * The first day/month component is tried as the day, if that does not give a valid date the components are
+     * swapped. On failure nothing is allocated, the result holds the error & the offset of the offending character
+     * instead.
+     * @param date
+     *          The string representation of a date to parse.
+     * @return The parsed date, or why it could not be parsed.
+     */
+    ParseResult<Date> Date::tryParse(std::string_view date) noexcept {
+        int y{0};
+        int tmp1{0};
+        int tmp2{0};
+        if (date.size() == consts::DATE_STRING_LENGTH && detail::decodeNumericDate(date.data(), y, tmp1, tmp2)) {
+            Date result;
+            if (detail::isValidDate(tmp1, tmp2, y)) {
+                result.assignDate(tmp1, tmp2, y);
+                return result;
+            }
+            if (detail::isValidDate(tmp2, tmp1, y)) {
+                result.assignDate(tmp2, tmp1, y);
+                return result;
+            }
+
+            bool yearFirst{detail::isDateSeparator(date[4])};
+            if (y < consts::MIN_YEAR || y > consts::MAX_YEAR) {
+                return {ParseError::InvalidDate, yearFirst ? std::size_t{0} : std::size_t{6}};
+            }
+            return {ParseError::InvalidDate, yearFirst ? std::size_t{5} : std::size_t{0}};
+        }
+
+        // Report the error against whichever layout the string got furthest into. If both fail at the same
+        // character, a non-digit where one of them expects a separator is reported as a bad separator.
+        std::size_t yearFirstMismatch{detail::findLayoutMismatch(date, detail::YEAR_FIRST_DATE_LAYOUT)};
+        std::size_t yearLastMismatch{detail::findLayoutMismatch(date, detail::YEAR_LAST_DATE_LAYOUT)};
+        if (yearLastMismatch > yearFirstMismatch ||
+            (yearLastMismatch == yearFirstMismatch && yearLastMismatch < consts::DATE_STRING_LENGTH &&
+             detail::YEAR_LAST_DATE_LAYOUT[yearLastMismatch] == 'S')) {
+            return {detail::getLayoutError(date, detail::YEAR_LAST_DATE_LAYOUT, yearLastMismatch), yearLastMismatch};
+        }
+        return {detail::getLayoutError(date, detail::YEAR_FIRST_DATE_LAYOUT, yearFirstMismatch), yearFirstMismatch};
+    }
+
+    /**
+     * @brief Parses a string representation of a date with an English month name without throwing.
+     *
+     * Date formats:
+     * <ul>
+     *  <li>@c 22 Dec 2001 or @c 22 December 2001</li>
+     *  <li>@c 22-DEC-2001 or @c 22-December-2001</li>
+     *  <li>@c December 22, 2001 or @c Dec 22, 2001</li>
+     * </ul>
+     * The day may be a single digit & the month name is case-insensitive, see @c detail::parseMonthName.
+     * @param date
+     *          The string representation of a date to parse.
+     * @return The parsed date, or why it could not be parsed.
+     */
+    ParseResult<Date> Date::tryParseText(std::string_view date) noexcept {
+        const std::size_t size{date.size()};
+        std::size_t i{0};
+        std::size_t dayOffset{0};
+        int d{0};
+        int m{0};
+
+        if (size > 0 && detail::isDigit(date[0])) {
+            // DD Mon YYYY, DD Month YYYY or DD-MON-YYYY
+            i = skipDigits(date, 0, 2);
+            d = detail::parseDigits(date.data(), i);
+            char separator{i < size ? date[i] : '\0'};
+            if (separator != ' ' && separator != consts::DATE_SEPARATOR_DASH) {
+                return {getUnexpectedError(date, i, ParseError::ExpectedSeparator), i};
+            }
+            const std::size_t monthOffset{++i};
+            i = skipLetters(date, i);
+            m = detail::parseMonthName(date.data() + monthOffset, i - monthOffset);
+            if (m == 0) {
+                return {getUnexpectedError(date, monthOffset, ParseError::InvalidMonthName), monthOffset};
+            }
+            if (i >= size || date[i] != separator) {
+                return {getUnexpectedError(date, i, ParseError::ExpectedSeparator), i};
+            }
+            ++i;
+        } else {
+            // Month DD, YYYY or Mon DD, YYYY
+            i = skipLetters(date, 0);
+            m = detail::parseMonthName(date.data(), i);
+            if (m == 0) {
+                return {getUnexpectedError(date, 0, ParseError::InvalidMonthName), 0};
+            }
+            if (i >= size || date[i] != ' ') {
+                return {getUnexpectedError(date, i, ParseError::ExpectedSeparator), i};
+            }
+            dayOffset = ++i;
+            i = skipDigits(date, i, 2);
+            if (i == dayOffset) {
+                return {getUnexpectedError(date, i, ParseError::ExpectedDigit), i};
+            }
+            d = detail::parseDigits(date.data() + dayOffset, i - dayOffset);
+            if (i >= size || date[i] != ',') {
+                return {getUnexpectedError(date, i, ParseError::ExpectedSeparator), i};
+            }
+            if (++i >= size || date[i] != ' ') {
+                return {getUnexpectedError(date, i, ParseError::ExpectedSeparator), i};
+            }
+            ++i;
+        }
+
+        const std::size_t yearOffset{i};
+        i = skipDigits(date, i, 4);
+        if (i - yearOffset != 4) {
+            return {getUnexpectedError(date, i, ParseError::ExpectedDigit), i};
+        }
+        if (i != size) {
+            return {ParseError::TooLong, i};
+        }
+        int y{detail::parseFourDigits(date.data() + yearOffset)};
+        if (!detail::isValidDate(d, m, y)) {
+            bool validYear{y >= consts::MIN_YEAR && y <= consts::MAX_YEAR};
+            return {ParseError::InvalidDate, validYear ? dayOffset : yearOffset};
+        }
+
+        Date result;
+        result.assignDate(d, m, y);
+        return result;
+    }
+
+    /**
+     * @brief Converts a @c YYYYMMDD integer, e.g. @c 20231017 as stored by many warehouse tables, to a date without
+     * going through a string. The components are split with multiplies & shifts instead of divisions & validated
+     * like @c DateTimeUtils::isValidDate.
+     * @param ymd
+     *          The date as a @c YYYYMMDD integer.
+     * @return The date, or @c ParseError::InvalidDate with the offset of the invalid component in the 8 digit
+     * form: 0 for the year, 4 for the month & 6 for the day.
+     */
+    ParseResult<Date> Date::fromYmdInt(std::int32_t ymd) noexcept {
+        int y{0};
+        int m{0};
+        int d{0};
+        detail::decodeYmdInt(static_cast<std::uint32_t>(ymd), y, m, d);
+        if (ymd < 0 || y < consts::MIN_YEAR || y > consts::MAX_YEAR) {
+            return {ParseError::InvalidDate, 0};
+        }
+        if (m < consts::MIN_NUMBER_OF_MONTHS || m > consts::MAX_NUMBER_OF_MONTHS) {
+            return {ParseError::InvalidDate, 4};
+        }
+        if (!detail::isValidDate(d, m, y)) {
+            return {ParseError::InvalidDate, 6};
+        }
+        Date date;
+        date.assignDate(d, m, y);
+        return date;
+    }
+
+    /**
+     * @brief Converts an array of @c YYYYMMDD integers to dates, see @c fromYmdInt.
+     *
+     * The validity bitmask has the layout of the @c DateBatchParser one: bit @c i%64 of word @c i/64 is set if
+     * integer @c i is a valid date. Invalid entries are set to a default constructed @c Date.
+     * @param ymd
+     *          The integers to convert.
+     * @param count
+     *          The number of integers.
+     * @param out
+     *          The preallocated array of at least @p count dates to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c DateBatchParser::validMaskSize(count) words to write to.
+     * @return The number of valid dates.
+     */
+    std::size_t Date::fromYmdInts(const std::int32_t* ymd, std::size_t count, Date* out, std::uint64_t* validMask) {
+        std::size_t valid{0};
+        for (std::size_t begin{0}; begin < count; begin += MASK_WORD_BITS) {
+            const std::size_t size{std::min(MASK_WORD_BITS, count - begin)};
+            std::uint64_t word{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                int y{0};
+                int m{0};
+                int d{0};
+                // A negative integer becomes a year above consts::MAX_YEAR.
+                detail::decodeYmdInt(static_cast<std::uint32_t>(ymd[begin + i]), y, m, d);
+                const bool ok{detail::isValidDate(d, m, y)};
+                Date& date{out[begin + i]};
+                if (ok) {
+                    date.assignDate(d, m, y);
+                } else {
+                    date = Date{};
+                }
+                word |= std::uint64_t{ok} << i;
+                valid += ok;
+            }
+            validMask[begin / MASK_WORD_BITS] = word;
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Converts an array of dates to @c YYYYMMDD integers, see @c toYmdInt.
+     * @param dates
+     *          The dates to convert.
+     * @param count
+     *          The number of dates.
+     * @param out
+     *          The preallocated array of at least @p count integers to write to.
+     */
+    void Date::toYmdInts(const Date* dates, std::size_t count, std::int32_t* out) {
+        for (std::size_t i{0}; i < count; ++i) {
+            out[i] = dates[i].toYmdInt();
+        }
+    }
+
     /**
      * @brief Parses a string representation of a date.
      *
@@ -58,47 +331,65 @@ namespace dt {
      *          The string representation of a date to parse.
      * @throws DateParseException
      *          If the string representation of the date doesn't match a certain pattern.
+     * @throws InvalidDateException
+     *          If the date is invalid.
      */
-    void Date::parse(const std::string& date) {
-        for (const auto& pattern : datePatterns) {
-            std::regex regexPattern{pattern};
-            if (std::regex_match(date, regexPattern)) {
-                convertStrToDate(pattern, date);
-                return;
-            }
+    void Date::parse(std::string_view date) {
+        ParseResult<Date> result{tryParse(date)};
+        if (result) {
+            *this = *result;
+            return;
         }
-        std::string message{"Error parsing date: '" + date + "'. Check formatting."};
+        if (result.getError() == ParseError::InvalidDate) {
+            std::string message{"Error parsing date: '" + std::string{date} + "'. Date is invalid."};
+            throw InvalidDateException(message);
+        }
+        std::string message{"Error parsing date: '" + std::string{date} + "'. Check formatting."};
         throw DateParseException(message);
     }
 
     /**
-     * @brief Adds a specified number of days to the date.
+     * @brief Adds a specified number of days to the date. A default constructed date is left as it is.
      * @param days
      *          The number of days to add.
+     * @throws InvalidDateException
+     *          if the new year is outside the range of @c std::int16_t, the date is then left as it is.
      */
     void Date::addDays(int days) {
-        day += days;
-        adjustDate();
+        if (serial != NO_DATE) {
+            assignDays(checkDays(std::int64_t{serial} + days));
+        }
     }
 
     /**
-     * @brief Adds a specified number of months to the date.
+     * @brief Adds a specified number of months to the date. A day past the end of the new month carries over into
+     * the next one, e.g. @c 31-01-2023 plus one month is @c 03-03-2023. A default constructed date is left as it is.
      * @param months
      *          The number of months to add.
+     * @throws InvalidDateException
+     *          if the new year is outside the range of @c std::int16_t, the date is then left as it is.
      */
     void Date::addMonths(int months) {
-        month += months;
-        adjustDate();
+        if (serial != NO_DATE) {
+            const std::int64_t totalMonths{std::int64_t{year} * consts::MAX_NUMBER_OF_MONTHS + month - 1 + months};
+            const std::int64_t y{detail::floorDivide(totalMonths, consts::MAX_NUMBER_OF_MONTHS)};
+            const auto m{static_cast<int>(totalMonths - y * consts::MAX_NUMBER_OF_MONTHS + 1)};
+            assignDays(checkDays(y, m, day));
+        }
     }
 
     /**
-     * @brief Adds a specified number of years to the date.
+     * @brief Adds a specified number of years to the date. A 29th of February carries over into March in a year
+     * that is not a leap year. A default constructed date is left as it is.
      * @param years
      *          The number of years to add.
+     * @throws InvalidDateException
+     *          if the new year is outside the range of @c std::int16_t, the date is then left as it is.
      */
     void Date::addYears(int years) {
-        year += years;
-        adjustDate();
+        if (serial != NO_DATE) {
+            assignDays(checkDays(std::int64_t{year} + years, month, day));
+        }
     }
 
     /**
@@ -114,10 +405,7 @@ namespace dt {
      */
     void Date::setDate(int d, int m, int y) {
         if (isValidDate(d, m, y)) {
-            day = d;
-            month = m;
-            year = y;
-            leapYear = DateTimeUtils::isLeapYear(y);
+            assignDate(d, m, y);
         } else {
             throw InvalidDateException("Invalid year set. Check formatting.");
         }
@@ -152,20 +440,15 @@ namespace dt {
      * @return The day of the week.
      */
     std::string Date::getDayOfWeek() const {
-        int q{day};
-        int m{month};
-        int Y{month < 3 ? year - 1 : year};
-
-        if (m < 3) {
-            m += 12;
-        }
-
-        int K{Y % 100};
-        int J{Y / 100};
-
-        int h{(q + 13 * (m + 1) / 5 + K + K / 4 + J / 4 + 5 * J) % 7};
+        return std::string{consts::getName(weekday())};
+    }
 
-        return getDayOfWeek((h + 5) % 7);
+    /**
+     * @brief Gets the day of the week that the date corresponds to, as an enum that compares as an integer.
+     * @return The day of the week.
+     */
+    consts::Weekday Date::weekday() const {
+        return detail::isoWeekdayFromDays(serial);
     }
 
     /**
@@ -173,7 +456,7 @@ namespace dt {
      * @return @c true if the year is a leap year, @c false otherwise.
      */
     bool Date::isLeapYear() const {
-        return leapYear;
+        return serial != NO_DATE && detail::isLeapYear(year);
     }
 
     /**
@@ -181,13 +464,67 @@ namespace dt {
      * @return The date as a string.
      */
     std::string Date::toString() const {
-        std::stringstream ss;
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        return {buffer, toChars(buffer, buffer + consts::DATE_MAX_STRING_LENGTH)};
+    }
+
+    /**
+     * @brief Writes the date as @c DD-MM-YYYY into a caller provided buffer, like @c std::to_chars. Nothing is
+     * allocated & no terminating null is written.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer. @c consts::DATE_STRING_LENGTH characters are enough for a
+     *          four digit year & @c consts::DATE_MAX_STRING_LENGTH for any year.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    char* Date::toChars(char* first, char* last) const {
+        constexpr std::ptrdiff_t prefixLength{6}; // DD-MM-
+        if (last - first < prefixLength) {
+            return nullptr;
+        }
+        detail::writeTwoDigits(first, day);
+        first[2] = consts::DATE_SEPARATOR_DASH;
+        detail::writeTwoDigits(first + 3, month);
+        first[5] = consts::DATE_SEPARATOR_DASH;
+        first += prefixLength;
+
+        // A parsed date has a four digit year, any other year, e.g. 10000 after arithmetic or 0 for a default
+        // constructed date, is written without padding.
+        if (year >= 1'000 && year <= 9'999 && last - first >= 4) {
+            detail::writeFourDigits(first, year);
+            return first + 4;
+        }
+        auto [end, error]{std::to_chars(first, last, year)};
+        return error == std::errc{} ? end : nullptr;
+    }
 
-        ss << addLeadingZerosToDateComponent(day) << consts::DATE_SEPARATOR_DASH;
-        ss << addLeadingZerosToDateComponent(month) << consts::DATE_SEPARATOR_DASH;
-        ss << year;
+    /**
+     * @brief Converts the date to a string stored inline, without allocating.
+     * @return The date as an inline string.
+     */
+    InlineString<consts::DATE_MAX_STRING_LENGTH> Date::toInlineString() const {
+        InlineString<consts::DATE_MAX_STRING_LENGTH> string;
+        string.resize(static_cast<std::size_t>(toChars(string.data(), string.data() + string.capacity()) -
+                                               string.data()));
+        return string;
+    }
 
-        return ss.str();
+    /**
+     * @brief Converts the date to a @c YYYYMMDD integer, e.g. @c 20231017, with multiplies only.
+     * @return The date as a @c YYYYMMDD integer, 0 for a default constructed date.
+     */
+    std::int32_t Date::toYmdInt() const {
+        return year * 10'000 + month * 100 + day;
+    }
+
+    /**
+     * @brief Gets the number of days since @c 1970-01-01, negative for earlier dates. Two dates are the same number
+     * of days apart as their serials.
+     * @return The days since @c 1970-01-01, @c INT32_MIN for a default constructed date.
+     */
+    std::int32_t Date::toDays() const {
+        return serial;
     }
 
     /**
@@ -198,13 +535,7 @@ namespace dt {
      * @return @c true if the current date is earlier than the given date, @c false otherwise.
      */
     bool Date::operator<(const dt::Date& other) const {
-        if (year != other.year) {
-            return year < other.year;
-        }
-        if (month != other.month) {
-            return month < other.month;
-        }
-        return day < other.day;
+        return serial < other.serial;
     }
 
     /**
@@ -248,7 +579,7 @@ namespace dt {
      * @return @c true if the dates are equal, @c false otherwise.
      */
     bool Date::operator==(const Date& other) const {
-        return year == other.year && month == other.month && day == other.day;
+        return serial == other.serial;
     }
 
     /**
@@ -273,139 +604,40 @@ namespace dt {
      * @return @c true if the date is valid, @c false otherwise.
      */
     bool Date::isValidDate(int d, int m, int y) {
-        return DateTimeUtils::isValidDate(d, m, y);
+        return detail::isValidDate(d, m, y);
     }
 
 
     /**
-     * @brief Adjusts the date to ensure that the day, month, and year components are valid and represent a valid date.
-     */
-    void Date::adjustDate() {
-        if (month == consts::MONTHS_ADJUST_UPPER) {
-            month = consts::MIN_NUMBER_OF_MONTHS;
-            ++year;
-        } else if (month > consts::MONTHS_ADJUST_UPPER) {
-            month = consts::MIN_NUMBER_OF_MONTHS + (month - consts::MONTHS_ADJUST_UPPER);
-            ++year;
-        }
-
-        if (month == consts::MONTHS_ADJUST_LOWER) {
-            month = consts::MAX_NUMBER_OF_MONTHS;
-            --year;
-        } else {
-            while (month < consts::MONTHS_ADJUST_LOWER) {
-                month = consts::MAX_NUMBER_OF_MONTHS - (std::abs(month));
-                --year;
-            }
-        }
-
-        while (day > DateTimeUtils::daysInMonth(year, month)) {
-            day -= DateTimeUtils::daysInMonth(year, month);
-            ++month;
-            if (month > consts::MAX_NUMBER_OF_MONTHS) {
-                month = consts::MIN_NUMBER_OF_MONTHS;
-                ++year;
-            }
-        }
-
-        while (day < consts::MIN_NUMBER_OF_MONTHS) {
-            --month;
-            if (month < consts::MIN_NUMBER_OF_MONTHS) {
-                month = consts::MAX_NUMBER_OF_MONTHS;
-                --year;
-            }
-            day += DateTimeUtils::daysInMonth(year, month);
-        }
-    }
-
-    /**
-     * @brief Formats a date component by adding a leading '0' if the component is below 10.
-     * @param component
-     *          The date component to format, e.g. day, month.
-     * @return The formatted component.
+     * @brief Sets the date components. The date must already have been validated.
+     * @param d
+     *          The day.
+     * @param m
+     *          The month.
+     * @param y
+     *          The year.
      */
-    std::string Date::addLeadingZerosToDateComponent(int component) const {
-        return (component < 10) ? consts::LEADING_ZERO + std::to_string(component) : std::to_string(component);
+    void Date::assignDate(int d, int m, int y) {
+        serial = detail::daysFromCivil(y, m, d);
+        day = static_cast<std::uint8_t>(d);
+        month = static_cast<std::uint8_t>(m);
+        year = static_cast<std::int16_t>(y);
     }
 
     /**
-     * @brief Extracts the date components from a valid string representation of a date. The day, month, year
-     * components are set if the date is valid.
-     * @param pattern
-     *          The date pattern.
-     * @param date
-     *          The string representation of the date.
-     * @throws InvalidDateException
-     *          If the date is invalid.
+     * @brief Sets the date from a number of days since @c 1970-01-01.
+     * @param days
+     *          The days since @c 1970-01-01.
      */
-    void Date::convertStrToDate(std::string_view pattern, const std::string& date) {
-        // XXXX-XX-XX
-        if (pattern == datePatterns.at(0) || pattern == datePatterns.at(2)) {
-            int y{std::stoi(date.substr(0, 4))}; // Start (Year)
-            int tmp1{std::stoi(date.substr(5, 2))}; // Middle (Day/Month)
-            int tmp2{std::stoi(date.substr(8, 2))}; // End (Day/Month)
-
-            if (isValidDate(tmp1, tmp2, y)) {
-                day = tmp1;
-                month = tmp2;
-                year = y;
-                leapYear = DateTimeUtils::isLeapYear(y);
-            } else if (isValidDate(tmp2, tmp1, y)) {
-                day = tmp2;
-                month = tmp1;
-                year = y;
-                leapYear = DateTimeUtils::isLeapYear(y);
-            } else {
-                std::string message{"Error parsing date: '" + date + "'. Date is invalid."};
-                throw InvalidDateException(message);
-            }
-        }
-        // XX-XX-XXXX
-        else {
-            int tmp1{std::stoi(date.substr(0, 2))}; // Start (Day/Month)
-            int tmp2{std::stoi(date.substr(3, 2))}; // Middle (Day/Month)
-            int y{std::stoi(date.substr(6, 4))}; // End (Year)
-
-            if (isValidDate(tmp1, tmp2, y)) {
-                day = tmp1;
-                month = tmp2;
-                year = y;
-                leapYear = DateTimeUtils::isLeapYear(y);
-            } else if (isValidDate(tmp2, tmp1, y)) {
-                day = tmp2;
-                month = tmp1;
-                year = y;
-                leapYear = DateTimeUtils::isLeapYear(y);
-            } else {
-                std::string message{"Error parsing date: '" + date + "'. Date is invalid."};
-                throw InvalidDateException(message);
-            }
-        }
-    }
-
-    /**
-     * @brief Gets the day of the week that the date corresponds to as a string.
-     * @param d
-     *          The day of the week integer representation.
-     * @return The day of the way as a string.
-     */
-    std::string Date::getDayOfWeek(int d) const {
-        switch (d) {
-            default:
-                return consts::MONDAY;
-            case 1:
-                return consts::TUESDAY;
-            case 2:
-                return consts::WEDNESDAY;
-            case 3:
-                return consts::THURSDAY;
-            case 4:
-                return consts::FRIDAY;
-            case 5:
-                return consts::SATURDAY;
-            case 6:
-                return consts::SUNDAY;
-        }
+    void Date::assignDays(std::int32_t days) {
+        int d{0};
+        int m{0};
+        int y{0};
+        detail::civilFromDays(days, y, m, d);
+        serial = days;
+        day = static_cast<std::uint8_t>(d);
+        month = static_cast<std::uint8_t>(m);
+        year = static_cast<std::int16_t>(y);
     }
 
     /**
@@ -417,7 +649,8 @@ namespace dt {
      * @return The output stream.
      */
     std::ostream& operator<<(std::ostream& os, const dt::Date& date) {
-        os << date.toString();
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        os.write(buffer, date.toChars(buffer, buffer + consts::DATE_MAX_STRING_LENGTH) - buffer);
         return os;
     }
 }
\ No newline at end of file
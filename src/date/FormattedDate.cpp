@@ -7,6 +7,8 @@
 
 #include "../../include/dt/date/FormattedDate.hpp"
 
+#include <cstring>
+
 namespace dt {
     /**
      * @brief @c FormattedDate constructor.
@@ -21,7 +23,7 @@ namespace dt {
      */
     FormattedDate::FormattedDate(int d, int m, int y, DateFormat format)
         : date{d, m, y},
-          format{format} {
+          dateFormat{format} {
     }
 
     /**
@@ -31,9 +33,9 @@ namespace dt {
      * @param format
      *          The date format.
      */
-    FormattedDate::FormattedDate(const std::string& date, DateFormat format)
+    FormattedDate::FormattedDate(std::string_view date, DateFormat format)
         : date{date},
-          format{format} {
+          dateFormat{format} {
     }
 
     /**
@@ -45,7 +47,7 @@ namespace dt {
      */
     FormattedDate::FormattedDate(const dt::Date& date, DateFormat format)
         : date{date},
-          format{format} {
+          dateFormat{format} {
     }
 
     /**
@@ -130,6 +132,14 @@ namespace dt {
         return date.getDayOfWeek();
     }
 
+    /**
+     * @brief Gets the day of the week that the date corresponds to, as an enum that compares as an integer.
+     * @return The day of the week.
+     */
+    consts::Weekday FormattedDate::weekday() const {
+        return date.weekday();
+    }
+
     /**
      * @brief Checks if the year is a leap year.
      * @return @c true if the year is a leap year, @c false otherwise.
@@ -139,54 +149,85 @@ namespace dt {
     }
 
     /**
-     * @brief Converts the date to a string.
-     * @return The date as a string.
+     * @brief Gets the date format.
+     * @return The date format.
      */
-    std::string FormattedDate::toString() const {
-        std::stringstream ss;
-        switch (format) {
+    DateFormat FormattedDate::getFormat() const {
+        return dateFormat;
+    }
+
+    /**
+     * @brief Writes the date in its format. Nothing is allocated & no terminating null is written.
+     * @param out
+     *          The buffer to write to, at least @c consts::DATE_MAX_STRING_LENGTH characters long, or
+     *          @c consts::DATE_STRING_LENGTH if the year has four digits.
+     * @return A pointer one past the last character written.
+     * @see @c BasicFormattedDate::format for how a year outside 1000-9999 is written.
+     */
+    char* FormattedDate::format(char* out) const {
+        switch (dateFormat) {
             case DateFormat::DD_MM_YYYY:
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_DASH;
-                ss << date.getYear();
-                break;
+                return BasicFormattedDate<DateFormat::DD_MM_YYYY>{date}.format(out);
             case DateFormat::MM_DD_YYYY:
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_DASH;
-                ss << date.getYear();
-                break;
+                return BasicFormattedDate<DateFormat::MM_DD_YYYY>{date}.format(out);
             case DateFormat::YYYY_MM_DD:
-                ss << date.getYear() << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getDay());
-                break;
+                return BasicFormattedDate<DateFormat::YYYY_MM_DD>{date}.format(out);
             case DateFormat::YYYY_DD_MM:
-                ss << date.getYear() << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_DASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth());
-                break;
+                return BasicFormattedDate<DateFormat::YYYY_DD_MM>{date}.format(out);
             case DateFormat::DD__MM__YYYY:
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_SLASH;
-                ss << date.getYear();
-                break;
+                return BasicFormattedDate<DateFormat::DD__MM__YYYY>{date}.format(out);
             case DateFormat::MM__DD__YYYY:
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_SLASH;
-                ss << date.getYear();
-                break;
+                return BasicFormattedDate<DateFormat::MM__DD__YYYY>{date}.format(out);
             case DateFormat::YYYY__MM__DD:
-                ss << date.getYear() << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth()) << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getDay());
-                break;
+                return BasicFormattedDate<DateFormat::YYYY__MM__DD>{date}.format(out);
             case DateFormat::YYYY__DD__MM:
-                ss << date.getYear() << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getDay()) << consts::DATE_SEPARATOR_SLASH;
-                ss << addLeadingZerosToDateComponent(date.getMonth());
-                break;
+                return BasicFormattedDate<DateFormat::YYYY__DD__MM>{date}.format(out);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Writes the date in its format into a caller provided buffer, like @c std::to_chars. Nothing is
+     * allocated & no terminating null is written.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer. @c consts::DATE_STRING_LENGTH characters are enough for a
+     *          four digit year & @c consts::DATE_MAX_STRING_LENGTH for any year.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    char* FormattedDate::toChars(char* first, char* last) const {
+        const int year{date.getYear()};
+        if (last - first >= consts::DATE_MAX_STRING_LENGTH ||
+            (last - first >= consts::DATE_STRING_LENGTH && year >= 1'000 && year <= 9'999)) {
+            return format(first);
+        }
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        const std::ptrdiff_t length{format(buffer) - buffer};
+        if (last - first < length) {
+            return nullptr;
         }
-        return ss.str();
+        std::memcpy(first, buffer, static_cast<std::size_t>(length));
+        return first + length;
+    }
+
+    /**
+     * @brief Converts the date to a string.
+     * @return The date as a string.
+     */
+    std::string FormattedDate::toString() const {
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        return {buffer, format(buffer)};
+    }
+
+    /**
+     * @brief Converts the date to a string stored inline, without allocating.
+     * @return The date as an inline string.
+     */
+    InlineString<consts::DATE_MAX_STRING_LENGTH> FormattedDate::toInlineString() const {
+        InlineString<consts::DATE_MAX_STRING_LENGTH> string;
+        string.resize(static_cast<std::size_t>(format(string.data()) - string.data()));
+        return string;
     }
 
     /**
@@ -255,16 +296,6 @@ namespace dt {
         return !(*this == other);
     }
 
-    /**
-     * @brief Formats a date component by adding a leading '0' if the component is below 10.
-     * @param component
-     *          The date component to format, e.g. day, month.
-     * @return The formatted component.
-     */
-    std::string FormattedDate::addLeadingZerosToDateComponent(int component) const {
-        return (component < 10) ? consts::LEADING_ZERO + std::to_string(component) : std::to_string(component);
-    }
-
     /**
      * @brief Overloaded stream output operator.
      * @param os
@@ -274,7 +305,8 @@ namespace dt {
      * @return The output stream.
      */
     std::ostream& operator<<(std::ostream& os, const FormattedDate& date) {
-        os << date.toString();
+        char buffer[consts::DATE_MAX_STRING_LENGTH];
+        os.write(buffer, date.format(buffer) - buffer);
         return os;
     }
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+/**
+ * @file CurrentTime.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/time/CurrentTime.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+#include "../../include/dt/utils/ParseUtils.hpp"
+
+namespace dt {
+    namespace {
+        constexpr std::size_t SECOND_LENGTH{8}; // HH:MM:SS
+        constexpr std::int64_t MILLISECONDS_PER_SECOND{1'000};
+
+        /**
+         * @brief The last second formatted & its @c HH:MM:SS, guarded by a sequence lock like the second cache of
+         * @c HttpDate. On its own cache line, as every logging thread reads it.
+         */
+        struct alignas(64) SecondCache {
+            std::atomic<std::uint64_t> sequence{0};
+            std::atomic<std::int64_t> second{LLONG_MIN};
+            std::atomic<std::uint64_t> text{0};
+        };
+
+        SecondCache secondCache;
+
+        static_assert(sizeof(std::uint64_t) == SECOND_LENGTH);
+
+        /**
+         * @brief Copies the cached @c HH:MM:SS of a second.
+         * @return @c true if @p second was cached & copied to @p out, @c false otherwise.
+         */
+        bool readSecondCache(std::int64_t second, char* out) {
+            std::uint64_t before{secondCache.sequence.load(std::memory_order_acquire)};
+            if ((before & 1) != 0) {
+                return false;
+            }
+            std::int64_t cachedSecond{secondCache.second.load(std::memory_order_relaxed)};
+            std::uint64_t text{secondCache.text.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (secondCache.sequence.load(std::memory_order_relaxed) != before || cachedSecond != second) {
+                return false;
+            }
+            std::memcpy(out, &text, SECOND_LENGTH);
+            return true;
+        }
+
+        /**
+         * @brief Caches the @c HH:MM:SS of a second, unless another thread is already writing one.
+         */
+        void writeSecondCache(std::int64_t second, const char* out) {
+            std::uint64_t before{secondCache.sequence.load(std::memory_order_relaxed)};
+            if ((before & 1) != 0 ||
+                !secondCache.sequence.compare_exchange_strong(before, before + 1, std::memory_order_relaxed)) {
+                return;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::uint64_t text{0};
+            std::memcpy(&text, out, SECOND_LENGTH);
+            secondCache.text.store(text, std::memory_order_relaxed);
+            secondCache.second.store(second, std::memory_order_relaxed);
+            secondCache.sequence.store(before + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief Writes the @c HH:MM:SS of a second since the epoch in local time. Uses @c localtime_r, or
+         * @c localtime_s on Windows, which unlike @c std::localtime are thread safe. A leap second is written as
+         * second 59.
+         */
+        void formatLocalSecond(std::int64_t second, char* out) {
+            const auto time{static_cast<std::time_t>(second)};
+            std::tm local{};
+#ifdef _WIN32
+            localtime_s(&local, &time);
+#else
+            localtime_r(&time, &local);
+#endif
+            detail::writeTwoDigits(out, local.tm_hour);
+            out[2] = consts::TIME_SEPARATOR;
+            detail::writeTwoDigits(out + 3, local.tm_min);
+            out[5] = consts::TIME_SEPARATOR;
+            detail::writeTwoDigits(out + 6, std::min(local.tm_sec, 59));
+        }
+    }
+
+    /**
+     * @brief Writes a time point as a local @c HH:MM:SS:mmm. Formatting a time point in the same second as the last
+     * one, from any thread, copies the cached @c HH:MM:SS. Nothing is allocated & no terminating null is written.
+     * @param time
+     *          The time point, truncated to the millisecond.
+     * @param out
+     *          The buffer to write to, at least @c consts::TIME_STAMP_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written.
+     */
+    char* CurrentTime::format(std::chrono::system_clock::time_point time, char* out) {
+        const std::int64_t milliseconds{std::chrono::floor<std::chrono::milliseconds>(time.time_since_epoch()).count()};
+        const std::int64_t second{detail::floorDivide(milliseconds, MILLISECONDS_PER_SECOND)};
+        if (!readSecondCache(second, out)) {
+            formatLocalSecond(second, out);
+            writeSecondCache(second, out);
+        }
+        out[SECOND_LENGTH] = consts::TIME_SEPARATOR;
+        detail::writeThreeDigits(out + SECOND_LENGTH + 1,
+                                 static_cast<int>(milliseconds - second * MILLISECONDS_PER_SECOND));
+        return out + consts::TIME_STAMP_STRING_LENGTH;
+    }
+
+    /**
+     * @brief Writes the current local time as @c HH:MM:SS:mmm, see
+     * @c format(std::chrono::system_clock::time_point, char*).
+     * @param out
+     *          The buffer to write to, at least @c consts::TIME_STAMP_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written.
+     */
+    char* CurrentTime::formatNow(char* out) {
+        return format(std::chrono::system_clock::now(), out);
+    }
+
+    /**
+     * @brief Gets the current local time as @c HH:MM:SS:mmm, without allocating.
+     * @return The current time as an inline string.
+     */
+    InlineString<consts::TIME_STAMP_STRING_LENGTH> CurrentTime::toInlineString() {
+        InlineString<consts::TIME_STAMP_STRING_LENGTH> string;
+        string.resize(static_cast<std::size_t>(formatNow(string.data()) - string.data()));
+        return string;
+    }
+
+    /**
+     * @brief Gets the current local time as a time stamp, decoded from the cached digits rather than parsed.
+     * @return The current time stamp.
+     */
+    TimeStamp CurrentTime::getTimeStamp() {
+        char buffer[consts::TIME_STAMP_STRING_LENGTH];
+        formatNow(buffer);
+        return {detail::parseTwoDigits(buffer), detail::parseTwoDigits(buffer + 3), detail::parseTwoDigits(buffer + 6),
+                detail::parseThreeDigits(buffer + 9)};
+    }
+}
@@ -0,0 +1,528 @@
+/**
+ * @file DateTime.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/time/DateTime.hpp"
+
+namespace dt {
+    /**
+     * @brief @c DateTime constructor, for a local date time without a UTC offset.
+     * @param date
+     *          The date.
+     * @param h
+     *          The hour.
+     * @param m
+     *          The minute.
+     * @param s
+     *          The second.
+     * @param nano
+     *          The nanosecond.
+     */
+    DateTime::DateTime(const Date& date, int h, int m, int s, int nano) {
+        if (isValidTime(h, m, s, nano)) {
+            this->date = date;
+            hour = h;
+            minute = m;
+            second = s;
+            nanosecond = nano;
+        }
+    }
+
+    /**
+     * @brief @c DateTime constructor.
+     * @param date
+     *          The date.
+     * @param h
+     *          The hour.
+     * @param m
+     *          The minute.
+     * @param s
+     *          The second.
+     * @param nano
+     *          The nanosecond.
+     * @param offsetMinutes
+     *          The UTC offset in minutes, e.g. 60 for @c +01:00.
+     */
+    DateTime::DateTime(const Date& date, int h, int m, int s, int nano, int offsetMinutes) {
+        if (isValidTime(h, m, s, nano) && isValidOffset(offsetMinutes)) {
+            this->date = date;
+            hour = h;
+            minute = m;
+            second = s;
+            nanosecond = nano;
+            utcOffsetMinutes = offsetMinutes;
+            utcOffset = true;
+        }
+    }
+
+    /**
+     * @brief @c DateTime constructor, for a local date time without a UTC offset.
+     * @param date
+     *          The date.
+     * @param timeStamp
+     *          The time of day.
+     */
+    DateTime::DateTime(const Date& date, const TimeStamp& timeStamp)
+        : DateTime{date, timeStamp.getHour(), timeStamp.getMinute(), timeStamp.getSecond(),
+                   timeStamp.getMillisecond() * consts::NANOSECONDS_PER_MILLISECOND} {
+    }
+
+    /**
+     * @brief @c DateTime constructor for already validated components, used by @c tryParse.
+     * @param date
+     *          The date.
+     * @param h
+     *          The hour.
+     * @param m
+     *          The minute.
+     * @param s
+     *          The second.
+     * @param nano
+     *          The nanosecond.
+     * @param offsetMinutes
+     *          The UTC offset in minutes, ignored if @p hasOffset is @c false.
+     * @param hasOffset
+     *          If the date time has a UTC offset.
+     */
+    DateTime::DateTime(const Date& date, int h, int m, int s, int nano, int offsetMinutes, bool hasOffset)
+        : date{date},
+          hour{h},
+          minute{m},
+          second{s},
+          nanosecond{nano},
+          utcOffsetMinutes{offsetMinutes},
+          utcOffset{hasOffset} {
+    }
+
+    /**
+     * @brief @c DateTime constructor.
+     * @param dateTime
+     *          The ISO 8601 / RFC 3339 string representation of a date time to parse, see @c tryParse.
+     * @throws DateParseException
+     *          If the string representation of the date time doesn't match the format.
+     * @throws InvalidDateException
+     *          If the date is invalid.
+     * @throws InvalidTimeException
+     *          If the time or UTC offset is invalid.
+     */
+    DateTime::DateTime(std::string_view dateTime) {
+        ParseResult<DateTime> result{tryParse(dateTime)};
+        if (result) {
+            *this = *result;
+            return;
+        }
+        std::string message{"Error parsing date time: '" + std::string{dateTime} + "'. "};
+        switch (result.getError()) {
+            case ParseError::InvalidDate:
+                throw InvalidDateException(message + "Date is invalid.");
+            case ParseError::InvalidTime:
+            case ParseError::InvalidUtcOffset:
+                throw InvalidTimeException(message + "Time is invalid.");
+            default:
+                throw DateParseException(message + "Check formatting.");
+        }
+    }
+
+    /**
+     * @brief Parses an ISO 8601 / RFC 3339 string representation of a date time without throwing, in a single pass
+     * over the characters & without allocating.
+     *
+     * Format: @c YYYY-MM-DDTHH:MM:SS[.fraction][offset]
+     * <ul>
+     *  <li>The date & time may also be separated by a 't' or a space.</li>
+     *  <li>The fraction is introduced by a '.' or a ',' & has at least one digit. Digits after the ninth are
+     *  ignored, i.e. the time is truncated to the nanosecond.</li>
+     *  <li>The offset is 'Z', 'z', @c ±HH:MM, @c ±HHMM or @c ±HH. Without an offset the date time is local.</li>
+     *  <li>Leap seconds (@c :60) are rejected.</li>
+     * </ul>
+     * <b>Example:</b> @c 2023-07-09T18:46:37.123456Z
+     * @param dateTime
+     *          The string representation of a date time to parse.
+     * @return The parsed date time, or why it could not be parsed.
+     */
+    ParseResult<DateTime> DateTime::tryParse(std::string_view dateTime) noexcept {
+        // YYYY-MM-DDTHH:MM:SS
+        // 0123456789012345678
+        const char* str{dateTime.data()};
+        const std::size_t size{dateTime.size()};
+        const bool matched{size >= detail::DATE_TIME_LAYOUT.size() &&
+                           str[4] == consts::DATE_SEPARATOR_DASH && str[7] == consts::DATE_SEPARATOR_DASH &&
+                           (str[10] == consts::DATE_TIME_SEPARATOR || str[10] == 't' || str[10] == ' ') &&
+                           str[13] == consts::TIME_SEPARATOR && str[16] == consts::TIME_SEPARATOR &&
+                           detail::isDigits(str, 4) && detail::isDigits(str + 5, 2) &&
+                           detail::isDigits(str + 8, 2) && detail::isDigits(str + 11, 2) &&
+                           detail::isDigits(str + 14, 2) && detail::isDigits(str + 17, 2)};
+        if (!matched) {
+            std::size_t mismatch{detail::findLayoutMismatch(dateTime, detail::DATE_TIME_LAYOUT)};
+            if (mismatch == 10 && size > 10 && (str[10] == 't' || str[10] == ' ')) {
+                mismatch = 11 + detail::findLayoutMismatch(dateTime.substr(11), detail::DATE_TIME_LAYOUT.substr(11));
+            }
+            return {detail::getLayoutError(dateTime, detail::DATE_TIME_LAYOUT, mismatch), mismatch};
+        }
+
+        int y{detail::parseFourDigits(str)};
+        int mo{detail::parseTwoDigits(str + 5)};
+        int d{detail::parseTwoDigits(str + 8)};
+        if (!detail::isValidDate(d, mo, y)) {
+            if (y < consts::MIN_YEAR || y > consts::MAX_YEAR) {
+                return {ParseError::InvalidDate, 0};
+            }
+            if (mo < consts::MIN_NUMBER_OF_MONTHS || mo > consts::MAX_NUMBER_OF_MONTHS) {
+                return {ParseError::InvalidDate, 5};
+            }
+            return {ParseError::InvalidDate, 8};
+        }
+
+        int h{detail::parseTwoDigits(str + 11)};
+        int mi{detail::parseTwoDigits(str + 14)};
+        int s{detail::parseTwoDigits(str + 17)};
+        if (h > consts::HOUR_MAX) {
+            return {ParseError::InvalidTime, 11};
+        }
+        if (mi > consts::MINUTE_MAX) {
+            return {ParseError::InvalidTime, 14};
+        }
+        if (s > consts::SECOND_MAX) {
+            return {ParseError::InvalidTime, 17};
+        }
+
+        int nano{0};
+        int offsetMinutes{0};
+        bool hasOffset{false};
+        std::size_t i{detail::DATE_TIME_LAYOUT.size()};
+        if (i < size && (str[i] == '.' || str[i] == ',')) {
+            constexpr auto maxDigits{static_cast<std::size_t>(consts::FRACTION_MAX_DIGITS)};
+            const std::size_t fractionStart{++i};
+            for (; i < size && detail::isDigit(str[i]); ++i) {
+                if (i - fractionStart < maxDigits) {
+                    nano = nano * 10 + (str[i] - '0');
+                }
+            }
+            if (i == fractionStart) {
+                return {i < size ? ParseError::ExpectedDigit : ParseError::TooShort, i};
+            }
+            for (std::size_t digits{i - fractionStart}; digits < maxDigits; ++digits) {
+                nano *= 10;
+            }
+        }
+
+        if (i < size && (str[i] == consts::UTC_DESIGNATOR || str[i] == 'z')) {
+            hasOffset = true;
+            ++i;
+        } else if (i < size && (str[i] == '+' || str[i] == '-')) {
+            // ±HH, ±HHMM or ±HH:MM
+            const std::size_t offsetStart{++i};
+            if (!(i + 2 <= size && detail::isDigits(str + i, 2))) {
+                std::size_t error{i < size && detail::isDigit(str[i]) ? i + 1 : i};
+                return {error < size ? ParseError::ExpectedDigit : ParseError::TooShort, error};
+            }
+            int offsetHours{detail::parseTwoDigits(str + i)};
+            i += 2;
+            if (i < size && (str[i] == consts::TIME_SEPARATOR || detail::isDigit(str[i]))) {
+                if (str[i] == consts::TIME_SEPARATOR) {
+                    ++i;
+                }
+                if (!(i + 2 <= size && detail::isDigits(str + i, 2))) {
+                    std::size_t error{i < size && detail::isDigit(str[i]) ? i + 1 : i};
+                    return {error < size ? ParseError::ExpectedDigit : ParseError::TooShort, error};
+                }
+                offsetMinutes = detail::parseTwoDigits(str + i);
+                i += 2;
+            }
+            if (offsetHours > consts::HOUR_MAX || offsetMinutes > consts::MINUTE_MAX) {
+                return {ParseError::InvalidUtcOffset, offsetStart};
+            }
+            offsetMinutes += offsetHours * 60;
+            offsetMinutes = str[offsetStart - 1] == '-' ? -offsetMinutes : offsetMinutes;
+            hasOffset = true;
+        }
+
+        if (i != size) {
+            return {ParseError::TooLong, i};
+        }
+        Date date;
+        date.assignDate(d, mo, y);
+        return DateTime{date, h, mi, s, nano, offsetMinutes, hasOffset};
+    }
+
+    /**
+     * @brief Gets the date.
+     * @return The date.
+     */
+    Date DateTime::getDate() const {
+        return date;
+    }
+
+    /**
+     * @brief Gets the time of day, truncated to the millisecond.
+     * @return The time of day.
+     */
+    TimeStamp DateTime::getTimeStamp() const {
+        return {hour, minute, second, nanosecond / consts::NANOSECONDS_PER_MILLISECOND};
+    }
+
+    /**
+     * @brief Gets the year.
+     * @return The year.
+     */
+    int DateTime::getYear() const {
+        return date.getYear();
+    }
+
+    /**
+     * @brief Gets the month.
+     * @return The month.
+     */
+    int DateTime::getMonth() const {
+        return date.getMonth();
+    }
+
+    /**
+     * @brief Gets the day.
+     * @return The day.
+     */
+    int DateTime::getDay() const {
+        return date.getDay();
+    }
+
+    /**
+     * @brief Gets the hour.
+     * @return The hour.
+     */
+    int DateTime::getHour() const {
+        return hour;
+    }
+
+    /**
+     * @brief Gets the minute.
+     * @return The minute.
+     */
+    int DateTime::getMinute() const {
+        return minute;
+    }
+
+    /**
+     * @brief Gets the second.
+     * @return The second.
+     */
+    int DateTime::getSecond() const {
+        return second;
+    }
+
+    /**
+     * @brief Gets the millisecond of the second.
+     * @return The millisecond.
+     */
+    int DateTime::getMillisecond() const {
+        return nanosecond / consts::NANOSECONDS_PER_MILLISECOND;
+    }
+
+    /**
+     * @brief Gets the nanosecond of the second.
+     * @return The nanosecond.
+     */
+    int DateTime::getNanosecond() const {
+        return nanosecond;
+    }
+
+    /**
+     * @brief Checks if the date time has a UTC offset, i.e. if it is an instant rather than a local date time.
+     * @return @c true if the date time has a UTC offset, @c false otherwise.
+     */
+    bool DateTime::hasUtcOffset() const {
+        return utcOffset;
+    }
+
+    /**
+     * @brief Gets the UTC offset.
+     * @return The UTC offset in minutes, 0 if the date time doesn't have one.
+     */
+    int DateTime::getUtcOffsetMinutes() const {
+        return utcOffsetMinutes;
+    }
+
+    /**
+     * @brief Writes the date time as an RFC 3339 / ISO 8601 string into a caller provided buffer, like
+     * @c std::to_chars, e.g. @c 2023-07-09T18:46:37.123+01:00. Nothing is allocated & no terminating null is written.
+     * A date time without a UTC offset is written as an ISO 8601 local time, without one.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, @c consts::DATE_TIME_MAX_STRING_LENGTH characters are always
+     *          enough.
+     * @param precision
+     *          The number of fractional second digits.
+     * @param utcStyle
+     *          Whether a zero offset is written as @c Z or @c +00:00.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small, there is no
+     * date, or the year is outside 0000-9999, which RFC 3339 can't represent.
+     */
+    char* DateTime::toChars(char* first, char* last, FractionPrecision precision, UtcStyle utcStyle) const {
+        int fractionDigits{0};
+        switch (precision) {
+            case FractionPrecision::Auto:
+                fractionDigits = nanosecond == 0 ? 0
+                                 : nanosecond % 1'000 != 0 ? 9
+                                 : nanosecond % 1'000'000 != 0 ? 6 : 3;
+                break;
+            case FractionPrecision::Seconds:
+                break;
+            case FractionPrecision::Milliseconds:
+                fractionDigits = 3;
+                break;
+            case FractionPrecision::Microseconds:
+                fractionDigits = 6;
+                break;
+            case FractionPrecision::Nanoseconds:
+                fractionDigits = 9;
+                break;
+        }
+
+        const bool designator{utcOffset && utcOffsetMinutes == 0 && utcStyle == UtcStyle::Designator};
+        const int offsetLength{!utcOffset ? 0 : designator ? 1 : 6};
+        const int fractionLength{fractionDigits == 0 ? 0 : fractionDigits + 1};
+        const int year{date.getYear()};
+        if (date.serial == Date::NO_DATE || year < 0 || year > 9'999 ||
+            last - first < consts::DATE_TIME_MIN_STRING_LENGTH + fractionLength + offsetLength) {
+            return nullptr;
+        }
+
+        char* out{first};
+        detail::writeFourDigits(out, year);
+        out[4] = consts::DATE_SEPARATOR_DASH;
+        detail::writeTwoDigits(out + 5, date.getMonth());
+        out[7] = consts::DATE_SEPARATOR_DASH;
+        detail::writeTwoDigits(out + 8, date.getDay());
+        out[10] = consts::DATE_TIME_SEPARATOR;
+        detail::writeTwoDigits(out + 11, hour);
+        out[13] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(out + 14, minute);
+        out[16] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(out + 17, second);
+        out += consts::DATE_TIME_MIN_STRING_LENGTH;
+
+        if (fractionDigits != 0) {
+            // Only the groups that are kept are written, the digits are truncated.
+            *out++ = '.';
+            detail::writeThreeDigits(out, nanosecond / 1'000'000);
+            if (fractionDigits > 3) {
+                detail::writeThreeDigits(out + 3, nanosecond / 1'000 % 1'000);
+            }
+            if (fractionDigits > 6) {
+                detail::writeThreeDigits(out + 6, nanosecond % 1'000);
+            }
+            out += fractionDigits;
+        }
+
+        if (designator) {
+            *out++ = consts::UTC_DESIGNATOR;
+        } else if (utcOffset) {
+            int offset{utcOffsetMinutes < 0 ? -utcOffsetMinutes : utcOffsetMinutes};
+            *out++ = utcOffsetMinutes < 0 ? '-' : '+';
+            detail::writeTwoDigits(out, offset / 60);
+            out[2] = consts::TIME_SEPARATOR;
+            detail::writeTwoDigits(out + 3, offset % 60);
+            out += 5;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Converts the date time to an RFC 3339 / ISO 8601 string stored inline, without allocating.
+     * @param precision
+     *          The number of fractional second digits.
+     * @param utcStyle
+     *          Whether a zero offset is written as @c Z or @c +00:00.
+     * @return The date time as an inline string, empty if there is no date or the year is outside 0000-9999.
+     */
+    InlineString<consts::DATE_TIME_MAX_STRING_LENGTH> DateTime::toInlineString(FractionPrecision precision,
+                                                                              UtcStyle utcStyle) const {
+        InlineString<consts::DATE_TIME_MAX_STRING_LENGTH> string;
+        const char* end{toChars(string.data(), string.data() + string.capacity(), precision, utcStyle)};
+        string.resize(end != nullptr ? static_cast<std::size_t>(end - string.data()) : 0);
+        return string;
+    }
+
+    /**
+     * @brief Converts the date time to an ISO 8601 string, e.g. @c 2023-07-09T18:46:37.123+01:00. By default the
+     * fraction is written with 3, 6 or 9 digits & is left out when it is zero.
+     * @param precision
+     *          The number of fractional second digits.
+     * @param utcStyle
+     *          Whether a zero offset is written as @c Z or @c +00:00.
+     * @return The date time as a string, empty if there is no date or the year is outside 0000-9999.
+     */
+    std::string DateTime::toString(FractionPrecision precision, UtcStyle utcStyle) const {
+        char buffer[consts::DATE_TIME_MAX_STRING_LENGTH];
+        char* end{toChars(buffer, buffer + consts::DATE_TIME_MAX_STRING_LENGTH, precision, utcStyle)};
+        return end != nullptr ? std::string{buffer, end} : std::string{};
+    }
+
+    /**
+     * @brief Compares two date time objects to determine if they are equal, i.e. if every component, including the
+     * UTC offset, is the same.
+     * @param other
+     *          The date time to compare against.
+     * @return @c true if the date times are equal, @c false otherwise.
+     */
+    bool DateTime::operator==(const DateTime& other) const {
+        return date == other.date && hour == other.hour && minute == other.minute && second == other.second &&
+               nanosecond == other.nanosecond && utcOffset == other.utcOffset &&
+               utcOffsetMinutes == other.utcOffsetMinutes;
+    }
+
+    /**
+     * @brief Compares two date time objects to determine if they are not equal.
+     * @param other
+     *          The date time to compare against.
+     * @return @c true if the date times are not equal, @c false otherwise.
+     */
+    bool DateTime::operator!=(const DateTime& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Checks if the time passed is valid.
+     * @param h
+     *          The hour.
+     * @param m
+     *          The minute.
+     * @param s
+     *          The second.
+     * @param nano
+     *          The nanosecond.
+     * @return @c true if the time is valid, @c false otherwise.
+     */
+    bool DateTime::isValidTime(int h, int m, int s, int nano) {
+        return detail::isValidTime(h, m, s, consts::MILLISECOND_MIN) &&
+               nano >= consts::NANOSECOND_MIN && nano <= consts::NANOSECOND_MAX;
+    }
+
+    /**
+     * @brief Checks if a UTC offset is valid, i.e. within ±23:59.
+     * @param offsetMinutes
+     *          The UTC offset in minutes.
+     * @return @c true if the offset is valid, @c false otherwise.
+     */
+    bool DateTime::isValidOffset(int offsetMinutes) {
+        return offsetMinutes >= -consts::UTC_OFFSET_MAX_MINUTES && offsetMinutes <= consts::UTC_OFFSET_MAX_MINUTES;
+    }
+
+    /**
+     * @brief Overloaded stream output operator.
+     * @param os
+     *          The output stream.
+     * @param dateTime
+     *          The date time object to output.
+     * @return The output stream.
+     */
+    std::ostream& operator<<(std::ostream& os, const DateTime& dateTime) {
+        char buffer[consts::DATE_TIME_MAX_STRING_LENGTH];
+        const char* end{dateTime.toChars(buffer, buffer + consts::DATE_TIME_MAX_STRING_LENGTH)};
+        os.write(buffer, end != nullptr ? end - buffer : 0);
+        return os;
+    }
+}
@@ -0,0 +1,524 @@
+/**
+ * @file DateTimePattern.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/time/DateTimePattern.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+#include "../../include/dt/utils/ParseUtils.hpp"
+
+namespace dt {
+    namespace {
+        constexpr char FIELD_MARKER{'%'};
+        constexpr std::size_t SHORT_NAME_LENGTH{3};
+        constexpr int NANOSECONDS_PER_MICROSECOND{1'000};
+        constexpr int MINUTES_PER_HOUR{60};
+        constexpr int DEFAULT_YEAR{1970};
+        constexpr std::size_t YEAR_DIGITS{4};
+        constexpr std::size_t YEAR_MAX_LENGTH{6}; // A sign & 5 digits, the widest year a Date holds.
+
+        /**
+         * @brief Gets the most characters a field can be formatted as.
+         */
+        constexpr std::size_t getMaxFieldLength(PatternField field) {
+            switch (field) {
+                case PatternField::Year:
+                    return YEAR_MAX_LENGTH;
+                case PatternField::Millisecond:
+                    return 3;
+                case PatternField::Microsecond:
+                    return 6;
+                case PatternField::Nanosecond:
+                    return 9;
+                case PatternField::MonthShortName:
+                case PatternField::WeekdayShortName:
+                    return SHORT_NAME_LENGTH;
+                case PatternField::MonthName:
+                    return consts::getName(consts::Month::September).size();
+                case PatternField::WeekdayName:
+                    return consts::getName(consts::Weekday::Wednesday).size();
+                case PatternField::UtcOffset:
+                    return 5; // +hhmm
+                case PatternField::Literal:
+                    return 0;
+                default:
+                    return 2;
+            }
+        }
+
+        /**
+         * @brief Parses a field of exactly @p width digits.
+         */
+        ParseResult<int> parseDigitField(std::string_view str, std::size_t i, std::size_t width) {
+            const std::size_t end{std::min(str.size(), i + width)};
+            for (std::size_t j{i}; j < end; ++j) {
+                if (!detail::isDigit(str[j])) {
+                    return {ParseError::ExpectedDigit, j};
+                }
+            }
+            if (end < i + width) {
+                return {ParseError::TooShort, str.size()};
+            }
+            return detail::parseDigits(str.data() + i, width);
+        }
+
+        /**
+         * @brief Finds the end of a run of letters.
+         */
+        std::size_t findLettersEnd(std::string_view str, std::size_t i) {
+            while (i < str.size() && detail::isLetter(str[i])) {
+                ++i;
+            }
+            return i;
+        }
+    }
+
+    /**
+     * @brief @c DateTimePattern constructor, compiles the pattern.
+     * @param pattern
+     *          The pattern, see the class description for the supported fields.
+     * @throws DateParseException If the pattern has an unknown field or ends with a lone '%'.
+     */
+    DateTimePattern::DateTimePattern(std::string_view pattern)
+        : pattern{pattern} {
+        if (pattern.size() > std::numeric_limits<std::uint16_t>::max()) {
+            throw DateParseException("Error compiling pattern. The pattern is too long.");
+        }
+        for (std::size_t i{0}; i < pattern.size(); ++i) {
+            if (pattern[i] != FIELD_MARKER) {
+                addLiteral(pattern[i]);
+                continue;
+            }
+            if (++i == pattern.size()) {
+                throw DateParseException("Error compiling pattern: '" + this->pattern + "'. It ends with a lone '%'.");
+            }
+            switch (pattern[i]) {
+                case 'Y':
+                    addField(PatternField::Year);
+                    break;
+                case 'm':
+                    addField(PatternField::Month);
+                    break;
+                case 'd':
+                    addField(PatternField::Day);
+                    break;
+                case 'H':
+                    addField(PatternField::Hour);
+                    break;
+                case 'M':
+                    addField(PatternField::Minute);
+                    break;
+                case 'S':
+                    addField(PatternField::Second);
+                    break;
+                case 'L':
+                    addField(PatternField::Millisecond);
+                    break;
+                case 'f':
+                    addField(PatternField::Microsecond);
+                    break;
+                case 'N':
+                    addField(PatternField::Nanosecond);
+                    break;
+                case 'b':
+                    addField(PatternField::MonthShortName);
+                    break;
+                case 'B':
+                    addField(PatternField::MonthName);
+                    break;
+                case 'a':
+                    addField(PatternField::WeekdayShortName);
+                    break;
+                case 'A':
+                    addField(PatternField::WeekdayName);
+                    break;
+                case 'z':
+                    addField(PatternField::UtcOffset);
+                    break;
+                case 'F':
+                    addField(PatternField::Year);
+                    addLiteral(consts::DATE_SEPARATOR_DASH);
+                    addField(PatternField::Month);
+                    addLiteral(consts::DATE_SEPARATOR_DASH);
+                    addField(PatternField::Day);
+                    break;
+                case 'T':
+                    addField(PatternField::Hour);
+                    addLiteral(consts::TIME_SEPARATOR);
+                    addField(PatternField::Minute);
+                    addLiteral(consts::TIME_SEPARATOR);
+                    addField(PatternField::Second);
+                    break;
+                case FIELD_MARKER:
+                    addLiteral(FIELD_MARKER);
+                    break;
+                default:
+                    throw DateParseException("Error compiling pattern: '" + this->pattern + "'. Unknown field '%" +
+                                             std::string(1, pattern[i]) + "'.");
+            }
+        }
+    }
+
+    /**
+     * @brief Formats a date time with the pattern. Nothing is allocated & no terminating null is written.
+     * @param dateTime
+     *          The date time.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, at least @c getMaxLength() characters.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    char* DateTimePattern::format(const DateTime& dateTime, char* first, char* last) const {
+        if (static_cast<std::size_t>(last - first) < maxLength) {
+            return nullptr;
+        }
+        const Date& date{dateTime.date};
+        const bool hasMonth{date.month >= consts::MIN_NUMBER_OF_MONTHS && date.month <= consts::MAX_NUMBER_OF_MONTHS};
+        const int nano{dateTime.nanosecond};
+
+        for (const Instruction& instruction : program) {
+            switch (instruction.field) {
+                case PatternField::Literal: {
+                    // Runs are usually one or two separators, too short for a call to memcpy to pay off.
+                    const char* literal{literals.data() + instruction.literalOffset};
+                    for (std::uint16_t i{0}; i < instruction.literalLength; ++i) {
+                        first[i] = literal[i];
+                    }
+                    first += instruction.literalLength;
+                    break;
+                }
+                case PatternField::Year:
+                    if (date.year >= 0 && date.year <= 9'999) {
+                        detail::writeFourDigits(first, date.year);
+                        first += 4;
+                    } else {
+                        first = std::to_chars(first, first + YEAR_MAX_LENGTH, date.year).ptr;
+                    }
+                    break;
+                case PatternField::Month:
+                    detail::writeTwoDigits(first, date.month);
+                    first += 2;
+                    break;
+                case PatternField::Day:
+                    detail::writeTwoDigits(first, date.day);
+                    first += 2;
+                    break;
+                case PatternField::Hour:
+                    detail::writeTwoDigits(first, dateTime.hour);
+                    first += 2;
+                    break;
+                case PatternField::Minute:
+                    detail::writeTwoDigits(first, dateTime.minute);
+                    first += 2;
+                    break;
+                case PatternField::Second:
+                    detail::writeTwoDigits(first, dateTime.second);
+                    first += 2;
+                    break;
+                case PatternField::Millisecond:
+                    detail::writeThreeDigits(first, nano / consts::NANOSECONDS_PER_MILLISECOND);
+                    first += 3;
+                    break;
+                case PatternField::Microsecond:
+                    detail::writeThreeDigits(first, nano / consts::NANOSECONDS_PER_MILLISECOND);
+                    detail::writeThreeDigits(first + 3, nano / NANOSECONDS_PER_MICROSECOND % 1'000);
+                    first += 6;
+                    break;
+                case PatternField::Nanosecond:
+                    detail::writeThreeDigits(first, nano / consts::NANOSECONDS_PER_MILLISECOND);
+                    detail::writeThreeDigits(first + 3, nano / NANOSECONDS_PER_MICROSECOND % 1'000);
+                    detail::writeThreeDigits(first + 6, nano % 1'000);
+                    first += 9;
+                    break;
+                case PatternField::MonthShortName:
+                case PatternField::MonthName:
+                    if (hasMonth) {
+                        const auto month{static_cast<consts::Month>(date.month)};
+                        const std::string_view name{instruction.field == PatternField::MonthName
+                                                    ? consts::getName(month) : consts::getShortName(month)};
+                        std::memcpy(first, name.data(), name.size());
+                        first += name.size();
+                    }
+                    break;
+                case PatternField::WeekdayShortName:
+                case PatternField::WeekdayName:
+                    if (hasMonth) {
+                        const consts::Weekday weekday{detail::isoWeekdayFromDays(date.serial)};
+                        const std::string_view name{instruction.field == PatternField::WeekdayName
+                                                    ? consts::getName(weekday) : consts::getShortName(weekday)};
+                        std::memcpy(first, name.data(), name.size());
+                        first += name.size();
+                    }
+                    break;
+                case PatternField::UtcOffset:
+                    if (dateTime.utcOffset) {
+                        int offset{dateTime.utcOffsetMinutes};
+                        *first++ = offset < 0 ? '-' : '+';
+                        offset = offset < 0 ? -offset : offset;
+                        detail::writeTwoDigits(first, offset / MINUTES_PER_HOUR);
+                        detail::writeTwoDigits(first + 2, offset % MINUTES_PER_HOUR);
+                        first += 4;
+                    }
+                    break;
+            }
+        }
+        return first;
+    }
+
+    /**
+     * @brief Formats a date with the pattern, as a date time at midnight without a UTC offset.
+     * @param date
+     *          The date.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, at least @c getMaxLength() characters.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    char* DateTimePattern::format(const Date& date, char* first, char* last) const {
+        return format(DateTime{date, 0, 0, 0, 0, 0, false}, first, last);
+    }
+
+    /**
+     * @brief Formats a date time with the pattern.
+     * @param dateTime
+     *          The date time.
+     * @return The formatted date time.
+     */
+    std::string DateTimePattern::toString(const DateTime& dateTime) const {
+        std::string result(maxLength, '\0');
+        result.resize(static_cast<std::size_t>(format(dateTime, result.data(), result.data() + maxLength) -
+                                               result.data()));
+        return result;
+    }
+
+    /**
+     * @brief Formats a date with the pattern, as a date time at midnight without a UTC offset.
+     * @param date
+     *          The date.
+     * @return The formatted date.
+     */
+    std::string DateTimePattern::toString(const Date& date) const {
+        return toString(DateTime{date, 0, 0, 0, 0, 0, false});
+    }
+
+    /**
+     * @brief Parses a string that matches the pattern without throwing.
+     * @param dateTime
+     *          The string to parse.
+     * @return The parsed date time, with a UTC offset only if the pattern has @c %z, or why it could not be parsed.
+     */
+    ParseResult<DateTime> DateTimePattern::tryParse(std::string_view dateTime) const noexcept {
+        const std::size_t size{dateTime.size()};
+        std::size_t i{0};
+        int year{DEFAULT_YEAR};
+        int month{consts::MIN_NUMBER_OF_MONTHS};
+        int day{1};
+        int hour{0};
+        int minute{0};
+        int second{0};
+        int nano{0};
+        int offset{0};
+        bool hasOffset{false};
+        std::size_t dateOffset{0};
+        std::size_t timeOffset{0};
+        bool seenDate{false};
+        bool seenTime{false};
+
+        for (const Instruction& instruction : program) {
+            const PatternField field{instruction.field};
+            if (field == PatternField::Literal) {
+                std::string_view literal{literals.data() + instruction.literalOffset, instruction.literalLength};
+                for (char c : literal) {
+                    if (i == size) {
+                        return {ParseError::TooShort, i};
+                    }
+                    if (dateTime[i] != c) {
+                        return {ParseError::ExpectedSeparator, i};
+                    }
+                    ++i;
+                }
+                continue;
+            }
+
+            if (field >= PatternField::Year && field <= PatternField::Day && !seenDate) {
+                dateOffset = i;
+                seenDate = true;
+            } else if (field >= PatternField::Hour && field <= PatternField::Second && !seenTime) {
+                timeOffset = i;
+                seenTime = true;
+            }
+
+            switch (field) {
+                case PatternField::MonthShortName:
+                case PatternField::MonthName: {
+                    const std::size_t end{findLettersEnd(dateTime, i)};
+                    if (end == i && i == size) {
+                        return {ParseError::TooShort, i};
+                    }
+                    month = detail::parseMonthName(dateTime.data() + i, end - i);
+                    if (month == 0) {
+                        return {ParseError::InvalidMonthName, i};
+                    }
+                    if (!seenDate) {
+                        dateOffset = i;
+                        seenDate = true;
+                    }
+                    i = end;
+                    break;
+                }
+                case PatternField::WeekdayShortName:
+                case PatternField::WeekdayName: {
+                    const std::size_t end{findLettersEnd(dateTime, i)};
+                    if (end == i && i == size) {
+                        return {ParseError::TooShort, i};
+                    }
+                    if (!detail::isWeekdayName(dateTime.substr(i, end - i))) {
+                        return {ParseError::InvalidDate, i};
+                    }
+                    i = end;
+                    break;
+                }
+                case PatternField::UtcOffset: {
+                    if (i == size) {
+                        return {ParseError::TooShort, i};
+                    }
+                    const char sign{dateTime[i]};
+                    if (sign == 'Z' || sign == 'z') {
+                        offset = 0;
+                        hasOffset = true;
+                        ++i;
+                        break;
+                    }
+                    if (sign != '+' && sign != '-') {
+                        return {ParseError::InvalidUtcOffset, i};
+                    }
+                    ParseResult<int> hours{parseDigitField(dateTime, i + 1, 2)};
+                    if (!hours) {
+                        return {hours.getError(), hours.getErrorOffset()};
+                    }
+                    std::size_t minutesOffset{i + 3};
+                    if (minutesOffset < size && dateTime[minutesOffset] == consts::TIME_SEPARATOR) {
+                        ++minutesOffset;
+                    }
+                    ParseResult<int> minutes{parseDigitField(dateTime, minutesOffset, 2)};
+                    if (!minutes) {
+                        return {minutes.getError(), minutes.getErrorOffset()};
+                    }
+                    if (*minutes >= MINUTES_PER_HOUR) {
+                        return {ParseError::InvalidUtcOffset, i};
+                    }
+                    offset = (*hours * MINUTES_PER_HOUR + *minutes) * (sign == '-' ? -1 : 1);
+                    if (!DateTime::isValidOffset(offset)) {
+                        return {ParseError::InvalidUtcOffset, i};
+                    }
+                    hasOffset = true;
+                    i = minutesOffset + 2;
+                    break;
+                }
+                default: {
+                    // A parsed year is always 4 digits, only formatting can need more.
+                    const std::size_t width{field == PatternField::Year ? YEAR_DIGITS : getMaxFieldLength(field)};
+                    ParseResult<int> value{parseDigitField(dateTime, i, width)};
+                    if (!value) {
+                        return {value.getError(), value.getErrorOffset()};
+                    }
+                    switch (field) {
+                        case PatternField::Year:
+                            year = *value;
+                            break;
+                        case PatternField::Month:
+                            month = *value;
+                            break;
+                        case PatternField::Day:
+                            day = *value;
+                            break;
+                        case PatternField::Hour:
+                            hour = *value;
+                            break;
+                        case PatternField::Minute:
+                            minute = *value;
+                            break;
+                        case PatternField::Second:
+                            second = *value;
+                            break;
+                        case PatternField::Millisecond:
+                            nano = *value * consts::NANOSECONDS_PER_MILLISECOND;
+                            break;
+                        case PatternField::Microsecond:
+                            nano = *value * NANOSECONDS_PER_MICROSECOND;
+                            break;
+                        default:
+                            nano = *value;
+                            break;
+                    }
+                    i += width;
+                    break;
+                }
+            }
+        }
+
+        if (i < size) {
+            return {ParseError::TooLong, i};
+        }
+        if (!detail::isValidDate(day, month, year)) {
+            return {ParseError::InvalidDate, dateOffset};
+        }
+        if (!detail::isValidTime(hour, minute, second, 0)) {
+            return {ParseError::InvalidTime, timeOffset};
+        }
+        Date date;
+        date.assignDate(day, month, year);
+        return DateTime{date, hour, minute, second, nano, offset, hasOffset};
+    }
+
+    /**
+     * @brief Gets the pattern the program was compiled from.
+     * @return The pattern.
+     */
+    std::string_view DateTimePattern::getPattern() const {
+        return pattern;
+    }
+
+    /**
+     * @brief Gets the most characters a date time can be formatted as, e.g. to size a buffer for @c format.
+     * @return The maximum length.
+     */
+    std::size_t DateTimePattern::getMaxLength() const {
+        return maxLength;
+    }
+
+    /**
+     * @brief Appends a field instruction to the program.
+     * @param field
+     *          The field.
+     */
+    void DateTimePattern::addField(PatternField field) {
+        program.push_back({field, 0, 0});
+        maxLength += getMaxFieldLength(field);
+    }
+
+    /**
+     * @brief Appends a literal character to the program, extending the previous literal run if there is one.
+     * @param c
+     *          The character.
+     */
+    void DateTimePattern::addLiteral(char c) {
+        if (program.empty() || program.back().field != PatternField::Literal) {
+            program.push_back({PatternField::Literal, static_cast<std::uint16_t>(literals.size()), 0});
+        }
+        ++program.back().literalLength;
+        literals.push_back(c);
+        ++maxLength;
+    }
+}
@@ -0,0 +1,337 @@
+/**
+ * @file HttpDate.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/time/HttpDate.hpp"
+
+#include <atomic>
+#include <climits>
+#include <cstring>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+#include "../../include/dt/utils/ParseUtils.hpp"
+
+namespace dt {
+    namespace {
+        // Layouts for detail::findLayoutMismatch.
+        constexpr std::string_view IMF_FIXDATE_LAYOUT{"AAA, DD AAA DDDD DD:DD:DD GMT"};
+        constexpr std::string_view RFC_850_LAYOUT{", DD-AAA-DD DD:DD:DD GMT"}; // After the full day name.
+        constexpr std::string_view ASCTIME_LAYOUT{"AAA AAA _D DD:DD:DD DDDD"};
+
+        // The seconds since the epoch of the first & last seconds with a four digit year, 0000-9999.
+        constexpr std::int64_t MIN_SECONDS{std::int64_t{detail::daysFromCivil(0, 1, 1)} * detail::SECONDS_PER_DAY};
+        constexpr std::int64_t MAX_SECONDS{
+                (std::int64_t{detail::daysFromCivil(9'999, 12, 31)} + 1) * detail::SECONDS_PER_DAY - 1};
+
+        /**
+         * @brief The three formats of an HTTP-date.
+         */
+        enum class HttpDateForm {
+            ImfFixdate,
+            Rfc850,
+            Asctime,
+        };
+
+        /**
+         * @brief The last second formatted from a time point & its rendering, guarded by a sequence lock. Readers
+         * never block or write: they retry nothing & simply format themselves if a writer is active. Everything is an
+         * atomic, so there is no data race even when a read overlaps a write.
+         */
+        struct SecondCache {
+            std::atomic<std::uint64_t> sequence{0};
+            std::atomic<std::int64_t> second{LLONG_MIN};
+            std::atomic<std::uint64_t> words[4]{};
+        };
+
+        SecondCache secondCache;
+
+        static_assert(sizeof(SecondCache::words) >= static_cast<std::size_t>(consts::HTTP_DATE_STRING_LENGTH));
+
+        /**
+         * @brief Copies the cached rendering of a second.
+         * @return @c true if @p second was cached & copied to @p out, @c false otherwise.
+         */
+        bool readSecondCache(std::int64_t second, char* out) {
+            std::uint64_t before{secondCache.sequence.load(std::memory_order_acquire)};
+            if ((before & 1) != 0) {
+                return false;
+            }
+            std::int64_t cachedSecond{secondCache.second.load(std::memory_order_relaxed)};
+            std::uint64_t words[4];
+            for (std::size_t i{0}; i < 4; ++i) {
+                words[i] = secondCache.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (secondCache.sequence.load(std::memory_order_relaxed) != before || cachedSecond != second) {
+                return false;
+            }
+            std::memcpy(out, words, consts::HTTP_DATE_STRING_LENGTH);
+            return true;
+        }
+
+        /**
+         * @brief Caches the rendering of a second, unless another thread is already writing one.
+         */
+        void writeSecondCache(std::int64_t second, const char* text) {
+            std::uint64_t before{secondCache.sequence.load(std::memory_order_relaxed)};
+            if ((before & 1) != 0 ||
+                !secondCache.sequence.compare_exchange_strong(before, before + 1, std::memory_order_relaxed)) {
+                return;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::uint64_t words[4]{};
+            std::memcpy(words, text, consts::HTTP_DATE_STRING_LENGTH);
+            for (std::size_t i{0}; i < 4; ++i) {
+                secondCache.words[i].store(words[i], std::memory_order_relaxed);
+            }
+            secondCache.second.store(second, std::memory_order_relaxed);
+            secondCache.sequence.store(before + 2, std::memory_order_release);
+        }
+
+
+        /**
+         * @brief Gets the current year in UTC, for the two digit years of rfc850-date.
+         */
+        int getCurrentYear() {
+            std::int64_t seconds{std::chrono::duration_cast<std::chrono::seconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count()};
+            int year{0};
+            int month{0};
+            int day{0};
+            detail::civilFromDays(static_cast<int>(detail::floorDivide(seconds, detail::SECONDS_PER_DAY)), year,
+                                  month, day);
+            return year;
+        }
+    }
+
+    /**
+     * @brief Writes a date time as an HTTP-date, e.g. @c Sun, @c 09 @c Jul @c 2023 @c 18:46:37 @c GMT. A date time
+     * with a UTC offset is converted to GMT, a local date time is taken to already be in GMT. The fraction of the
+     * second is dropped. Nothing is allocated & no terminating null is written.
+     * @param dateTime
+     *          The date time.
+     * @param out
+     *          The buffer to write to, at least @c consts::HTTP_DATE_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written, or @c nullptr if the date time has no date or its year
+     * in GMT is outside 0000-9999.
+     */
+    char* HttpDate::format(const DateTime& dateTime, char* out) {
+        if (dateTime.date.serial == Date::NO_DATE) {
+            return nullptr;
+        }
+        std::int64_t seconds{static_cast<std::int64_t>(dateTime.date.serial) * detail::SECONDS_PER_DAY};
+        seconds += dateTime.getHour() * 3'600 + dateTime.getMinute() * 60 + dateTime.getSecond();
+        seconds -= dateTime.getUtcOffsetMinutes() * 60;
+        return formatSeconds(seconds, out);
+    }
+
+    /**
+     * @brief Writes a time point as an HTTP-date. The last second written is cached, so formatting the same second
+     * again, from any thread, is a copy. Nothing is allocated & no terminating null is written.
+     * @param time
+     *          The time point, truncated to the second.
+     * @param out
+     *          The buffer to write to, at least @c consts::HTTP_DATE_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written, or @c nullptr if the year is outside 0000-9999.
+     */
+    char* HttpDate::format(std::chrono::system_clock::time_point time, char* out) {
+        std::int64_t seconds{std::chrono::floor<std::chrono::seconds>(time.time_since_epoch()).count()};
+        if (readSecondCache(seconds, out)) {
+            return out + consts::HTTP_DATE_STRING_LENGTH;
+        }
+        char* end{formatSeconds(seconds, out)};
+        if (end != nullptr) {
+            writeSecondCache(seconds, out);
+        }
+        return end;
+    }
+
+    /**
+     * @brief Writes the current time as an HTTP-date, e.g. for a @c Date header, see
+     * @c format(std::chrono::system_clock::time_point, char*).
+     * @param out
+     *          The buffer to write to, at least @c consts::HTTP_DATE_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written, or @c nullptr if the year is outside 0000-9999.
+     */
+    char* HttpDate::formatNow(char* out) {
+        return format(std::chrono::system_clock::now(), out);
+    }
+
+    /**
+     * @brief Converts a date time to an HTTP-date string, see @c format(const DateTime&, char*).
+     * @param dateTime
+     *          The date time.
+     * @return The HTTP-date, empty if the date time has no date or its year in GMT is outside 0000-9999.
+     */
+    std::string HttpDate::toString(const DateTime& dateTime) {
+        char buffer[consts::HTTP_DATE_STRING_LENGTH];
+        char* end{format(dateTime, buffer)};
+        return end != nullptr ? std::string{buffer, end} : std::string{};
+    }
+
+    /**
+     * @brief Parses an HTTP-date without throwing, in any of the three formats a recipient must accept:
+     * <ul>
+     *  <li>IMF-fixdate:  @c Sun, @c 09 @c Jul @c 2023 @c 18:46:37 @c GMT</li>
+     *  <li>rfc850-date:  @c Sunday, @c 09-Jul-23 @c 18:46:37 @c GMT</li>
+     *  <li>asctime-date: @c Sun @c Jul @c @c 9 @c 18:46:37 @c 2023</li>
+     * </ul>
+     * Day & month names are case-insensitive & the day name isn't checked against the date. A two digit year is in
+     * the current century, or the previous one if that would put it more than 50 years in the future. Leap seconds
+     * are rejected like they are by @c DateTime.
+     * @param httpDate
+     *          The HTTP-date to parse.
+     * @return The date time in GMT, i.e. with a UTC offset of 0, or why it could not be parsed.
+     */
+    ParseResult<DateTime> HttpDate::tryParse(std::string_view httpDate) noexcept {
+        const char* str{httpDate.data()};
+        std::size_t nameLength{0};
+        while (nameLength < httpDate.size() && detail::isLetter(str[nameLength])) {
+            ++nameLength;
+        }
+
+        HttpDateForm form{HttpDateForm::ImfFixdate};
+        std::string_view layout;
+        std::size_t layoutOffset{0};
+        std::size_t dayOffset{0};
+        std::size_t monthOffset{0};
+        std::size_t yearOffset{0};
+        std::size_t timeOffset{0};
+        if (nameLength == 3 && httpDate.size() > 3 && str[3] == ',') {
+            layout = IMF_FIXDATE_LAYOUT;
+            dayOffset = 5;
+            monthOffset = 8;
+            yearOffset = 12;
+            timeOffset = 17;
+        } else if (nameLength > 3 && httpDate.size() > nameLength && str[nameLength] == ',') {
+            form = HttpDateForm::Rfc850;
+            layout = RFC_850_LAYOUT;
+            layoutOffset = nameLength;
+            dayOffset = nameLength + 2;
+            monthOffset = nameLength + 5;
+            yearOffset = nameLength + 9;
+            timeOffset = nameLength + 12;
+        } else if (nameLength == 3 && httpDate.size() > 3 && str[3] == ' ') {
+            form = HttpDateForm::Asctime;
+            layout = ASCTIME_LAYOUT;
+            monthOffset = 4;
+            dayOffset = 8;
+            timeOffset = 11;
+            yearOffset = 20;
+        } else if (nameLength < 3 || nameLength > detail::WEEKDAY_NAMES[3].size()) {
+            return {ParseError::InvalidDate, 0};
+        } else {
+            return {httpDate.size() > nameLength ? ParseError::ExpectedSeparator : ParseError::TooShort, nameLength};
+        }
+
+        // The month letters are checked by parseMonthName, so the fast path only checks digits & separators & the
+        // character by character search runs only to explain a mismatch.
+        bool matches{false};
+        if (httpDate.size() == layoutOffset + layout.size()) {
+            const char* tail{str + timeOffset + 8};
+            if (form == HttpDateForm::ImfFixdate) {
+                matches = str[4] == ' ' && detail::isDigits(str + 5, 2) && str[7] == ' ' && str[11] == ' ' &&
+                          detail::isDigits(str + 12, 4) && str[16] == ' ' && std::memcmp(tail, " GMT", 4) == 0;
+            } else if (form == HttpDateForm::Rfc850) {
+                matches = str[layoutOffset + 1] == ' ' && detail::isDigits(str + dayOffset, 2) &&
+                          str[monthOffset - 1] == '-' && str[monthOffset + 3] == '-' &&
+                          detail::isDigits(str + yearOffset, 2) && str[timeOffset - 1] == ' ' &&
+                          std::memcmp(tail, " GMT", 4) == 0;
+            } else {
+                matches = str[7] == ' ' && (detail::isDigit(str[8]) || str[8] == ' ') && detail::isDigit(str[9]) &&
+                          str[10] == ' ' && *tail == ' ' && detail::isDigits(str + yearOffset, 4);
+            }
+            matches = matches && detail::isTimeLayout(str + timeOffset);
+        }
+        if (!matches) {
+            std::string_view rest{httpDate.substr(layoutOffset)};
+            std::size_t mismatch{detail::findLayoutMismatch(rest, layout)};
+            ParseError error{detail::getLayoutError(rest, layout, mismatch)};
+            if (mismatch != layout.size() || rest.size() != layout.size()) {
+                return {error, error == ParseError::InvalidMonthName ? monthOffset : layoutOffset + mismatch};
+            }
+        }
+        if (!detail::isWeekdayName(httpDate.substr(0, nameLength))) {
+            return {ParseError::InvalidDate, 0};
+        }
+        int m{detail::parseMonthName(str + monthOffset, 3)};
+        if (m == 0) {
+            return {ParseError::InvalidMonthName, monthOffset};
+        }
+
+        int d{str[dayOffset] == ' ' ? str[dayOffset + 1] - '0' : detail::parseTwoDigits(str + dayOffset)};
+        int y{0};
+        if (form == HttpDateForm::Rfc850) {
+            int currentYear{getCurrentYear()};
+            y = currentYear / 100 * 100 + detail::parseTwoDigits(str + yearOffset);
+            if (y > currentYear + 50) {
+                y -= 100;
+            }
+        } else {
+            y = detail::parseFourDigits(str + yearOffset);
+        }
+        if (!detail::isValidDate(d, m, y)) {
+            return {ParseError::InvalidDate, y < consts::MIN_YEAR || y > consts::MAX_YEAR ? yearOffset : dayOffset};
+        }
+
+        int h{detail::parseTwoDigits(str + timeOffset)};
+        int mi{detail::parseTwoDigits(str + timeOffset + 3)};
+        int s{detail::parseTwoDigits(str + timeOffset + 6)};
+        if (h > consts::HOUR_MAX) {
+            return {ParseError::InvalidTime, timeOffset};
+        }
+        if (mi > consts::MINUTE_MAX) {
+            return {ParseError::InvalidTime, timeOffset + 3};
+        }
+        if (s > consts::SECOND_MAX) {
+            return {ParseError::InvalidTime, timeOffset + 6};
+        }
+        Date date;
+        date.assignDate(d, m, y);
+        return DateTime{date, h, mi, s, 0, 0, true};
+    }
+
+    /**
+     * @brief Writes a number of seconds since @c 1970-01-01T00:00:00Z as an IMF-fixdate.
+     * @param seconds
+     *          The number of seconds since the epoch.
+     * @param out
+     *          The buffer to write to, at least @c consts::HTTP_DATE_STRING_LENGTH characters long.
+     * @return A pointer one past the last character written, or @c nullptr if the year is outside 0000-9999.
+     */
+    char* HttpDate::formatSeconds(std::int64_t seconds, char* out) {
+        if (seconds < MIN_SECONDS || seconds > MAX_SECONDS) {
+            return nullptr;
+        }
+        // Sun, 09 Jul 2023 18:46:37 GMT
+        // 01234567890123456789012345678
+        auto days{static_cast<int>(detail::floorDivide(seconds, detail::SECONDS_PER_DAY))};
+        auto secondOfDay{static_cast<int>(seconds - static_cast<std::int64_t>(days) * detail::SECONDS_PER_DAY)};
+        int year{0};
+        int month{0};
+        int day{0};
+        detail::civilFromDays(days, year, month, day);
+
+        std::memcpy(out, consts::getShortName(detail::isoWeekdayFromDays(days)).data(), 3);
+        out[3] = ',';
+        out[4] = ' ';
+        detail::writeTwoDigits(out + 5, day);
+        out[7] = ' ';
+        std::memcpy(out + 8, consts::getShortName(static_cast<consts::Month>(month)).data(), 3);
+        out[11] = ' ';
+        detail::writeFourDigits(out + 12, year);
+        out[16] = ' ';
+        detail::writeTwoDigits(out + 17, secondOfDay / 3'600);
+        out[19] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(out + 20, secondOfDay / 60 % 60);
+        out[22] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(out + 23, secondOfDay % 60);
+        std::memcpy(out + 25, " GMT", 4);
+        return out + consts::HTTP_DATE_STRING_LENGTH;
+    }
+}
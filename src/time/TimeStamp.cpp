@@ -7,7 +7,17 @@
 
 #include "../../include/dt/time/TimeStamp.hpp"
 
+#include <algorithm>
+
+#include "../../include/dt/time/CurrentTime.hpp"
+#include "../../include/dt/utils/FormatUtils.hpp"
+
 namespace dt {
+    namespace {
+        // Bits per word of a validity bitmask, see DateBatchParser.
+        constexpr std::size_t MASK_WORD_BITS{64};
+    }
+
     /**
      * @brief @c TimeStamp constructor.
      * @param h
@@ -33,7 +43,7 @@ namespace dt {
      * @param timeStamp
      *          The string representation of the time stamp.
      */
-    TimeStamp::TimeStamp(const std::string& timeStamp) {
+    TimeStamp::TimeStamp(std::string_view timeStamp) {
         parse(timeStamp);
     }
 
@@ -81,8 +91,7 @@ namespace dt {
      * @brief Overrides the time and sets it to the current time.
      */
     void TimeStamp::setToCurrentTime() {
-        std::string timeStamp{DateTimeUtils::getCurrentTimeStr()};
-        parse(timeStamp);
+        *this = CurrentTime::getTimeStamp();
     }
 
     /**
@@ -146,12 +155,51 @@ namespace dt {
      * @return The time stamp as a string.
      */
     std::string TimeStamp::toString() const {
-        std::stringstream ss;
-        ss << formatTimeStampComponent(hour) << consts::TIME_SEPARATOR;
-        ss << formatTimeStampComponent(minute) << consts::TIME_SEPARATOR;
-        ss << formatTimeStampComponent(second) << consts::TIME_SEPARATOR;
-        ss << formatMillisecondComponent(millisecond);
-        return ss.str();
+        char buffer[consts::TIME_STAMP_STRING_LENGTH];
+        return {buffer, toChars(buffer, buffer + consts::TIME_STAMP_STRING_LENGTH)};
+    }
+
+    /**
+     * @brief Writes the time stamp as @c HH:MM:SS:mmm into a caller provided buffer, like @c std::to_chars. Nothing
+     * is allocated & no terminating null is written.
+     * @param first
+     *          The first character of the buffer.
+     * @param last
+     *          One past the last character of the buffer, at least @c consts::TIME_STAMP_STRING_LENGTH characters.
+     * @return A pointer one past the last character written, or @c nullptr if the buffer is too small.
+     */
+    char* TimeStamp::toChars(char* first, char* last) const {
+        if (last - first < consts::TIME_STAMP_STRING_LENGTH) {
+            return nullptr;
+        }
+        detail::writeTwoDigits(first, hour);
+        first[2] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(first + 3, minute);
+        first[5] = consts::TIME_SEPARATOR;
+        detail::writeTwoDigits(first + 6, second);
+        first[8] = consts::TIME_SEPARATOR;
+        detail::writeThreeDigits(first + 9, millisecond);
+        return first + consts::TIME_STAMP_STRING_LENGTH;
+    }
+
+    /**
+     * @brief Converts the time stamp to a string stored inline, without allocating.
+     * @return The time stamp as an inline string.
+     */
+    InlineString<consts::TIME_STAMP_STRING_LENGTH> TimeStamp::toInlineString() const {
+        InlineString<consts::TIME_STAMP_STRING_LENGTH> string;
+        toChars(string.data(), string.data() + string.capacity());
+        string.resize(consts::TIME_STAMP_STRING_LENGTH);
+        return string;
+    }
+
+    /**
+     * @brief Converts the time stamp to an @c HHMMSSmmm integer, e.g. @c 123456789 for @c 12:34:56:789, with
+     * multiplies only.
+     * @return The time stamp as an @c HHMMSSmmm integer.
+     */
+    std::int32_t TimeStamp::toHmsmInt() const {
+        return hour * 10'000'000 + minute * 100'000 + second * 1'000 + millisecond;
     }
 
     /**
@@ -227,19 +275,7 @@ namespace dt {
      * @return @c true if the time is valid, @c false otherwise.
      */
     bool TimeStamp::isValidTime(int h, int m, int s, int milli) {
-        if (h < consts::HOUR_MIN || h > consts::HOUR_MAX) {
-            return false;
-        }
-        if (m < consts::MINUTE_MIN || m > consts::MINUTE_MAX) {
-            return false;
-        }
-        if (s < consts::SECOND_MIN || s > consts::SECOND_MAX) {
-            return false;
-        }
-        if (milli < consts::MILLISECOND_MIN || milli > consts::MILLISECOND_MAX) {
-            return false;
-        }
-        return true;
+        return detail::isValidTime(h, m, s, milli);
     }
 
     /**
@@ -307,77 +343,152 @@ namespace dt {
     }
 
     /**
-     * @brief Parses a string representation of a time stamp.
+     * @brief Parses a string representation of a time stamp without throwing, see @c parse for the accepted format.
      *
-     * <b>Note:</b> Time stamp must be in the format: @c HH:MM:SS::MSMSMS. <br>
-     * <b>Example:</b> @c dt::TimeStamp time{"01:01:01:001"};
+     * On failure nothing is allocated, the result holds the error & the offset of the offending character instead.
      * @param timeStamp
      *          The string representation of a time stamp to parse.
-     * @throws DateParseException
-     *          If the string representation of the time stamp doesn't match a certain pattern.
+     * @return The parsed time stamp, or why it could not be parsed.
      */
-    void TimeStamp::parse(const std::string& timeStamp) {
-        static std::string timeStampPattern{"^\\d{2}:\\d{2}:\\d{2}:\\d{3}"};
+    ParseResult<TimeStamp> TimeStamp::tryParse(std::string_view timeStamp) noexcept {
+        // XX:XX:XX:XXX
+        // 012345678901
+        const char* str{timeStamp.data()};
+        if (timeStamp.size() == consts::TIME_STAMP_STRING_LENGTH &&
+            str[2] == consts::TIME_SEPARATOR && str[5] == consts::TIME_SEPARATOR && str[8] == consts::TIME_SEPARATOR &&
+            detail::isDigits(str, 2) && detail::isDigits(str + 3, 2) && detail::isDigits(str + 6, 2) &&
+            detail::isDigits(str + 9, 3)) {
+            int h{detail::parseTwoDigits(str)};
+            int m{detail::parseTwoDigits(str + 3)};
+            int s{detail::parseTwoDigits(str + 6)};
+            int ms{detail::parseThreeDigits(str + 9)};
+            if (detail::isValidTime(h, m, s, ms)) {
+                return TimeStamp{h, m, s, ms};
+            }
 
-        if (std::regex regexPattern{timeStampPattern}; std::regex_match(timeStamp, regexPattern)) {
-            convertStrToTimeStamp(timeStamp);
-            return;
+            // Only the hour, minute & second can be out of range.
+            if (h > consts::HOUR_MAX) {
+                return {ParseError::InvalidTime, 0};
+            }
+            return {ParseError::InvalidTime, m > consts::MINUTE_MAX ? std::size_t{3} : std::size_t{6}};
         }
-        std::string message{"Error parsing time: '" + timeStamp + "'. Check formatting."};
-        throw DateParseException(message);
+
+        std::size_t mismatch{detail::findLayoutMismatch(timeStamp, detail::TIME_STAMP_LAYOUT)};
+        return {detail::getLayoutError(timeStamp, detail::TIME_STAMP_LAYOUT, mismatch), mismatch};
     }
 
     /**
-     * @brief Extracts the time components from a valid string representation of a time stamp. The hour, minute,
-     * second and millisecond components are set if the time is valid.
-     * @param timeStamp
-     *          The string representation of the time.
-     * @throws InvalidTimeException
-     *
+     * @brief Converts an @c HHMMSSmmm integer, e.g. @c 123456789 for @c 12:34:56:789, to a time stamp without going
+     * through a string. The components are split with multiplies & shifts instead of divisions.
+     * @param hmsm
+     *          The time stamp as an @c HHMMSSmmm integer.
+     * @return The time stamp, or @c ParseError::InvalidTime with the offset of the invalid component in the 9 digit
+     * form: 0 for the hour, 2 for the minute & 4 for the second.
      */
-    void TimeStamp::convertStrToTimeStamp(const std::string& timeStamp) {
-        // XX:XX:XX:XXXX
-        // 0123456789012
-        int h{std::stoi(timeStamp.substr(0, 2))};
-        int m{std::stoi(timeStamp.substr(3, 2))};
-        int s{std::stoi(timeStamp.substr(6, 2))};
-        int ms{std::stoi(timeStamp.substr(9, 4))};
+    ParseResult<TimeStamp> TimeStamp::fromHmsmInt(std::int32_t hmsm) noexcept {
+        int h{0};
+        int m{0};
+        int s{0};
+        int ms{0};
+        detail::decodeHmsmInt(static_cast<std::uint32_t>(hmsm), h, m, s, ms);
+        if (hmsm < 0 || h > consts::HOUR_MAX) {
+            return {ParseError::InvalidTime, 0};
+        }
+        if (m > consts::MINUTE_MAX) {
+            return {ParseError::InvalidTime, 2};
+        }
+        if (s > consts::SECOND_MAX) {
+            return {ParseError::InvalidTime, 4};
+        }
+        TimeStamp timeStamp;
+        timeStamp.hour = h;
+        timeStamp.minute = m;
+        timeStamp.second = s;
+        timeStamp.millisecond = ms;
+        return timeStamp;
+    }
 
-        if (isValidTime(h, m, s, ms)) {
-            hour = h;
-            minute = m;
-            second = s;
-            millisecond = ms;
-        } else {
-            std::string message{"Error parsing time: '" + timeStamp + "'. Time is invalid."};
-            throw InvalidTimeException(message);
+    /**
+     * @brief Converts an array of @c HHMMSSmmm integers to time stamps, see @c fromHmsmInt.
+     *
+     * The validity bitmask has the layout of the @c DateBatchParser one: bit @c i%64 of word @c i/64 is set if
+     * integer @c i is a valid time stamp. Invalid entries are set to a default constructed @c TimeStamp.
+     * @param hmsm
+     *          The integers to convert.
+     * @param count
+     *          The number of integers.
+     * @param out
+     *          The preallocated array of at least @p count time stamps to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c DateBatchParser::validMaskSize(count) words to write to.
+     * @return The number of valid time stamps.
+     */
+    std::size_t TimeStamp::fromHmsmInts(const std::int32_t* hmsm, std::size_t count, TimeStamp* out,
+                                        std::uint64_t* validMask) {
+        std::size_t valid{0};
+        for (std::size_t begin{0}; begin < count; begin += MASK_WORD_BITS) {
+            const std::size_t size{std::min(MASK_WORD_BITS, count - begin)};
+            std::uint64_t word{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                int h{0};
+                int m{0};
+                int s{0};
+                int ms{0};
+                // A negative integer becomes an hour above consts::HOUR_MAX.
+                detail::decodeHmsmInt(static_cast<std::uint32_t>(hmsm[begin + i]), h, m, s, ms);
+                const bool ok{h <= consts::HOUR_MAX && m <= consts::MINUTE_MAX && s <= consts::SECOND_MAX};
+                TimeStamp& timeStamp{out[begin + i]};
+                timeStamp.hour = ok ? h : 0;
+                timeStamp.minute = ok ? m : 0;
+                timeStamp.second = ok ? s : 0;
+                timeStamp.millisecond = ok ? ms : 0;
+                word |= std::uint64_t{ok} << i;
+                valid += ok;
+            }
+            validMask[begin / MASK_WORD_BITS] = word;
         }
+        return valid;
     }
 
     /**
-     * @brief Formats a time component by adding leading '0' if the component is below 10.
-     * @param component
-     *          The component to format.
-     * @return The formatted component.
+     * @brief Converts an array of time stamps to @c HHMMSSmmm integers, see @c toHmsmInt.
+     * @param timeStamps
+     *          The time stamps to convert.
+     * @param count
+     *          The number of time stamps.
+     * @param out
+     *          The preallocated array of at least @p count integers to write to.
      */
-    std::string TimeStamp::formatTimeStampComponent(int component) const {
-        return (component < 10) ? consts::LEADING_ZERO + std::to_string(component) : std::to_string(component);
+    void TimeStamp::toHmsmInts(const TimeStamp* timeStamps, std::size_t count, std::int32_t* out) {
+        for (std::size_t i{0}; i < count; ++i) {
+            out[i] = timeStamps[i].toHmsmInt();
+        }
     }
 
     /**
-     * @brief Formats the millisecond time component by adding either one of two leading '0' if it is below 10/100.
-     * @param millisecondComponent
-     *          The millisecond component.
-     * @return The formatted millisecond component.
+     * @brief Parses a string representation of a time stamp.
+     *
+     * <b>Note:</b> Time stamp must be in the format: @c HH:MM:SS::MSMSMS. <br>
+     * <b>Example:</b> @c dt::TimeStamp time{"01:01:01:001"};
+     * @param timeStamp
+     *          The string representation of a time stamp to parse.
+     * @throws DateParseException
+     *          If the string representation of the time stamp doesn't match a certain pattern.
+     * @throws InvalidTimeException
+     *          If the time is invalid.
      */
-    std::string TimeStamp::formatMillisecondComponent(int millisecondComponent) const {
-        if (millisecondComponent < 100) {
-            if (millisecondComponent < 10) {
-                return "00" + std::to_string(millisecondComponent);
-            }
-            return consts::LEADING_ZERO + std::to_string(millisecondComponent);
+    void TimeStamp::parse(std::string_view timeStamp) {
+        ParseResult<TimeStamp> result{tryParse(timeStamp)};
+        if (result) {
+            *this = *result;
+            return;
         }
-        return std::to_string(millisecondComponent);
+        if (result.getError() == ParseError::InvalidTime) {
+            std::string message{"Error parsing time: '" + std::string{timeStamp} + "'. Time is invalid."};
+            throw InvalidTimeException(message);
+        }
+        std::string message{"Error parsing time: '" + std::string{timeStamp} + "'. Check formatting."};
+        throw DateParseException(message);
     }
 
     /**
@@ -389,7 +500,8 @@ namespace dt {
      * @return The output stream.
      */
     std::ostream& operator<<(std::ostream& os, const TimeStamp& timeStamp) {
-        os << timeStamp.toString();
+        char buffer[consts::TIME_STAMP_STRING_LENGTH];
+        os.write(buffer, timeStamp.toChars(buffer, buffer + consts::TIME_STAMP_STRING_LENGTH) - buffer);
         return os;
     }
 }
\ No newline at end of file
@@ -0,0 +1,418 @@
+/**
+ * @file CsvDateColumn.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/CsvDateColumn.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../include/dt/date/BasicFormattedDate.hpp"
+#include "../../include/dt/utils/DateBatchFormatter.hpp"
+
+namespace dt {
+    namespace {
+        constexpr std::size_t MASK_WORD_BITS{64};
+        constexpr char QUOTE{'"'};
+        constexpr char NEWLINE{'\n'};
+        constexpr char CARRIAGE_RETURN{'\r'};
+
+        // Rows formatted per write(2) call by writeFile, a multiple of MASK_WORD_BITS.
+        constexpr std::size_t WRITE_CHUNK_ROWS{4'096};
+        // Rows the vectors grow by in readAll, a multiple of MASK_WORD_BITS.
+        constexpr std::size_t READ_ALL_CHUNK_ROWS{65'536};
+
+        std::system_error makeSystemError(const std::string& what) {
+            return std::system_error{errno, std::generic_category(), what};
+        }
+
+        /**
+         * @brief Writes all of a buffer to a file descriptor, retrying short & interrupted writes.
+         */
+        void writeAll(int fd, const char* buffer, std::size_t length, const std::string& path) {
+            while (length > 0) {
+                const ssize_t written{::write(fd, buffer, length)};
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw makeSystemError("Error writing '" + path + "'");
+                }
+                buffer += written;
+                length -= static_cast<std::size_t>(written);
+            }
+        }
+
+        /**
+         * @brief Checks that every year has four digits, which @c DateBatchFormatter needs.
+         */
+        bool hasFourDigitYears(const Date* dates, std::size_t count) {
+            return std::all_of(dates, dates + count, [](const Date& date) {
+                return date.getYear() >= 0 && date.getYear() <= consts::MAX_YEAR;
+            });
+        }
+
+        /**
+         * @brief Writes a column one date at a time, a null @p validMask marks every date valid.
+         */
+        template<DateFormat F>
+        char* writeColumn(const Date* dates, std::size_t count, char* out, const std::uint64_t* validMask) {
+            for (std::size_t i{0}; i < count; ++i) {
+                if (validMask == nullptr || DateBatchParser::isValid(validMask, i)) {
+                    out = BasicFormattedDate<F>{dates[i]}.format(out);
+                }
+                *out++ = NEWLINE;
+            }
+            return out;
+        }
+    }
+
+    /**
+     * @brief @c CsvDateColumnReader constructor, maps the file.
+     * @param path
+     *          The path of the CSV file.
+     * @param column
+     *          The index of the date column, 0 for the first column.
+     * @param delimiter
+     *          The field delimiter.
+     * @param hasHeader
+     *          Whether the first row is a header row to skip.
+     * @throws std::system_error If the file can't be opened or mapped.
+     */
+    CsvDateColumnReader::CsvDateColumnReader(const std::string& path, std::size_t column, char delimiter,
+                                             bool hasHeader)
+        : column{column},
+          delimiter{delimiter} {
+        const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd < 0) {
+            throw makeSystemError("Error opening '" + path + "'");
+        }
+        struct stat status{};
+        if (::fstat(fd, &status) < 0) {
+            const std::system_error error{makeSystemError("Error reading the size of '" + path + "'")};
+            ::close(fd);
+            throw error;
+        }
+
+        size = static_cast<std::size_t>(status.st_size);
+        if (size > 0) {
+            void* mapping{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+            if (mapping == MAP_FAILED) {
+                const std::system_error error{makeSystemError("Error mapping '" + path + "'")};
+                ::close(fd);
+                throw error;
+            }
+            data = static_cast<const char*>(mapping);
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+        }
+        // The mapping keeps the file alive.
+        ::close(fd);
+
+        if (hasHeader) {
+            position = skipRow(0) + 1;
+        }
+    }
+
+    /**
+     * @brief @c CsvDateColumnReader destructor, unmaps the file.
+     */
+    CsvDateColumnReader::~CsvDateColumnReader() {
+        if (data != nullptr) {
+            ::munmap(const_cast<char*>(data), size);
+        }
+    }
+
+    /**
+     * @brief Reads the dates of the next rows.
+     * @param out
+     *          The preallocated array of at least @p capacity dates to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c DateBatchParser::validMaskSize(capacity) words to write to, bit
+     *          @c i is set if row @c i of this call holds a valid date.
+     * @param capacity
+     *          The maximum number of rows to read.
+     * @param backend
+     *          The backend to decode the dates with.
+     * @return The number of rows read, 0 once the end of the file is reached.
+     */
+    std::size_t CsvDateColumnReader::read(Date* out, std::uint64_t* validMask, std::size_t capacity,
+                                          BatchBackend backend) {
+        std::string_view fields[MASK_WORD_BITS];
+        std::size_t rows{0};
+        while (rows < capacity && position < size) {
+            const std::size_t limit{std::min(MASK_WORD_BITS, capacity - rows)};
+            std::size_t block{0};
+            while (block < limit && position < size) {
+                fields[block++] = nextField();
+            }
+            DateBatchParser::parse(fields, block, out + rows, validMask + rows / MASK_WORD_BITS, backend);
+            rows += block;
+        }
+        rowsRead += rows;
+        release();
+        return rows;
+    }
+
+    /**
+     * @brief Reads the dates of all remaining rows, growing the vectors as needed. The resident set then grows with
+     * the output, use @c read to keep it bounded.
+     * @param out
+     *          The dates, resized to the number of rows read.
+     * @param validMask
+     *          The validity bitmask, resized to @c DateBatchParser::validMaskSize of the number of rows read.
+     * @param backend
+     *          The backend to decode the dates with.
+     * @return The number of rows read.
+     */
+    std::size_t CsvDateColumnReader::readAll(std::vector<Date>& out, std::vector<std::uint64_t>& validMask,
+                                             BatchBackend backend) {
+        std::size_t total{0};
+        while (!isAtEnd()) {
+            out.resize(total + READ_ALL_CHUNK_ROWS);
+            validMask.resize(DateBatchParser::validMaskSize(total + READ_ALL_CHUNK_ROWS));
+            total += read(out.data() + total, validMask.data() + total / MASK_WORD_BITS, READ_ALL_CHUNK_ROWS,
+                          backend);
+        }
+        out.resize(total);
+        validMask.resize(DateBatchParser::validMaskSize(total));
+        return total;
+    }
+
+    /**
+     * @brief Checks if every row has been read.
+     * @return @c true if every row has been read, @c false otherwise.
+     */
+    bool CsvDateColumnReader::isAtEnd() const {
+        return position >= size;
+    }
+
+    /**
+     * @brief Gets the number of rows read so far, not counting the header.
+     * @return The number of rows read.
+     */
+    std::uint64_t CsvDateColumnReader::getRowsRead() const {
+        return rowsRead;
+    }
+
+    /**
+     * @brief Gets the size of the file.
+     * @return The size of the file in bytes.
+     */
+    std::size_t CsvDateColumnReader::getFileSize() const {
+        return size;
+    }
+
+    /**
+     * @brief Finds the field of the column in the next row & moves past the row. Quotes around the field & a trailing
+     * @c \\r are stripped.
+     * @return The field, empty if the row has no such column.
+     */
+    std::string_view CsvDateColumnReader::nextField() {
+        std::size_t i{position};
+        for (std::size_t field{0}; field < column; ++field) {
+            if (i < size && data[i] == QUOTE) {
+                i = skipQuoted(i);
+            }
+            while (i < size && data[i] != delimiter && data[i] != NEWLINE) {
+                ++i;
+            }
+            if (i >= size || data[i] == NEWLINE) {
+                position = i + 1;
+                return {};
+            }
+            ++i;
+        }
+
+        std::string_view result;
+        if (i < size && data[i] == QUOTE) {
+            const std::size_t close{skipQuoted(i)};
+            const std::size_t length{close - i - 1};
+            const bool closed{length > 0 && data[close - 1] == QUOTE};
+            result = {data + i + 1, closed ? length - 1 : length};
+            i = close;
+            while (i < size && data[i] != delimiter && data[i] != NEWLINE) {
+                ++i;
+            }
+        } else {
+            const std::size_t start{i};
+            while (i < size && data[i] != delimiter && data[i] != NEWLINE) {
+                ++i;
+            }
+            result = {data + start, i - start};
+            if (!result.empty() && result.back() == CARRIAGE_RETURN) {
+                result.remove_suffix(1);
+            }
+        }
+
+        position = skipRow(i) + 1;
+        return result;
+    }
+
+    /**
+     * @brief Skips the rest of a row, only walking it quote by quote if it has quotes.
+     * @param i
+     *          The index to start from.
+     * @return The index of the newline ending the row, or the size of the file for the last row.
+     */
+    std::size_t CsvDateColumnReader::skipRow(std::size_t i) const {
+        if (i >= size) {
+            return size;
+        }
+        const auto* newline{static_cast<const char*>(std::memchr(data + i, NEWLINE, size - i))};
+        const std::size_t end{newline != nullptr ? static_cast<std::size_t>(newline - data) : size};
+        if (std::memchr(data + i, QUOTE, end - i) == nullptr) {
+            return end;
+        }
+        while (i < size && data[i] != NEWLINE) {
+            i = data[i] == QUOTE ? skipQuoted(i) : i + 1;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Skips a quoted field, where a doubled quote stands for one quote.
+     * @param i
+     *          The index of the opening quote.
+     * @return The index one past the closing quote, or the size of the file if it is never closed.
+     */
+    std::size_t CsvDateColumnReader::skipQuoted(std::size_t i) const {
+        ++i;
+        while (i < size) {
+            const auto* quote{static_cast<const char*>(std::memchr(data + i, QUOTE, size - i))};
+            if (quote == nullptr) {
+                return size;
+            }
+            i = static_cast<std::size_t>(quote - data) + 1;
+            if (i >= size || data[i] != QUOTE) {
+                return i;
+            }
+            ++i;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Drops the pages that have been read from the resident set, they are read back from the file if needed.
+     */
+    void CsvDateColumnReader::release() {
+        static const auto pageSize{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+        const std::size_t end{std::min(position, size) / pageSize * pageSize};
+        if (end > released) {
+            ::madvise(const_cast<char*>(data) + released, end - released, MADV_DONTNEED);
+            released = end;
+        }
+    }
+
+    /**
+     * @brief Gets the size of the buffer needed to write a column of dates, whatever their years.
+     * @param count
+     *          The number of dates.
+     * @return The size of the buffer in bytes.
+     */
+    std::size_t CsvDateColumnWriter::bufferSize(std::size_t count) {
+        return count * (consts::DATE_MAX_STRING_LENGTH + 1);
+    }
+
+    /**
+     * @brief Writes a column of dates, one per line. Nothing is allocated & no terminating null is written.
+     * @param dates
+     *          The dates.
+     * @param count
+     *          The number of dates.
+     * @param format
+     *          The date format to write the dates in.
+     * @param out
+     *          The buffer to write to, at least @c bufferSize(count) bytes long.
+     * @param validMask
+     *          An optional validity bitmask, dates whose bit is not set are written as empty fields.
+     * @return The number of bytes written.
+     */
+    std::size_t CsvDateColumnWriter::write(const Date* dates, std::size_t count, DateFormat format, char* out,
+                                           const std::uint64_t* validMask) {
+        if (validMask == nullptr && hasFourDigitYears(dates, count)) {
+            return DateBatchFormatter::formatDelimited(dates, count, format, out, NEWLINE);
+        }
+        char* end{out};
+        switch (format) {
+            case DateFormat::DD_MM_YYYY:
+                end = writeColumn<DateFormat::DD_MM_YYYY>(dates, count, out, validMask);
+                break;
+            case DateFormat::MM_DD_YYYY:
+                end = writeColumn<DateFormat::MM_DD_YYYY>(dates, count, out, validMask);
+                break;
+            case DateFormat::YYYY_MM_DD:
+                end = writeColumn<DateFormat::YYYY_MM_DD>(dates, count, out, validMask);
+                break;
+            case DateFormat::YYYY_DD_MM:
+                end = writeColumn<DateFormat::YYYY_DD_MM>(dates, count, out, validMask);
+                break;
+            case DateFormat::DD__MM__YYYY:
+                end = writeColumn<DateFormat::DD__MM__YYYY>(dates, count, out, validMask);
+                break;
+            case DateFormat::MM__DD__YYYY:
+                end = writeColumn<DateFormat::MM__DD__YYYY>(dates, count, out, validMask);
+                break;
+            case DateFormat::YYYY__MM__DD:
+                end = writeColumn<DateFormat::YYYY__MM__DD>(dates, count, out, validMask);
+                break;
+            case DateFormat::YYYY__DD__MM:
+                end = writeColumn<DateFormat::YYYY__DD__MM>(dates, count, out, validMask);
+                break;
+        }
+        return static_cast<std::size_t>(end - out);
+    }
+
+    /**
+     * @brief Writes a column of dates to a file, through a fixed size buffer so memory use does not grow with the
+     * number of dates.
+     * @param path
+     *          The path of the file, created or truncated.
+     * @param header
+     *          The header row, written on its own line unless empty.
+     * @param dates
+     *          The dates.
+     * @param count
+     *          The number of dates.
+     * @param format
+     *          The date format to write the dates in.
+     * @param validMask
+     *          An optional validity bitmask, dates whose bit is not set are written as empty fields.
+     * @throws std::system_error If the file can't be opened or written.
+     */
+    void CsvDateColumnWriter::writeFile(const std::string& path, std::string_view header, const Date* dates,
+                                        std::size_t count, DateFormat format, const std::uint64_t* validMask) {
+        const int fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+        if (fd < 0) {
+            throw makeSystemError("Error opening '" + path + "'");
+        }
+
+        std::vector<char> buffer(bufferSize(WRITE_CHUNK_ROWS));
+        try {
+            if (!header.empty()) {
+                writeAll(fd, header.data(), header.size(), path);
+                writeAll(fd, &NEWLINE, 1, path);
+            }
+            for (std::size_t begin{0}; begin < count; begin += WRITE_CHUNK_ROWS) {
+                const std::size_t rows{std::min(WRITE_CHUNK_ROWS, count - begin)};
+                const std::uint64_t* mask{validMask != nullptr ? validMask + begin / MASK_WORD_BITS : nullptr};
+                writeAll(fd, buffer.data(), write(dates + begin, rows, format, buffer.data(), mask), path);
+            }
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+        if (::close(fd) < 0) {
+            throw makeSystemError("Error closing '" + path + "'");
+        }
+    }
+}
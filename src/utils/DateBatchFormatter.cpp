@@ -0,0 +1,376 @@
+/**
+ * @file DateBatchFormatter.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/DateBatchFormatter.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../../include/dt/utils/FormatUtils.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DT_FORMAT_X86 1
+#include <immintrin.h>
+#endif
+
+namespace dt {
+    namespace {
+        constexpr std::size_t BLOCK_SIZE{64};
+        constexpr std::size_t DELIMITED_STRIDE{consts::DATE_STRING_LENGTH + 1};
+
+        /**
+         * @brief The components of up to @c BLOCK_SIZE dates, one array per component so that the digits can be
+         * computed several dates at a time.
+         */
+        struct ComponentBlock {
+            alignas(32) std::int32_t days[BLOCK_SIZE];
+            alignas(32) std::int32_t months[BLOCK_SIZE];
+            alignas(32) std::int32_t years[BLOCK_SIZE];
+        };
+
+        /**
+         * @brief Where the formatted dates go: date @c i starts at @c out + @c i * @c stride, followed by the
+         * delimiter if there is one.
+         */
+        struct Output {
+            char* out;
+            std::size_t stride;
+            char delimiter;
+            bool delimited;
+        };
+
+        template<DateFormat F>
+        using FormatTag = std::integral_constant<DateFormat, F>;
+
+        /**
+         * @brief Calls @p function with a @c FormatTag for the runtime date format, so it can be formatted with a
+         * compile time layout.
+         */
+        template<typename Function>
+        void withFormat(DateFormat format, Function function) {
+            switch (format) {
+                case DateFormat::DD_MM_YYYY:
+                    return function(FormatTag<DateFormat::DD_MM_YYYY>{});
+                case DateFormat::MM_DD_YYYY:
+                    return function(FormatTag<DateFormat::MM_DD_YYYY>{});
+                case DateFormat::YYYY_MM_DD:
+                    return function(FormatTag<DateFormat::YYYY_MM_DD>{});
+                case DateFormat::YYYY_DD_MM:
+                    return function(FormatTag<DateFormat::YYYY_DD_MM>{});
+                case DateFormat::DD__MM__YYYY:
+                    return function(FormatTag<DateFormat::DD__MM__YYYY>{});
+                case DateFormat::MM__DD__YYYY:
+                    return function(FormatTag<DateFormat::MM__DD__YYYY>{});
+                case DateFormat::YYYY__MM__DD:
+                    return function(FormatTag<DateFormat::YYYY__MM__DD>{});
+                case DateFormat::YYYY__DD__MM:
+                    return function(FormatTag<DateFormat::YYYY__DD__MM>{});
+            }
+        }
+
+        /**
+         * @brief Checks that every year of a block has four digits, the layouts & lookup tables have no room for
+         * more.
+         */
+        bool hasFourDigitYears(const ComponentBlock& block, std::size_t size) {
+            bool fourDigits{true};
+            for (std::size_t i{0}; i < size; ++i) {
+                // No early exit, so the loop vectorises. A negative year wraps to above the maximum.
+                fourDigits &= static_cast<std::uint32_t>(block.years[i]) <= consts::MAX_YEAR;
+            }
+            return fourDigits;
+        }
+
+        /**
+         * @brief Formats the dates @p begin to @p end of a block with the two digit lookup table.
+         */
+        template<DateFormat F>
+        void formatScalar(const ComponentBlock& block, std::size_t begin, std::size_t end, const Output& output) {
+            constexpr detail::DateLayout layout{detail::getDateLayout(F)};
+            const Output local{output}; // Stores through char* could alias output, keep it in registers.
+            for (std::size_t i{begin}; i < end; ++i) {
+                char* out{local.out + i * local.stride};
+                detail::writeTwoDigits(out + layout.dayOffset, block.days[i]);
+                detail::writeTwoDigits(out + layout.monthOffset, block.months[i]);
+                detail::writeFourDigits(out + layout.yearOffset, block.years[i]);
+                out[layout.firstSeparatorOffset] = layout.separator;
+                out[layout.secondSeparatorOffset] = layout.separator;
+                if (local.delimited) {
+                    out[consts::DATE_STRING_LENGTH] = local.delimiter;
+                }
+            }
+        }
+
+#ifdef DT_FORMAT_X86
+        /**
+         * @brief The 16 bytes of a constant vector, built at compile time from a layout.
+         */
+        struct ByteVector {
+            std::int8_t bytes[16];
+        };
+
+        /**
+         * @brief Builds the byte shuffle that moves the digits of one date of a pair into the layout, see
+         * @c formatAvx2. The other bytes are zeroed for the separators to be or'ed in.
+         * @param source
+         *          Where the digits of the date start in the pair, 0 or 8.
+         */
+        constexpr ByteVector makeShuffle(const detail::DateLayout& layout, std::size_t source) {
+            ByteVector shuffle{};
+            for (std::size_t i{0}; i < 16; ++i) {
+                std::size_t from{source};
+                if (i >= layout.yearOffset && i < layout.yearOffset + 4) {
+                    from += i - layout.yearOffset;
+                } else if (i >= layout.monthOffset && i < layout.monthOffset + 2) {
+                    from += 4 + i - layout.monthOffset;
+                } else if (i >= layout.dayOffset && i < layout.dayOffset + 2) {
+                    from += 6 + i - layout.dayOffset;
+                } else {
+                    shuffle.bytes[i] = -128;
+                    continue;
+                }
+                shuffle.bytes[i] = static_cast<std::int8_t>(from);
+            }
+            return shuffle;
+        }
+
+        constexpr ByteVector makeSeparators(const detail::DateLayout& layout) {
+            ByteVector separators{};
+            separators.bytes[layout.firstSeparatorOffset] = layout.separator;
+            separators.bytes[layout.secondSeparatorOffset] = layout.separator;
+            return separators;
+        }
+
+        __attribute__((target("avx2")))
+        inline __m128i loadBytes(const ByteVector& vector) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(vector.bytes));
+        }
+
+        /**
+         * @brief Splits numbers from 0 to 99 into their two ASCII digits, tens in the low byte & units in the high
+         * byte of each 32-bit lane. The division by 10 is a multiply high by 6554 / 65536.
+         */
+        __attribute__((target("avx2")))
+        inline __m256i twoDigitsAvx2(__m256i values) {
+            const __m256i tens{_mm256_mulhi_epu16(values, _mm256_set1_epi32(6'554))};
+            const __m256i units{_mm256_sub_epi16(values, _mm256_mullo_epi16(tens, _mm256_set1_epi32(10)))};
+            return _mm256_add_epi32(_mm256_or_si256(tens, _mm256_slli_epi32(units, 8)), _mm256_set1_epi32(0x3030));
+        }
+
+        /**
+         * @brief Writes one date from a shuffled pair: 8 bytes, then the last 2 digits, then the delimiter.
+         */
+        __attribute__((target("avx2")))
+        inline void storeDate(__m128i date, char* out, Output output) {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), date);
+            const auto tail{static_cast<std::uint16_t>(_mm_extract_epi16(date, 4))};
+            std::memcpy(out + 8, &tail, sizeof(tail));
+            if (output.delimited) {
+                out[consts::DATE_STRING_LENGTH] = output.delimiter;
+            }
+        }
+
+        /**
+         * @brief Copies the components of dates stored as 2 ints each, the days since the epoch & the packed year,
+         * month & day, into one array per component, 8 dates at a time.
+         * @return The number of dates copied, a multiple of 8.
+         */
+        __attribute__((target("avx2")))
+        std::size_t transposeAvx2(const std::int32_t* dates, std::size_t size, std::int32_t* days,
+                                  std::int32_t* months, std::int32_t* years) {
+            std::size_t i{0};
+            for (; i + 8 <= size; i += 8) {
+                const auto* source{reinterpret_cast<const __m256*>(dates + i * 2)};
+                // Every 256-bit load holds 4 dates, the shuffle keeps their packed halves in the order 0 1 4 5 2 3 6 7.
+                const __m256 packed{_mm256_shuffle_ps(_mm256_loadu_ps(reinterpret_cast<const float*>(source)),
+                                                      _mm256_loadu_ps(reinterpret_cast<const float*>(source + 1)),
+                                                      _MM_SHUFFLE(3, 1, 3, 1))};
+                const __m256i order{_mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7)};
+                const __m256i components{_mm256_permutevar8x32_epi32(_mm256_castps_si256(packed), order)};
+                _mm256_store_si256(reinterpret_cast<__m256i*>(years + i),
+                                   _mm256_srai_epi32(_mm256_slli_epi32(components, 16), 16));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(months + i),
+                                   _mm256_and_si256(_mm256_srli_epi32(components, 16), _mm256_set1_epi32(0xFF)));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(days + i), _mm256_srli_epi32(components, 24));
+            }
+            return i;
+        }
+
+        /**
+         * @brief Formats a block 8 dates at a time.
+         *
+         * The digits of each date are packed into 8 bytes, @c YYYYMMDD, and every 128-bit half of the packed vectors
+         * holds two dates. One shuffle per date then moves its digits into the layout & the separators are or'ed in.
+         */
+        template<DateFormat F>
+        __attribute__((target("avx2")))
+        void formatAvx2(const ComponentBlock& block, std::size_t size, const Output& output) {
+            constexpr detail::DateLayout layout{detail::getDateLayout(F)};
+            static constexpr ByteVector FIRST_SHUFFLE{makeShuffle(layout, 0)};
+            static constexpr ByteVector SECOND_SHUFFLE{makeShuffle(layout, 8)};
+            static constexpr ByteVector SEPARATORS{makeSeparators(layout)};
+            const __m128i first{loadBytes(FIRST_SHUFFLE)};
+            const __m128i second{loadBytes(SECOND_SHUFFLE)};
+            const __m128i separators{loadBytes(SEPARATORS)};
+            const Output local{output};
+
+            std::size_t i{0};
+            for (; i + 8 <= size; i += 8) {
+                const __m256i days{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.days + i))};
+                const __m256i months{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.months + i))};
+                const __m256i years{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.years + i))};
+
+                // y / 100 == y * 5243 >> 19 for every 4 digit year.
+                const __m256i centuries{_mm256_srli_epi32(_mm256_mulhi_epu16(years, _mm256_set1_epi32(5'243)), 3)};
+                const __m256i yearsOfCentury{_mm256_sub_epi32(years,
+                                                              _mm256_mullo_epi16(centuries, _mm256_set1_epi32(100)))};
+                const __m256i yyyy{_mm256_or_si256(twoDigitsAvx2(centuries),
+                                                   _mm256_slli_epi32(twoDigitsAvx2(yearsOfCentury), 16))};
+                const __m256i mmdd{_mm256_or_si256(twoDigitsAvx2(months),
+                                                   _mm256_slli_epi32(twoDigitsAvx2(days), 16))};
+
+                // Halves of low: dates 0 & 1, 4 & 5. Halves of high: dates 2 & 3, 6 & 7.
+                const __m256i low{_mm256_unpacklo_epi32(yyyy, mmdd)};
+                const __m256i high{_mm256_unpackhi_epi32(yyyy, mmdd)};
+                const __m128i pairs[4] {
+                    _mm256_castsi256_si128(low), _mm256_castsi256_si128(high),
+                    _mm256_extracti128_si256(low, 1), _mm256_extracti128_si256(high, 1)
+                };
+                char* out{local.out + i * local.stride};
+                for (const __m128i& pair : pairs) {
+                    storeDate(_mm_or_si128(_mm_shuffle_epi8(pair, first), separators), out, local);
+                    storeDate(_mm_or_si128(_mm_shuffle_epi8(pair, second), separators), out + local.stride, local);
+                    out += 2 * local.stride;
+                }
+            }
+            // The scalar tail is a sibling call, which skips the implicit vzeroupper & leaves the caller's SSE code
+            // paying for the dirty upper halves.
+            _mm256_zeroupper();
+            formatScalar<F>(block, i, size, output);
+        }
+#endif
+
+        /**
+         * @brief Resolves the requested backend to one the CPU supports. Only AVX2 has a vector formatter.
+         */
+        BatchBackend resolveBackend(BatchBackend requested) {
+            BatchBackend supported{DateBatchParser::getSupportedBackend()};
+            BatchBackend resolved{requested == BatchBackend::Auto ? supported : std::min(requested, supported)};
+            return resolved == BatchBackend::AVX2 ? BatchBackend::AVX2 : BatchBackend::Scalar;
+        }
+
+        /**
+         * @brief Formats a batch one block at a time, loading each block with @p load first.
+         * @return False if a year is outside 0-9999, the blocks before the one holding it are written.
+         */
+        template<typename Load>
+        bool formatBlocks(std::size_t count, DateFormat format, Output output, BatchBackend backend, Load load) {
+            const BatchBackend resolved{resolveBackend(backend)};
+            bool formatted{true};
+            withFormat(format, [&](auto tag) {
+                constexpr DateFormat F{decltype(tag)::value};
+                ComponentBlock block;
+                for (std::size_t begin{0}; begin < count; begin += BLOCK_SIZE) {
+                    const std::size_t size{std::min(BLOCK_SIZE, count - begin)};
+                    load(begin, size, resolved, block);
+                    if (!hasFourDigitYears(block, size)) {
+                        formatted = false;
+                        return;
+                    }
+                    const Output blockOutput{output.out + begin * output.stride, output.stride, output.delimiter,
+                                             output.delimited};
+#ifdef DT_FORMAT_X86
+                    if (resolved == BatchBackend::AVX2) {
+                        formatAvx2<F>(block, size, blockOutput);
+                        continue;
+                    }
+#endif
+                    formatScalar<F>(block, 0, size, blockOutput);
+                }
+            });
+            return formatted;
+        }
+    }
+
+    /**
+     * @brief Formats dates into fixed width slots, e.g. a fixed width column. The bytes between two dates are left
+     * untouched & no terminating null is written.
+     * @param dates
+     *          The dates to format.
+     * @param count
+     *          The number of dates.
+     * @param format
+     *          The date format to write the dates in.
+     * @param out
+     *          The buffer to write to, at least (@p count - 1) * @p stride + @c consts::DATE_STRING_LENGTH bytes long.
+     * @param stride
+     *          The distance in bytes between the start of two consecutive dates, at least
+     *          @c consts::DATE_STRING_LENGTH.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return False if a year is outside 0-9999, in which case only some of the dates may have been written.
+     */
+    bool DateBatchFormatter::formatFixed(const Date* dates, std::size_t count, DateFormat format, char* out,
+                                         std::size_t stride, BatchBackend backend) {
+        return formatBlocks(count, format, {out, stride, '\0', false}, backend,
+                     [dates](std::size_t begin, std::size_t size, BatchBackend resolved, ComponentBlock& block) {
+            loadComponents(dates + begin, size, resolved, block.days, block.months, block.years);
+        });
+    }
+
+    /**
+     * @brief Formats dates each followed by a delimiter, e.g. one date per line. No terminating null is written.
+     * @param dates
+     *          The dates to format.
+     * @param count
+     *          The number of dates.
+     * @param format
+     *          The date format to write the dates in.
+     * @param out
+     *          The buffer to write to, at least @p count * (@c consts::DATE_STRING_LENGTH + 1) bytes long.
+     * @param delimiter
+     *          The character written after every date, including the last.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return The number of bytes written, or 0 if a year is outside 0-9999, in which case only some of the dates
+     * may have been written.
+     */
+    std::size_t DateBatchFormatter::formatDelimited(const Date* dates, std::size_t count, DateFormat format, char* out,
+                                                    char delimiter, BatchBackend backend) {
+        const bool formatted{formatBlocks(count, format, {out, DELIMITED_STRIDE, delimiter, true}, backend,
+                                          [dates](std::size_t begin, std::size_t size, BatchBackend resolved,
+                                                  ComponentBlock& block) {
+            loadComponents(dates + begin, size, resolved, block.days, block.months, block.years);
+        })};
+        return formatted ? count * DELIMITED_STRIDE : 0;
+    }
+
+    /**
+     * @brief Copies the components of a block of dates into one array per component, the arrays are 32 byte
+     * aligned.
+     */
+    void DateBatchFormatter::loadComponents(const Date* dates, std::size_t size, BatchBackend backend,
+                                            std::int32_t* days, std::int32_t* months, std::int32_t* years) {
+        std::size_t i{0};
+#ifdef DT_FORMAT_X86
+        static_assert(sizeof(Date) == 2 * sizeof(std::int32_t) && offsetof(Date, year) == sizeof(std::int32_t) &&
+                      offsetof(Date, month) == offsetof(Date, year) + 2 &&
+                      offsetof(Date, day) == offsetof(Date, month) + 1,
+                      "transposeAvx2 expects a Date to be its days since the epoch followed by the year, month & day");
+        if (backend == BatchBackend::AVX2) {
+            i = transposeAvx2(reinterpret_cast<const std::int32_t*>(dates), size, days, months, years);
+        }
+#endif
+        for (; i < size; ++i) {
+            days[i] = dates[i].day;
+            months[i] = dates[i].month;
+            years[i] = dates[i].year;
+        }
+    }
+}
@@ -0,0 +1,522 @@
+/**
+ * @file DateBatchParser.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/DateBatchParser.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DT_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace dt {
+    namespace {
+        constexpr std::size_t MASK_WORD_BITS{64};
+        static_assert(DateBatchParser::validMaskSize(MASK_WORD_BITS + 1) == 2, "validMaskSize assumes 64-bit words");
+        constexpr std::size_t BLOCK_SIZE{MASK_WORD_BITS};
+        constexpr std::size_t LANE_WIDTH{16};
+
+        /**
+         * @brief The components of up to @c BLOCK_SIZE dates, one array per component so that the calendar checks
+         * can be done several dates at a time. A block fills exactly one word of the validity bitmask.
+         *
+         * The decoders write the first & second day/month components into @c days & @c months, the day/month order
+         * is then resolved in place & the days since the epoch of every valid date are filled in.
+         */
+        struct DecodedBlock {
+            alignas(32) std::int32_t years[BLOCK_SIZE];
+            alignas(32) std::int32_t days[BLOCK_SIZE];
+            alignas(32) std::int32_t months[BLOCK_SIZE];
+            alignas(32) std::int32_t serials[BLOCK_SIZE];
+            std::uint64_t matched;
+            std::uint64_t valid;
+        };
+
+        /**
+         * @brief Reads the dates of a contiguous buffer where each date starts @c stride bytes after the previous one.
+         */
+        struct BufferSource {
+            const char* buffer;
+            std::size_t stride;
+            std::size_t size;
+
+            std::string_view view(std::size_t i) const {
+                return {buffer + i * stride, consts::DATE_STRING_LENGTH};
+            }
+
+            bool canLoadLane(std::size_t i) const {
+                return i * stride + LANE_WIDTH <= size;
+            }
+        };
+
+        /**
+         * @brief Reads the dates of an array of string views.
+         */
+        struct ViewSource {
+            const std::string_view* dates;
+
+            std::string_view view(std::size_t i) const {
+                return dates[i];
+            }
+
+            bool canLoadLane(std::size_t) const {
+                return false; // Nothing is known about the memory after a view, so it is never over-read.
+            }
+        };
+
+        template<typename Source>
+        void decodeScalar(const Source& source, std::size_t begin, std::size_t size, DecodedBlock& block) {
+            std::uint64_t matched{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                std::string_view date{source.view(begin + i)};
+                bool ok{date.size() == consts::DATE_STRING_LENGTH &&
+                         detail::decodeNumericDate(date.data(), block.years[i], block.days[i], block.months[i])};
+                matched |= std::uint64_t{ok} << i;
+            }
+            block.matched = matched;
+        }
+
+        /**
+         * @brief Resolves the day/month order of a block, trying the first component as the day before swapping
+         * them, exactly like @c Date::convertStrToDate.
+         *
+         * Which order is valid is close to random on real data, so both orders are checked and the result is
+         * selected without branching.
+         */
+        void resolveScalar(std::size_t size, DecodedBlock& block) {
+            std::uint64_t valid{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                int year{block.years[i]};
+                int first{block.days[i]};
+                int second{block.months[i]};
+                bool firstIsDay{detail::isValidDate(first, second, year)};
+                bool secondIsDay{detail::isValidDate(second, first, year)};
+                block.days[i] = firstIsDay ? first : second;
+                block.months[i] = firstIsDay ? second : first;
+                block.serials[i] = firstIsDay || secondIsDay
+                                   ? detail::daysFromCivil(year, block.months[i], block.days[i]) : 0;
+                valid |= std::uint64_t{firstIsDay || secondIsDay} << i;
+            }
+            block.valid = block.matched & valid;
+        }
+
+#ifdef DT_BATCH_X86
+        // Digit & separator positions of each layout, as bit masks over the first 10 bytes of a lane.
+        constexpr int LAYOUT_MASK{0x3FF};
+        constexpr int YEAR_FIRST_DIGITS{0x36F};     // XXXX-XX-XX
+        constexpr int YEAR_FIRST_SEPARATORS{0x090};
+        constexpr int YEAR_LAST_DIGITS{0x3DB};      // XX-XX-XXXX
+        constexpr int YEAR_LAST_SEPARATORS{0x024};
+
+        enum Layout {
+            NO_LAYOUT,
+            YEAR_FIRST,
+            YEAR_LAST,
+        };
+
+        // Moves the digits of each layout to: Y Y Y Y A A _ _ B B _ _ _ _ _ _ (-1 zeroes the byte).
+        alignas(16) constexpr int8_t LAYOUT_SHUFFLES[3][LANE_WIDTH] {
+            {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+            { 0,  1,  2,  3,  5,  6, -1, -1,  8,  9, -1, -1, -1, -1, -1, -1},
+            { 6,  7,  8,  9,  0,  1, -1, -1,  3,  4, -1, -1, -1, -1, -1, -1},
+        };
+
+        inline int classifyLane(int digits, int dashes, int slashes) {
+            digits &= LAYOUT_MASK;
+            if (digits == YEAR_FIRST_DIGITS &&
+                ((dashes & YEAR_FIRST_SEPARATORS) == YEAR_FIRST_SEPARATORS ||
+                 (slashes & YEAR_FIRST_SEPARATORS) == YEAR_FIRST_SEPARATORS)) {
+                return YEAR_FIRST;
+            }
+            if (digits == YEAR_LAST_DIGITS &&
+                ((dashes & YEAR_LAST_SEPARATORS) == YEAR_LAST_SEPARATORS ||
+                 (slashes & YEAR_LAST_SEPARATORS) == YEAR_LAST_SEPARATORS)) {
+                return YEAR_LAST;
+            }
+            return NO_LAYOUT;
+        }
+
+        template<typename Source>
+        __attribute__((target("ssse3")))
+        inline __m128i loadLane(const Source& source, std::size_t i) {
+            std::string_view date{source.view(i)};
+            if (source.canLoadLane(i)) {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(date.data()));
+            }
+            if (date.size() != consts::DATE_STRING_LENGTH) {
+                return _mm_setzero_si128();
+            }
+
+            // Exactly 10 bytes: an 8 byte load plus the last 2 bytes, avoiding a store-forwarding stall on a copy.
+            std::uint16_t tail;
+            std::memcpy(&tail, date.data() + 8, sizeof(tail));
+            __m128i head{_mm_loadl_epi64(reinterpret_cast<const __m128i*>(date.data()))};
+            return _mm_insert_epi16(head, tail, 4);
+        }
+
+        __attribute__((target("ssse3")))
+        inline __m128i loadShuffle(int layout) {
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(LAYOUT_SHUFFLES[layout]));
+        }
+
+        /**
+         * @brief Decodes one date per 128-bit register: validates the digits & separators with byte compares, then
+         * combines the digits with two multiply-adds (pairs of digits, then the two halves of the year).
+         * @return @c true if the lane matched one of the layouts, @c false otherwise.
+         */
+        __attribute__((target("ssse3")))
+        inline bool decodeLane(__m128i lane, std::size_t i, DecodedBlock& block) {
+            const __m128i digitValues{_mm_sub_epi8(lane, _mm_set1_epi8('0'))};
+            int digits{_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digitValues, _mm_set1_epi8(9)), digitValues))};
+            int dashes{_mm_movemask_epi8(_mm_cmpeq_epi8(lane, _mm_set1_epi8(consts::DATE_SEPARATOR_DASH)))};
+            int slashes{_mm_movemask_epi8(_mm_cmpeq_epi8(lane, _mm_set1_epi8(consts::DATE_SEPARATOR_SLASH)))};
+            int layout{classifyLane(digits, dashes, slashes)};
+
+            __m128i pairs{_mm_maddubs_epi16(_mm_shuffle_epi8(digitValues, loadShuffle(layout)),
+                                            _mm_set1_epi16(0x010A))}; // 10, 1
+            alignas(16) std::int32_t fields[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(fields),
+                            _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 1, 0, 1, 0, 0, 0)));
+            block.years[i] = fields[0];
+            block.days[i] = fields[1];
+            block.months[i] = fields[2];
+            return layout != NO_LAYOUT;
+        }
+
+        template<typename Source>
+        __attribute__((target("ssse3")))
+        void decodeSsse3(const Source& source, std::size_t begin, std::size_t size, DecodedBlock& block) {
+            std::uint64_t matched{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                matched |= std::uint64_t{decodeLane(loadLane(source, begin + i), i, block)} << i;
+            }
+            block.matched = matched;
+        }
+
+        /**
+         * @brief Same as @c decodeSsse3 but decodes two dates per 256-bit register, one in each 128-bit half.
+         */
+        template<typename Source>
+        __attribute__((target("avx2")))
+        void decodeAvx2(const Source& source, std::size_t begin, std::size_t size, DecodedBlock& block) {
+            const __m256i zeroChar{_mm256_set1_epi8('0')};
+            const __m256i nine{_mm256_set1_epi8(9)};
+            const __m256i dash{_mm256_set1_epi8(consts::DATE_SEPARATOR_DASH)};
+            const __m256i slash{_mm256_set1_epi8(consts::DATE_SEPARATOR_SLASH)};
+            const __m256i pairWeights{_mm256_set1_epi16(0x010A)}; // 10, 1
+            const __m256i yearWeights{_mm256_setr_epi16(100, 1, 1, 0, 1, 0, 0, 0, 100, 1, 1, 0, 1, 0, 0, 0)};
+
+            alignas(32) std::int32_t fields[8];
+            std::uint64_t matched{0};
+            std::size_t i{0};
+            for (; i + 1 < size; i += 2) {
+                __m256i lanes{_mm256_inserti128_si256(_mm256_castsi128_si256(loadLane(source, begin + i)),
+                                                      loadLane(source, begin + i + 1), 1)};
+                __m256i digitValues{_mm256_sub_epi8(lanes, zeroChar)};
+                auto digits{static_cast<uint32_t>(
+                        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(digitValues, nine), digitValues)))};
+                auto dashes{static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lanes, dash)))};
+                auto slashes{static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lanes, slash)))};
+                int layout1{classifyLane(static_cast<int>(digits & 0xFFFF), static_cast<int>(dashes & 0xFFFF),
+                                         static_cast<int>(slashes & 0xFFFF))};
+                int layout2{classifyLane(static_cast<int>(digits >> 16), static_cast<int>(dashes >> 16),
+                                         static_cast<int>(slashes >> 16))};
+
+                __m256i shuffle{_mm256_inserti128_si256(_mm256_castsi128_si256(loadShuffle(layout1)),
+                                                        loadShuffle(layout2), 1)};
+                __m256i pairs{_mm256_maddubs_epi16(_mm256_shuffle_epi8(digitValues, shuffle), pairWeights)};
+                _mm256_store_si256(reinterpret_cast<__m256i*>(fields), _mm256_madd_epi16(pairs, yearWeights));
+
+                block.years[i] = fields[0];
+                block.days[i] = fields[1];
+                block.months[i] = fields[2];
+                block.years[i + 1] = fields[4];
+                block.days[i + 1] = fields[5];
+                block.months[i + 1] = fields[6];
+                matched |= std::uint64_t{layout1 != NO_LAYOUT} << i;
+                matched |= std::uint64_t{layout2 != NO_LAYOUT} << (i + 1);
+            }
+            if (i < size) {
+                matched |= std::uint64_t{decodeLane(loadLane(source, begin + i), i, block)} << i;
+            }
+            block.matched = matched;
+        }
+
+        /**
+         * @brief Checks 8 dates at once, see @c detail::isValidDate. The days in a month are computed rather than
+         * looked up: 30 + ((month + month / 8) & 1), or 28/29 for February.
+         */
+        __attribute__((target("avx2")))
+        inline __m256i isValidDateAvx2(__m256i day, __m256i month, __m256i validYear, __m256i leapYear) {
+            const __m256i zero{_mm256_setzero_si256()};
+            const __m256i one{_mm256_set1_epi32(1)};
+            __m256i validMonth{_mm256_and_si256(
+                    _mm256_cmpgt_epi32(month, zero),
+                    _mm256_cmpgt_epi32(_mm256_set1_epi32(consts::MAX_NUMBER_OF_MONTHS + 1), month))};
+            __m256i longMonth{_mm256_add_epi32(
+                    _mm256_set1_epi32(30),
+                    _mm256_and_si256(_mm256_add_epi32(month, _mm256_srli_epi32(month, 3)), one))};
+            __m256i february{_mm256_sub_epi32(_mm256_set1_epi32(28), leapYear)}; // leapYear is 0 or -1
+            __m256i daysInMonth{_mm256_blendv_epi8(longMonth, february,
+                                                   _mm256_cmpeq_epi32(month, _mm256_set1_epi32(2)))};
+            __m256i validDay{_mm256_and_si256(
+                    _mm256_cmpgt_epi32(day, zero),
+                    _mm256_cmpgt_epi32(_mm256_add_epi32(daysInMonth, one), day))};
+            return _mm256_and_si256(validYear, _mm256_and_si256(validMonth, validDay));
+        }
+
+        /**
+         * @brief Same as @c detail::daysFromCivil for 8 dates at once. Every year is 0-9999, so the eras are not
+         * needed & the divisions are multiplies & shifts: y / 100 is (y * 5243) >> 19 & x / 5 is (x * 52429) >> 18
+         * in this range.
+         */
+        __attribute__((target("avx2")))
+        inline __m256i daysFromCivilAvx2(__m256i year, __m256i month, __m256i day) {
+            // The year starts in March, January & February count as months 10 & 11 of the year before.
+            const __m256i early{_mm256_cmpgt_epi32(_mm256_set1_epi32(3), month)};
+            const __m256i y{_mm256_add_epi32(year, early)}; // early is 0 or -1
+            const __m256i shiftedMonth{_mm256_add_epi32(month, _mm256_blendv_epi8(_mm256_set1_epi32(-3),
+                                                                                  _mm256_set1_epi32(9), early))};
+            const __m256i centuries{_mm256_srli_epi32(_mm256_mullo_epi32(y, _mm256_set1_epi32(5'243)), 19)};
+            const __m256i monthDays{_mm256_srli_epi32(_mm256_mullo_epi32(
+                    _mm256_add_epi32(_mm256_mullo_epi32(shiftedMonth, _mm256_set1_epi32(153)), _mm256_set1_epi32(2)),
+                    _mm256_set1_epi32(52'429)), 18)};
+
+            __m256i days{_mm256_mullo_epi32(y, _mm256_set1_epi32(365))};
+            days = _mm256_add_epi32(days, _mm256_srli_epi32(y, 2));
+            days = _mm256_sub_epi32(days, centuries);
+            days = _mm256_add_epi32(days, _mm256_srli_epi32(centuries, 2));
+            days = _mm256_add_epi32(days, monthDays);
+            return _mm256_add_epi32(days, _mm256_sub_epi32(day, _mm256_set1_epi32(719'468 + 1)));
+        }
+
+        /**
+         * @brief Same as @c resolveScalar but resolves 8 dates at once.
+         */
+        __attribute__((target("avx2")))
+        void resolveAvx2(std::size_t size, DecodedBlock& block) {
+            std::uint64_t valid{0};
+            for (std::size_t i{0}; i < size; i += 8) {
+                __m256i year{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.years + i))};
+                __m256i first{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.days + i))};
+                __m256i second{_mm256_load_si256(reinterpret_cast<const __m256i*>(block.months + i))};
+
+                __m256i validYear{_mm256_and_si256(
+                        _mm256_cmpgt_epi32(year, _mm256_set1_epi32(consts::MIN_YEAR - 1)),
+                        _mm256_cmpgt_epi32(_mm256_set1_epi32(consts::MAX_YEAR + 1), year))};
+                // year % 25 via a multiply & shift, exact for 0-9999, then the same test as detail::isLeapYear.
+                __m256i quotient{_mm256_srli_epi32(_mm256_mullo_epi32(year, _mm256_set1_epi32(5243)), 17)};
+                __m256i remainder{_mm256_sub_epi32(year, _mm256_mullo_epi32(quotient, _mm256_set1_epi32(25)))};
+                __m256i leapMask{_mm256_blendv_epi8(_mm256_set1_epi32(3), _mm256_set1_epi32(15),
+                                                    _mm256_cmpeq_epi32(remainder, _mm256_setzero_si256()))};
+                __m256i leapYear{_mm256_cmpeq_epi32(_mm256_and_si256(year, leapMask), _mm256_setzero_si256())};
+
+                __m256i firstIsDay{isValidDateAvx2(first, second, validYear, leapYear)};
+                __m256i secondIsDay{isValidDateAvx2(second, first, validYear, leapYear)};
+                const __m256i day{_mm256_blendv_epi8(second, first, firstIsDay)};
+                const __m256i month{_mm256_blendv_epi8(first, second, firstIsDay)};
+                _mm256_store_si256(reinterpret_cast<__m256i*>(block.days + i), day);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(block.months + i), month);
+                // Only read for valid dates, so the years out of range don't matter.
+                _mm256_store_si256(reinterpret_cast<__m256i*>(block.serials + i),
+                                   daysFromCivilAvx2(_mm256_and_si256(year, validYear), month, day));
+
+                auto bits{static_cast<unsigned>(_mm256_movemask_ps(
+                        _mm256_castsi256_ps(_mm256_or_si256(firstIsDay, secondIsDay))))};
+                valid |= std::uint64_t{bits} << i;
+            }
+            block.valid = block.matched & valid;
+        }
+
+        BatchBackend detectBackend() {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return BatchBackend::AVX2;
+            }
+            if (__builtin_cpu_supports("ssse3")) {
+                return BatchBackend::SSSE3;
+            }
+            return BatchBackend::Scalar;
+        }
+#endif
+
+        /**
+         * @brief Resolves the requested backend to one the CPU supports.
+         */
+        BatchBackend resolveBackend(BatchBackend requested) {
+            BatchBackend supported{DateBatchParser::getSupportedBackend()};
+            if (requested == BatchBackend::Auto) {
+                return supported;
+            }
+            return std::min(requested, supported);
+        }
+
+        template<typename Source>
+        void decodeBlock(const Source& source, std::size_t begin, std::size_t size, BatchBackend backend,
+                         DecodedBlock& block) {
+            switch (backend) {
+#ifdef DT_BATCH_X86
+                case BatchBackend::AVX2:
+                    decodeAvx2(source, begin, size, block);
+                    resolveAvx2(size, block);
+                    return;
+                case BatchBackend::SSSE3:
+                    decodeSsse3(source, begin, size, block);
+                    resolveScalar(size, block);
+                    return;
+#endif
+                default:
+                    decodeScalar(source, begin, size, block);
+                    resolveScalar(size, block);
+                    return;
+            }
+        }
+
+        /**
+         * @brief Decodes a batch one block at a time, handing each block to @p store to write the dates.
+         *
+         * The vector code only ever touches the block, so the dates themselves are written by plain scalar code
+         * after it has finished.
+         */
+        template<typename Source, typename Store>
+        std::size_t parseBlocks(const Source& source, std::size_t count, std::uint64_t* validMask,
+                                BatchBackend backend, Store store) {
+            BatchBackend resolved{resolveBackend(backend)};
+            DecodedBlock block{};
+            std::size_t valid{0};
+            for (std::size_t begin{0}; begin < count; begin += BLOCK_SIZE) {
+                std::size_t size{std::min(BLOCK_SIZE, count - begin)};
+                decodeBlock(source, begin, size, resolved, block);
+                validMask[begin / MASK_WORD_BITS] = block.valid;
+                valid += store(block, begin, size);
+            }
+            return valid;
+        }
+    }
+
+    /**
+     * @brief Parses a contiguous buffer of fixed width dates, e.g. a fixed width CSV column.
+     * @param buffer
+     *          The buffer. Date @c i starts at @c buffer + @c i * @c stride and is 10 characters long.
+     * @param count
+     *          The number of dates in the buffer.
+     * @param stride
+     *          The distance in bytes between the start of two consecutive dates, e.g. 11 for newline separated dates.
+     * @param out
+     *          The preallocated array of at least @p count dates to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c validMaskSize(count) words to write to.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return The number of dates successfully parsed.
+     */
+    std::size_t DateBatchParser::parse(const char* buffer, std::size_t count, std::size_t stride, Date* out,
+                                       std::uint64_t* validMask, BatchBackend backend) {
+        if (count == 0) {
+            return 0;
+        }
+        BufferSource source{buffer, stride, (count - 1) * stride + consts::DATE_STRING_LENGTH};
+        return parseBlocks(source, count, validMask, backend,
+                           [out](const DecodedBlock& block, std::size_t begin, std::size_t size) {
+            return storeDates(block.days, block.months, block.years, block.serials, block.valid, size, out + begin);
+        });
+    }
+
+    /**
+     * @brief Parses an array of string representations of dates.
+     * @param dates
+     *          The dates to parse.
+     * @param count
+     *          The number of dates.
+     * @param out
+     *          The preallocated array of at least @p count dates to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c validMaskSize(count) words to write to.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return The number of dates successfully parsed.
+     */
+    std::size_t DateBatchParser::parse(const std::string_view* dates, std::size_t count, Date* out,
+                                       std::uint64_t* validMask, BatchBackend backend) {
+        ViewSource source{dates};
+        return parseBlocks(source, count, validMask, backend,
+                           [out](const DecodedBlock& block, std::size_t begin, std::size_t size) {
+            return storeDates(block.days, block.months, block.years, block.serials, block.valid, size, out + begin);
+        });
+    }
+
+    /**
+     * @brief Gets the fastest backend supported by the CPU.
+     * @return The fastest supported backend.
+     */
+    BatchBackend DateBatchParser::getSupportedBackend() {
+#ifdef DT_BATCH_X86
+        static const BatchBackend backend{detectBackend()};
+        return backend;
+#else
+        return BatchBackend::Scalar;
+#endif
+    }
+
+
+    /**
+     * @brief Checks if a date of a batch was successfully parsed.
+     * @param validMask
+     *          The validity bitmask of the batch.
+     * @param index
+     *          The index of the date.
+     * @return @c true if the date was parsed, @c false otherwise.
+     */
+    bool DateBatchParser::isValid(const std::uint64_t* validMask, std::size_t index) {
+        return (validMask[index / MASK_WORD_BITS] >> (index % MASK_WORD_BITS)) & 1;
+    }
+
+    /**
+     * @brief Writes the resolved components of a block of dates. Invalid entries are set to a default constructed
+     * @c Date.
+     *
+     * The components have already been validated & converted to days since the epoch, so the dates are written
+     * directly instead of going through the @c Date constructor.
+     * @param days
+     *          The days.
+     * @param months
+     *          The months.
+     * @param years
+     *          The years.
+     * @param serials
+     *          The days since @c 1970-01-01 of the valid dates.
+     * @param valid
+     *          The validity bits of the block, bit @c i is set if date @c i is valid.
+     * @param size
+     *          The number of dates in the block.
+     * @param out
+     *          The dates to write to.
+     * @return The number of valid dates.
+     */
+    std::size_t DateBatchParser::storeDates(const std::int32_t* days, const std::int32_t* months,
+                                            const std::int32_t* years, const std::int32_t* serials,
+                                            std::uint64_t valid, std::size_t size, Date* out) {
+        std::size_t count{0};
+        for (std::size_t i{0}; i < size; ++i) {
+            Date& date{out[i]};
+            if ((valid >> i) & 1) {
+                date.serial = serials[i];
+                date.year = static_cast<std::int16_t>(years[i]);
+                date.month = static_cast<std::uint8_t>(months[i]);
+                date.day = static_cast<std::uint8_t>(days[i]);
+                ++count;
+            } else {
+                date = Date{};
+            }
+        }
+        return count;
+    }
+}
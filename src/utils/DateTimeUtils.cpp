@@ -7,7 +7,43 @@
 
 #include "../../include/dt/utils/DateTimeUtils.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "../../include/dt/date/BasicFormattedDate.hpp"
+#include "../../include/dt/time/CurrentTime.hpp"
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/DateBatchParser.hpp"
+
 namespace dt {
+    namespace {
+        /**
+         * @brief Checks if a string representation of a date is valid in exactly the layout of @p F.
+         */
+        template<DateFormat F>
+        bool matchesDateFormat(std::string_view date) {
+            return BasicFormattedDate<F>::tryParse(date).hasValue();
+        }
+
+        /**
+         * @brief Every @c DateFormat, in declaration order, with the check for it.
+         */
+        constexpr std::pair<DateFormat, bool (*)(std::string_view)> DATE_FORMAT_MATCHERS[] {
+            {DateFormat::DD_MM_YYYY,   &matchesDateFormat<DateFormat::DD_MM_YYYY>},
+            {DateFormat::MM_DD_YYYY,   &matchesDateFormat<DateFormat::MM_DD_YYYY>},
+            {DateFormat::YYYY_MM_DD,   &matchesDateFormat<DateFormat::YYYY_MM_DD>},
+            {DateFormat::YYYY_DD_MM,   &matchesDateFormat<DateFormat::YYYY_DD_MM>},
+            {DateFormat::DD__MM__YYYY, &matchesDateFormat<DateFormat::DD__MM__YYYY>},
+            {DateFormat::MM__DD__YYYY, &matchesDateFormat<DateFormat::MM__DD__YYYY>},
+            {DateFormat::YYYY__MM__DD, &matchesDateFormat<DateFormat::YYYY__MM__DD>},
+            {DateFormat::YYYY__DD__MM, &matchesDateFormat<DateFormat::YYYY__DD__MM>},
+        };
+    }
+
     /**
      * @brief Gets the day of the that corresponds with the date passed.
      *
@@ -22,7 +58,7 @@ namespace dt {
      *          The date, as a string.
      * @return The day of the week that corresponds with the date passed.
      */
-    std::string DateTimeUtils::getDayOfWeek(const std::string& date) {
+    std::string DateTimeUtils::getDayOfWeek(std::string_view date) {
         try {
             Date tmp{date};
             return tmp.getDayOfWeek();
@@ -93,9 +129,7 @@ namespace dt {
      * @return @c true if the date is valid, @c false otherwise.
      */
     bool DateTimeUtils::isValidDate(int day, int month, int year) {
-        return isValidDay(day, month, year) &&
-                isValidMonth(month) &&
-                isValidYear(year);
+        return detail::isValidDate(day, month, year);
     }
 
     /**
@@ -105,7 +139,7 @@ namespace dt {
      * @return @c true if the year is a leap year, @c false otherwise.
      */
     bool DateTimeUtils::isLeapYear(int year) {
-        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+        return detail::isLeapYear(year);
     }
 
 
@@ -118,14 +152,7 @@ namespace dt {
      * @return The number of days in the specified month.
      */
     int DateTimeUtils::daysInMonth(int year, int month) {
-        static const std::array<int, 13> days{0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        int daysInMonth{days[month]};
-
-        // Handle leap year (February has 29 days)
-        if (month == 2 && isLeapYear(year)) {
-            daysInMonth = 29;
-        }
-        return daysInMonth;
+        return detail::daysInMonth(year, month);
     }
 
     /**
@@ -172,70 +199,26 @@ namespace dt {
      * @brief Gets the short hand version of a month as a string.
      * @param month
      *          The month.
-     * @return The short hand version of the month as a string.
+     * @return The short hand version of the month as a string, empty if the month is invalid.
      */
     std::string DateTimeUtils::getMonthShortStr(int month) {
-        switch (month) {
-            case 1:
-                return "Jan";
-            case 2:
-                return "Feb";
-            case 3:
-                return "Mar";
-            case 4:
-                return "Apr";
-            case 5:
-                return "May";
-            case 6:
-                return "Jun";
-            case 7:
-                return "Jul";
-            case 8:
-                return "Aug";
-            case 9:
-                return "Sep";
-            case 10:
-                return "Oct";
-            case 11:
-                return "Nov";
-            case 12:
-                return "Dec";
+        if (month < consts::MIN_NUMBER_OF_MONTHS || month > consts::MAX_NUMBER_OF_MONTHS) {
+            return {};
         }
+        return std::string{consts::getShortName(static_cast<consts::Month>(month))};
     }
 
     /**
      * @brief Gets the month as a string.
      * @param month
      *          The month.
-     * @return The month as a string.
+     * @return The month as a string, empty if the month is invalid.
      */
     std::string DateTimeUtils::getMonthLongStr(int month) {
-        switch (month) {
-            case 1:
-                return "January";
-            case 2:
-                return "February";
-            case 3:
-                return "March";
-            case 4:
-                return "April";
-            case 5:
-                return "May";
-            case 6:
-                return "June";
-            case 7:
-                return "July";
-            case 8:
-                return "August";
-            case 9:
-                return "September";
-            case 10:
-                return "October";
-            case 11:
-                return "November";
-            case 12:
-                return "December";
+        if (month < consts::MIN_NUMBER_OF_MONTHS || month > consts::MAX_NUMBER_OF_MONTHS) {
+            return {};
         }
+        return std::string{consts::getName(static_cast<consts::Month>(month))};
     }
 
     /**
@@ -245,15 +228,12 @@ namespace dt {
      * @return The day of the year.
      */
     int DateTimeUtils::dayOfYear(const dt::Date& date) {
-        int dayOfYear{date.getDay()};
-        for (int i{1}; i < date.getMonth(); ++i) {
-            dayOfYear += daysInMonth(date.getYear(), i);
-        }
-        return dayOfYear;
+        return date.serial - detail::daysFromCivil(date.year, 1, 1) + 1;
     }
 
     /**
-     * @brief Parses a vector of string representations of dates to a vector of date objects.
+     * @brief Parses a vector of string representations of dates to a vector of date objects. Dates that can't be
+     * parsed are skipped & logged to @c std::cerr, use @c tryParseDateStrings to get the status of every row instead.
      * @param dates
      *          The vector of strings.
      * @return A vector of dates.
@@ -263,17 +243,219 @@ namespace dt {
         result.reserve(dates.size());
 
         for (const auto& d : dates) {
+            ParseResult<Date> date{Date::tryParse(d)};
+            if (date) {
+                result.push_back(*date);
+            } else {
+                std::cerr << "Error parsing date: '" << d << "'. " << getParseErrorStr(date.getError())
+                          << " at offset " << date.getErrorOffset() << ".\n";
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Parses a vector of string representations of dates across several threads. Unlike
+     * @c parseDateStrings(dates), nothing is skipped or logged: the result lines up with the input & dates that can't
+     * be parsed are left as a default constructed @c Date, with their bit cleared in @p validMask.
+     *
+     * The input is split into contiguous chunks, one per thread, each a multiple of 64 rows so that no two threads
+     * write to the same word of @p validMask. Inputs smaller than @c consts::PARALLEL_PARSE_MIN_CHUNK_SIZE rows per
+     * thread use fewer threads, as starting a thread costs more than parsing a small chunk.
+     * @param dates
+     *          The vector of strings.
+     * @param validMask
+     *          Resized to @c DateBatchParser::validMaskSize(dates.size()) words, bit @c i%64 of word @c i/64 is set
+     *          if date @c i was parsed.
+     * @param threadCount
+     *          The maximum number of threads to use, including the calling thread. 0 uses
+     *          @c std::thread::hardware_concurrency().
+     * @return A vector of dates, one per string in the same order.
+     */
+    std::vector<Date> DateTimeUtils::parseDateStrings(const std::vector<std::string>& dates,
+                                                      std::vector<std::uint64_t>& validMask,
+                                                      unsigned int threadCount) {
+        constexpr std::size_t maskWordBits{64};
+        const std::size_t count{dates.size()};
+        std::vector<Date> result(count);
+        validMask.assign(DateBatchParser::validMaskSize(count), 0);
+        if (count == 0) {
+            return result;
+        }
+
+        if (threadCount == 0) {
+            threadCount = std::max(1U, std::thread::hardware_concurrency());
+        }
+        std::size_t maxThreads{(count + consts::PARALLEL_PARSE_MIN_CHUNK_SIZE - 1) /
+                               consts::PARALLEL_PARSE_MIN_CHUNK_SIZE};
+        std::size_t threads{std::min<std::size_t>(threadCount, maxThreads)};
+        std::size_t chunkSize{(count + threads - 1) / threads};
+        chunkSize = (chunkSize + maskWordBits - 1) / maskWordBits * maskWordBits;
+
+        // The calling thread parses the first chunk, every other chunk gets its own thread.
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t begin{chunkSize}; begin < count; begin += chunkSize) {
+            std::size_t end{std::min(begin + chunkSize, count)};
             try {
-                result.emplace_back(d);
-            } catch (const DateParseException& ex) {
-                std::cerr << ex.what() << "\n";
-            } catch (...) {
-                std::cerr << "Error parsing date: Unknown exception\n";
+                workers.emplace_back(parseDateStringsChunk, std::cref(dates), begin, end, result.data(),
+                                     validMask.data());
+            } catch (const std::system_error&) {
+                parseDateStringsChunk(dates, begin, end, result.data(), validMask.data());
             }
         }
+        parseDateStringsChunk(dates, 0, std::min(chunkSize, count), result.data(), validMask.data());
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Parses a vector of string representations of dates that all share one layout, e.g. a column whose layout
+     * was found with @c inferDateFormat. Every row is parsed in exactly that layout, so unlike @c Date there is no
+     * day/month swap & a row can't be read differently from its neighbours.
+     * @param dates
+     *          The vector of strings.
+     * @param format
+     *          The layout of every string.
+     * @param contradictingRows
+     *          Cleared, then filled with the index of every row that isn't a valid date in @p format, in ascending
+     *          order. Those rows are left as a default constructed @c Date.
+     * @return A vector of dates, one per string in the same order.
+     */
+    std::vector<Date> DateTimeUtils::parseDateStrings(const std::vector<std::string>& dates, DateFormat format,
+                                                      std::vector<std::size_t>& contradictingRows) {
+        std::vector<Date> result(dates.size());
+        contradictingRows.clear();
+
+        switch (format) {
+            case DateFormat::DD_MM_YYYY:
+                parseDateStringsColumn<DateFormat::DD_MM_YYYY>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::MM_DD_YYYY:
+                parseDateStringsColumn<DateFormat::MM_DD_YYYY>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::YYYY_MM_DD:
+                parseDateStringsColumn<DateFormat::YYYY_MM_DD>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::YYYY_DD_MM:
+                parseDateStringsColumn<DateFormat::YYYY_DD_MM>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::DD__MM__YYYY:
+                parseDateStringsColumn<DateFormat::DD__MM__YYYY>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::MM__DD__YYYY:
+                parseDateStringsColumn<DateFormat::MM__DD__YYYY>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::YYYY__MM__DD:
+                parseDateStringsColumn<DateFormat::YYYY__MM__DD>(dates, result.data(), contradictingRows);
+                break;
+            case DateFormat::YYYY__DD__MM:
+                parseDateStringsColumn<DateFormat::YYYY__DD__MM>(dates, result.data(), contradictingRows);
+                break;
+        }
         return result;
     }
 
+    /**
+     * @brief Parses a vector of string representations of dates without throwing or logging.
+     * @param dates
+     *          The vector of strings.
+     * @return One result per string, in the same order, holding either the date or why it could not be parsed.
+     */
+    std::vector<ParseResult<Date>> DateTimeUtils::tryParseDateStrings(const std::vector<std::string>& dates) {
+        std::vector<ParseResult<Date>> result;
+        result.reserve(dates.size());
+
+        for (const auto& d : dates) {
+            result.push_back(Date::tryParse(d));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Infers the layout of a column of string representations of dates from its first rows.
+     *
+     * Every sampled row is checked against every @c DateFormat & the format that the most rows are valid in wins.
+     * Rows that fit no format, e.g. blanks, are ignored. A tie, e.g. when every sampled day is 12 or less, goes to the
+     * format declared first, so day first beats month first like it does in @c Date.
+     *
+     * <b>Example:</b> @c {"12/01/2023", "25/01/2023"} is @c DateFormat::DD__MM__YYYY because 25 can't be a month.
+     * @param dates
+     *          The vector of strings.
+     * @param sampleSize
+     *          The number of rows to check, from the start of the column.
+     * @return The inferred format, or nothing if no sampled row is a valid date in any format.
+     */
+    std::optional<DateFormat> DateTimeUtils::inferDateFormat(const std::vector<std::string>& dates,
+                                                             std::size_t sampleSize) {
+        constexpr std::size_t formatCount{std::size(DATE_FORMAT_MATCHERS)};
+        std::size_t matches[formatCount]{};
+        sampleSize = std::min(sampleSize, dates.size());
+        for (std::size_t i{0}; i < sampleSize; ++i) {
+            for (std::size_t f{0}; f < formatCount; ++f) {
+                matches[f] += DATE_FORMAT_MATCHERS[f].second(dates[i]);
+            }
+        }
+
+        std::size_t best{static_cast<std::size_t>(std::max_element(matches, matches + formatCount) - matches)};
+        if (matches[best] == 0) {
+            return std::nullopt;
+        }
+        return DATE_FORMAT_MATCHERS[best].first;
+    }
+
+    /**
+     * @brief Parses every row in exactly the layout of @p F, the loop is instantiated once per format so the offsets
+     * of the components are constants.
+     * @param dates
+     *          The vector of strings.
+     * @param out
+     *          The date of every row.
+     * @param contradictingRows
+     *          The index of every row that isn't a valid date in @p F is appended.
+     */
+    template<DateFormat F>
+    void DateTimeUtils::parseDateStringsColumn(const std::vector<std::string>& dates, Date* out,
+                                               std::vector<std::size_t>& contradictingRows) {
+        for (std::size_t i{0}; i < dates.size(); ++i) {
+            ParseResult<BasicFormattedDate<F>> date{BasicFormattedDate<F>::tryParse(dates[i])};
+            if (date) {
+                out[i].assignDate(date->getDay(), date->getMonth(), date->getYear());
+            } else {
+                contradictingRows.push_back(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Parses rows @c [begin, end) of @p dates with the @c DateBatchParser, 64 rows at a time.
+     * @param dates
+     *          The vector of strings.
+     * @param begin
+     *          The first row, a multiple of 64.
+     * @param end
+     *          One past the last row.
+     * @param out
+     *          The dates of every row, written from @p begin.
+     * @param validMask
+     *          The validity bitmask of every row, written from word @c begin/64.
+     */
+    void DateTimeUtils::parseDateStringsChunk(const std::vector<std::string>& dates, std::size_t begin,
+                                              std::size_t end, Date* out, std::uint64_t* validMask) {
+        constexpr std::size_t maskWordBits{64};
+        std::string_view views[maskWordBits];
+        for (std::size_t i{begin}; i < end; i += maskWordBits) {
+            std::size_t size{std::min(maskWordBits, end - i)};
+            for (std::size_t j{0}; j < size; ++j) {
+                views[j] = dates[i + j];
+            }
+            DateBatchParser::parse(views, size, out + i, validMask + i / maskWordBits);
+        }
+    }
+
     /**
      * @brief Converts a time stamp to milliseconds.
      * @param timeStamp
@@ -289,39 +471,28 @@ namespace dt {
     }
 
     /**
-     * @brief Gets the current time as a string.
+     * @brief Gets the current local time as a string, @c HH:MM:SS:mmm.
      * @return The current time as a string.
+     * @see @c CurrentTime for formatting it without allocating.
      */
     std::string DateTimeUtils::getCurrentTimeStr() {
-        static const std::string pattern{"%H:%M:%S:"};
-
-        std::stringstream ss;
-        std::chrono::system_clock::time_point now{std::chrono::system_clock::now()};
-        std::time_t now_c{std::chrono::system_clock::to_time_t(now)};
-        const std::tm* timePtr{std::localtime(&now_c)};
-        ss << std::put_time(timePtr, pattern.c_str());
-
-        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
-        ss << std::setfill('0') << std::setw(3) << milliseconds;
-
-        return ss.str();
+        char buffer[consts::TIME_STAMP_STRING_LENGTH];
+        return {buffer, CurrentTime::formatNow(buffer)};
     }
 
     /**
      * @brief Calculates the number of days between a given date and a reference date: @c 01-01-1583.
      * @param date
      *          The date to calculate from.
-     * @return The number of days between the given date and the reference date.
+     * @return The number of days between the given date and the reference date, -1 for a default constructed date.
      */
     int DateTimeUtils::daysSinceReferenceDate(const dt::Date& date) {
-        static const Date referenceDate{1, 1, 1583};
-        int days{0};
-
-        for (int i{referenceDate.getYear()}; i < date.getYear(); ++i) {
-            days += daysInYear(i);
+        constexpr int referenceDays{detail::daysFromCivil(consts::MIN_YEAR, 1, 1)};
+        if (date.serial == Date::NO_DATE) {
+            // Day 0 of the reference year, as the year by year sum counted a date with no day & month.
+            return -1;
         }
-        days += dayOfYear(date) - dayOfYear(referenceDate);
-        return days;
+        return date.serial - referenceDays;
     }
 
     /**
@@ -331,59 +502,7 @@ namespace dt {
      * @return The number of months between the given date and the reference date.
      */
     int DateTimeUtils::monthsSinceReferenceDate(const dt::Date& date) {
-        static const Date referenceDate{1, 1, 1583};
-        int months{0};
-
-        for (int i{referenceDate.getYear()}; i < date.getYear(); ++i) {
-            months += 12;
-        }
-        months += date.getMonth() - referenceDate.getMonth();
-        return months;
-    }
-
-    /**
-     * @brief Checks if a day is valid based on the month and year.
-     * @param day
-     *          The day to check.
-     * @param month
-     *          The month.
-     * @param year
-     *          The year.
-     * @return @c true if the day is valid, @c false otherwise.
-     */
-    bool DateTimeUtils::isValidDay(int day, int month, int year) {
-        // TODO Add Unit Test
-        int daysInMonth{consts::MAX_NUMBER_DAYS_IN_A_MONTH};
-        if (month == (int)consts::Month::April || month == (int)consts::Month::June ||
-            month == (int)consts::Month::September || month == (int)consts::Month::November) {
-            daysInMonth = 30;
-        } else if (month == (int)consts::Month::February) {
-            daysInMonth = isLeapYear(year) ? consts::FEBRUARY_LEAP_YEAR_DAYS : consts::FEBRUARY_LEAP_YEAR_DAYS - 1;
-        }
-
-        if (day < 1 || day > daysInMonth) {
-            return false;
-        }
-        return true;
-    }
-
-    /**
-     * @brief Checks if a month is valid.
-     * @param month
-     *          The month to check.
-     * @return @c true if the month is valid, @c false otherwise.
-     */
-    bool DateTimeUtils::isValidMonth(int month) {
-        return month >= (int)consts::Month::January && month <= (int)consts::Month::December;
-    }
-
-    /**
-     * @brief Checks if a year is valid.
-     * @param year
-     *          The year to check.
-     * @return @c true if the year is valid, @c false otherwise.
-     */
-    bool DateTimeUtils::isValidYear(int year) {
-        return year >= consts::MIN_YEAR && year <= consts::MAX_YEAR;
+        return (date.getYear() - consts::MIN_YEAR) * consts::MAX_NUMBER_OF_MONTHS + date.getMonth() -
+               consts::MIN_NUMBER_OF_MONTHS;
     }
 }
\ No newline at end of file
@@ -0,0 +1,250 @@
+/**
+ * @file EpochParser.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/EpochParser.hpp"
+
+#include <algorithm>
+
+#include "../../include/dt/utils/CivilUtils.hpp"
+#include "../../include/dt/utils/ParseUtils.hpp"
+
+namespace dt {
+    namespace {
+        constexpr std::size_t MASK_WORD_BITS{64};
+        constexpr std::size_t MAX_EPOCH_DIGITS{19};
+
+        // Values below these magnitudes are detected as seconds, milliseconds & microseconds.
+        constexpr std::uint64_t SECONDS_LIMIT{100'000'000'000};
+        constexpr std::uint64_t MILLISECONDS_LIMIT{SECONDS_LIMIT * 1'000};
+        constexpr std::uint64_t MICROSECONDS_LIMIT{MILLISECONDS_LIMIT * 1'000};
+
+        constexpr int MIN_DAYS{detail::daysFromCivil(consts::MIN_YEAR, 1, 1)};
+        constexpr int MAX_DAYS{detail::daysFromCivil(consts::MAX_YEAR, 12, 31)};
+
+        std::uint64_t getMagnitude(std::int64_t value) {
+            return value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        }
+
+        /**
+         * @brief Splits an epoch value into whole seconds & the nanoseconds within the second. The unit is a template
+         * argument so that the divisions compile to multiplications.
+         */
+        template<std::int64_t UnitsPerSecond>
+        std::int64_t splitSeconds(std::int64_t value, int& nano) {
+            const std::int64_t seconds{detail::floorDivide(value, UnitsPerSecond)};
+            nano = static_cast<int>((value - seconds * UnitsPerSecond) * (1'000'000'000 / UnitsPerSecond));
+            return seconds;
+        }
+
+        /**
+         * @brief Decodes an optionally signed run of at most 19 digits that fits in 64 bits.
+         */
+        ParseResult<std::int64_t> parseEpochValue(std::string_view epoch) {
+            const char* str{epoch.data()};
+            const std::size_t size{epoch.size()};
+            const bool negative{size > 0 && str[0] == '-'};
+            std::size_t i{negative ? std::size_t{1} : std::size_t{0}};
+            if (i == size) {
+                return {ParseError::TooShort, i};
+            }
+
+            const std::size_t end{std::min(size, i + MAX_EPOCH_DIGITS)};
+            std::uint64_t magnitude{0};
+            for (; i < end; ++i) {
+                if (!detail::isDigit(str[i])) {
+                    return {ParseError::ExpectedDigit, i};
+                }
+                magnitude = magnitude * 10 + static_cast<std::uint64_t>(str[i] - '0');
+            }
+            if (i < size) {
+                return {detail::isDigit(str[i]) ? ParseError::TooLong : ParseError::ExpectedDigit, i};
+            }
+            // 19 digits always fit in 64 unsigned bits, but not always in 63.
+            if (magnitude > static_cast<std::uint64_t>(INT64_MAX) + negative) {
+                return {ParseError::TooLong, end - 1};
+            }
+            return negative ? static_cast<std::int64_t>(0 - magnitude) : static_cast<std::int64_t>(magnitude);
+        }
+    }
+
+    /**
+     * @brief Detects the unit of an epoch value from its magnitude, see the class description.
+     * @param value
+     *          The epoch value.
+     * @return The detected unit, never @c EpochUnit::Auto.
+     */
+    EpochUnit EpochParser::detectUnit(std::int64_t value) {
+        const std::uint64_t magnitude{getMagnitude(value)};
+        if (magnitude < SECONDS_LIMIT) {
+            return EpochUnit::Seconds;
+        }
+        if (magnitude < MILLISECONDS_LIMIT) {
+            return EpochUnit::Milliseconds;
+        }
+        return magnitude < MICROSECONDS_LIMIT ? EpochUnit::Microseconds : EpochUnit::Nanoseconds;
+    }
+
+    /**
+     * @brief Detects one unit for a whole column of epoch values, from the value with the largest magnitude.
+     * @param values
+     *          The epoch values.
+     * @param count
+     *          The number of values.
+     * @return The detected unit, @c EpochUnit::Seconds for an empty column.
+     */
+    EpochUnit EpochParser::detectUnit(const std::int64_t* values, std::size_t count) {
+        std::uint64_t largest{0};
+        for (std::size_t i{0}; i < count; ++i) {
+            largest = std::max(largest, getMagnitude(values[i]));
+        }
+        return detectUnit(static_cast<std::int64_t>(std::min(largest, static_cast<std::uint64_t>(INT64_MAX))));
+    }
+
+    /**
+     * @brief Converts an epoch value to a date time in UTC.
+     * @param value
+     *          The time since @c 1970-01-01T00:00:00Z, negative before it.
+     * @param unit
+     *          The unit of the value, detected from its magnitude by default.
+     * @return The date time, or @c ParseError::InvalidDate if it is outside the years @c consts::MIN_YEAR to
+     * @c consts::MAX_YEAR.
+     */
+    ParseResult<DateTime> EpochParser::fromValue(std::int64_t value, EpochUnit unit) noexcept {
+        DateTime dateTime;
+        if (!toDateTime(value, unit, dateTime)) {
+            return {ParseError::InvalidDate, 0};
+        }
+        return dateTime;
+    }
+
+    /**
+     * @brief Parses a string of digits holding an epoch value, optionally preceded by a '-', without throwing.
+     * @param epoch
+     *          The epoch value, e.g. @c 1697545200123.
+     * @param unit
+     *          The unit of the value, detected from its magnitude by default.
+     * @return The date time in UTC, or why it could not be parsed.
+     */
+    ParseResult<DateTime> EpochParser::tryParse(std::string_view epoch, EpochUnit unit) noexcept {
+        ParseResult<std::int64_t> value{parseEpochValue(epoch)};
+        if (!value) {
+            return {value.getError(), value.getErrorOffset()};
+        }
+        return fromValue(*value, unit);
+    }
+
+    /**
+     * @brief Converts a column of epoch values to date times in UTC.
+     *
+     * The validity bitmask has the layout of the @c DateBatchParser one: bit @c i%64 of word @c i/64 is set if value
+     * @c i was converted. Invalid entries are set to a default constructed @c DateTime.
+     * @param values
+     *          The epoch values.
+     * @param count
+     *          The number of values.
+     * @param unit
+     *          The unit of the values, @c EpochUnit::Auto to detect it value by value.
+     * @param out
+     *          The preallocated array of at least @p count date times to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c DateBatchParser::validMaskSize(count) words to write to.
+     * @return The number of values converted.
+     */
+    std::size_t EpochParser::parse(const std::int64_t* values, std::size_t count, EpochUnit unit, DateTime* out,
+                                   std::uint64_t* validMask) {
+        std::size_t valid{0};
+        for (std::size_t begin{0}; begin < count; begin += MASK_WORD_BITS) {
+            const std::size_t size{std::min(MASK_WORD_BITS, count - begin)};
+            std::uint64_t word{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                const bool ok{toDateTime(values[begin + i], unit, out[begin + i])};
+                word |= std::uint64_t{ok} << i;
+                valid += ok;
+            }
+            validMask[begin / MASK_WORD_BITS] = word;
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Parses a column of epoch strings to date times in UTC, see @c tryParse.
+     * @param epochs
+     *          The epoch values as strings.
+     * @param count
+     *          The number of strings.
+     * @param unit
+     *          The unit of the values, @c EpochUnit::Auto to detect it value by value.
+     * @param out
+     *          The preallocated array of at least @p count date times to write to.
+     * @param validMask
+     *          The preallocated bitmask of at least @c DateBatchParser::validMaskSize(count) words to write to.
+     * @return The number of strings parsed.
+     */
+    std::size_t EpochParser::parse(const std::string_view* epochs, std::size_t count, EpochUnit unit, DateTime* out,
+                                   std::uint64_t* validMask) {
+        std::size_t valid{0};
+        for (std::size_t begin{0}; begin < count; begin += MASK_WORD_BITS) {
+            const std::size_t size{std::min(MASK_WORD_BITS, count - begin)};
+            std::uint64_t word{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                ParseResult<std::int64_t> value{parseEpochValue(epochs[begin + i])};
+                bool ok{static_cast<bool>(value) && toDateTime(*value, unit, out[begin + i])};
+                if (!value) {
+                    out[begin + i] = DateTime{};
+                }
+                word |= std::uint64_t{ok} << i;
+                valid += ok;
+            }
+            validMask[begin / MASK_WORD_BITS] = word;
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Converts an epoch value to a date time in UTC, splitting it into days & the time within the day with
+     * floor divisions so that values before 1970 work too.
+     * @param value
+     *          The epoch value.
+     * @param unit
+     *          The unit of the value.
+     * @param out
+     *          Set to the date time, or a default constructed @c DateTime if the value is out of range.
+     * @return @c true if the value is in range, @c false otherwise.
+     */
+    bool EpochParser::toDateTime(std::int64_t value, EpochUnit unit, DateTime& out) {
+        if (unit == EpochUnit::Auto) {
+            unit = detectUnit(value);
+        }
+        int nano{0};
+        std::int64_t seconds;
+        switch (unit) {
+            case EpochUnit::Milliseconds:
+                seconds = splitSeconds<1'000>(value, nano);
+                break;
+            case EpochUnit::Microseconds:
+                seconds = splitSeconds<1'000'000>(value, nano);
+                break;
+            case EpochUnit::Nanoseconds:
+                seconds = splitSeconds<1'000'000'000>(value, nano);
+                break;
+            default:
+                seconds = value;
+                break;
+        }
+        const std::int64_t days{detail::floorDivide(seconds, detail::SECONDS_PER_DAY)};
+        if (days < MIN_DAYS || days > MAX_DAYS) {
+            out = DateTime{};
+            return false;
+        }
+
+        const auto secondOfDay{static_cast<int>(seconds - days * detail::SECONDS_PER_DAY)};
+        Date date;
+        date.assignDays(static_cast<std::int32_t>(days));
+        out = DateTime{date, secondOfDay / 3'600, secondOfDay / 60 % 60, secondOfDay % 60, nano, 0, true};
+        return true;
+    }
+}
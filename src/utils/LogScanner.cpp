@@ -0,0 +1,209 @@
+/**
+ * @file LogScanner.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/LogScanner.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DT_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace dt {
+    namespace {
+        constexpr std::size_t BLOCK_SIZE{64};
+
+        // The token characters are the bytes from '-' to ':' except '.': - . / 0 1 2 3 4 5 6 7 8 9 :
+        constexpr char TOKEN_CHAR_FIRST{consts::DATE_SEPARATOR_DASH};
+        constexpr char TOKEN_CHAR_RANGE{consts::TIME_SEPARATOR - consts::DATE_SEPARATOR_DASH};
+        constexpr char NOT_A_TOKEN_CHAR{'.'};
+
+        /**
+         * @brief Where the current run of token characters started & whether it is still running at the end of the
+         * previous block.
+         */
+        struct RunState {
+            std::size_t start{0};
+            bool open{false};
+        };
+
+        inline unsigned countTrailingZeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+            unsigned count{0};
+            while ((value & 1) == 0) {
+                value >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        /**
+         * @brief Finds the runs that start or end in a block from its token character bitmask, calling @p emit with
+         * the start & end offsets of every run that ends in it. A run ends where a bit differs from the one before
+         * it & the bit is clear, so only the bits that toggle are visited.
+         */
+        template<typename Emit>
+        inline void processBlock(std::uint64_t mask, std::size_t base, RunState& state, Emit& emit) {
+            std::uint64_t toggles{mask ^ ((mask << 1) | std::uint64_t{state.open})};
+            while (toggles != 0) {
+                unsigned bit{countTrailingZeros(toggles)};
+                toggles &= toggles - 1;
+                if ((mask >> bit) & 1) {
+                    state.start = base + bit;
+                } else {
+                    emit(state.start, base + bit);
+                }
+            }
+            state.open = (mask >> (BLOCK_SIZE - 1)) & 1;
+        }
+
+        /**
+         * @brief Classifies up to 64 bytes one at a time, bit @c i is set if byte @c i is a token character. Also
+         * used for the last, partial block of the SIMD backends.
+         */
+        inline std::uint64_t tokenMaskScalar(const char* data, std::size_t size) {
+            std::uint64_t mask{0};
+            for (std::size_t i{0}; i < size; ++i) {
+                bool isTokenChar{static_cast<unsigned char>(data[i] - TOKEN_CHAR_FIRST) <=
+                                 static_cast<unsigned char>(TOKEN_CHAR_RANGE) && data[i] != NOT_A_TOKEN_CHAR};
+                mask |= std::uint64_t{isTokenChar} << i;
+            }
+            return mask;
+        }
+
+        /**
+         * @brief Scans the last, partial block & closes a run still open at the end of the buffer.
+         */
+        template<typename Emit>
+        inline void finishScan(const char* data, std::size_t size, std::size_t base, RunState& state, Emit& emit) {
+            if (base < size) {
+                processBlock(tokenMaskScalar(data + base, size - base), base, state, emit);
+            }
+            if (state.open) {
+                emit(state.start, size);
+            }
+        }
+
+        template<typename Emit>
+        void scanScalar(const char* data, std::size_t size, Emit& emit) {
+            RunState state;
+            std::size_t base{0};
+            for (; base + BLOCK_SIZE <= size; base += BLOCK_SIZE) {
+                processBlock(tokenMaskScalar(data + base, BLOCK_SIZE), base, state, emit);
+            }
+            finishScan(data, size, base, state, emit);
+        }
+
+#ifdef DT_SCAN_X86
+        /**
+         * @brief Classifies 16 bytes with one range check & one compare, see @c TOKEN_CHAR_FIRST.
+         */
+        __attribute__((target("ssse3")))
+        inline std::uint64_t tokenMask16(const char* data) {
+            __m128i bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))};
+            __m128i offset{_mm_sub_epi8(bytes, _mm_set1_epi8(TOKEN_CHAR_FIRST))};
+            __m128i inRange{_mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(TOKEN_CHAR_RANGE)), offset)};
+            __m128i dot{_mm_cmpeq_epi8(bytes, _mm_set1_epi8(NOT_A_TOKEN_CHAR))};
+            return static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_andnot_si128(dot, inRange)));
+        }
+
+        template<typename Emit>
+        __attribute__((target("ssse3")))
+        void scanSsse3(const char* data, std::size_t size, Emit& emit) {
+            RunState state;
+            std::size_t base{0};
+            for (; base + BLOCK_SIZE <= size; base += BLOCK_SIZE) {
+                std::uint64_t mask{tokenMask16(data + base) | tokenMask16(data + base + 16) << 16 |
+                                   tokenMask16(data + base + 32) << 32 | tokenMask16(data + base + 48) << 48};
+                processBlock(mask, base, state, emit);
+            }
+            finishScan(data, size, base, state, emit);
+        }
+
+        /**
+         * @brief Same as @c tokenMask16 for 32 bytes.
+         */
+        __attribute__((target("avx2")))
+        inline std::uint64_t tokenMask32(const char* data) {
+            __m256i bytes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data))};
+            __m256i offset{_mm256_sub_epi8(bytes, _mm256_set1_epi8(TOKEN_CHAR_FIRST))};
+            __m256i inRange{_mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(TOKEN_CHAR_RANGE)), offset)};
+            __m256i dot{_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(NOT_A_TOKEN_CHAR))};
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_andnot_si256(dot, inRange)));
+        }
+
+        template<typename Emit>
+        __attribute__((target("avx2")))
+        void scanAvx2(const char* data, std::size_t size, Emit& emit) {
+            RunState state;
+            std::size_t base{0};
+            for (; base + BLOCK_SIZE <= size; base += BLOCK_SIZE) {
+                processBlock(tokenMask32(data + base) | tokenMask32(data + base + 32) << 32, base, state, emit);
+            }
+            finishScan(data, size, base, state, emit);
+        }
+#endif
+    }
+
+    /**
+     * @brief Finds & decodes every date & time stamp in a buffer.
+     * @param buffer
+     *          The text to scan.
+     * @param tokens
+     *          The tokens found are appended to it in buffer order, with offsets from the start of the buffer.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return The number of tokens appended.
+     */
+    std::size_t LogScanner::scan(std::string_view buffer, std::vector<StreamToken>& tokens, BatchBackend backend) {
+        const std::size_t before{tokens.size()};
+        StreamToken token;
+        auto emit = [&buffer, &tokens, &token](std::size_t start, std::size_t end) {
+            std::size_t length{end - start};
+            if ((length == consts::DATE_STRING_LENGTH || length == consts::TIME_STAMP_STRING_LENGTH) &&
+                StreamTokenizer::makeToken(buffer.substr(start, length), start, token)) {
+                tokens.push_back(token);
+            }
+        };
+
+        BatchBackend supported{DateBatchParser::getSupportedBackend()};
+        BatchBackend resolved{backend == BatchBackend::Auto ? supported : std::min(backend, supported)};
+        switch (resolved) {
+#ifdef DT_SCAN_X86
+            case BatchBackend::AVX2:
+                scanAvx2(buffer.data(), buffer.size(), emit);
+                break;
+            case BatchBackend::SSSE3:
+                scanSsse3(buffer.data(), buffer.size(), emit);
+                break;
+#endif
+            default:
+                scanScalar(buffer.data(), buffer.size(), emit);
+                break;
+        }
+        return tokens.size() - before;
+    }
+
+    /**
+     * @brief Finds & decodes every date & time stamp in a buffer.
+     * @param buffer
+     *          The text to scan.
+     * @param backend
+     *          The instruction set to use. Falls back to the best supported one if the CPU does not support it.
+     * @return The tokens found, in buffer order, with offsets from the start of the buffer.
+     */
+    std::vector<StreamToken> LogScanner::scan(std::string_view buffer, BatchBackend backend) {
+        std::vector<StreamToken> tokens;
+        scan(buffer, tokens, backend);
+        return tokens;
+    }
+}
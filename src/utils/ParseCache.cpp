@@ -0,0 +1,218 @@
+/**
+ * @file ParseCache.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/ParseCache.hpp"
+
+#include <cstring>
+
+namespace dt {
+    namespace {
+        /**
+         * @brief Rounds a capacity up to a power of two, so a slot can be picked with a mask.
+         */
+        std::size_t roundUpCapacity(std::size_t capacity) {
+            std::size_t rounded{1};
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+            return rounded;
+        }
+
+        /**
+         * @brief Loads 8 bytes of a string as an integer, the string must be at least 8 bytes long.
+         */
+        std::uint64_t loadEightBytes(const char* str) {
+            std::uint64_t value;
+            std::memcpy(&value, str, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Picks the slot of a key, a multiplicative hash so that keys differing only in the last digits,
+         * e.g. consecutive days or seconds, land far apart.
+         */
+        std::size_t getSlot(std::uint64_t low, std::uint64_t high, std::size_t mask) {
+            std::uint64_t hash{(low ^ (high * 0xC2B2AE3D27D4EB4FULL)) * 0x9E3779B97F4A7C15ULL};
+            return static_cast<std::size_t>(hash >> 32) & mask;
+        }
+    }
+
+    /**
+     * @brief @c DateParseCache constructor.
+     * @param capacity
+     *          The number of strings to keep, rounded up to a power of two.
+     */
+    DateParseCache::DateParseCache(std::size_t capacity)
+        : entries(roundUpCapacity(capacity)),
+          mask{entries.size() - 1} {
+    }
+
+    /**
+     * @brief Gets the cache of the calling thread, created with the default capacity on first use.
+     * @return The cache of the calling thread.
+     */
+    DateParseCache& DateParseCache::threadLocal() {
+        thread_local DateParseCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Parses a string representation of a date without throwing, see @c Date::tryParse. Strings that are not
+     * 10 characters long can't be valid dates & bypass the cache, they are counted as misses.
+     * @param date
+     *          The string representation of a date to parse.
+     * @return The parsed date, or why it could not be parsed.
+     */
+    ParseResult<Date> DateParseCache::tryParse(std::string_view date) {
+        if (date.size() != consts::DATE_STRING_LENGTH) {
+            ++misses;
+            return Date::tryParse(date);
+        }
+
+        std::uint64_t low{loadEightBytes(date.data())};
+        std::uint16_t tail;
+        std::memcpy(&tail, date.data() + 8, sizeof(tail));
+        std::uint64_t high{tail | (std::uint64_t{1} << 63)};
+
+        Entry& entry{entries[getSlot(low, high, mask)]};
+        if (entry.low == low && entry.high == high) {
+            ++hits;
+            return entry.date;
+        }
+        ++misses;
+        entry.low = low;
+        entry.high = high;
+        entry.date = Date::tryParse(date);
+        return entry.date;
+    }
+
+    /**
+     * @brief Gets the number of strings the cache can hold.
+     * @return The capacity.
+     */
+    std::size_t DateParseCache::getCapacity() const {
+        return entries.size();
+    }
+
+    /**
+     * @brief Gets the number of parses answered from the cache.
+     * @return The number of hits.
+     */
+    std::size_t DateParseCache::getHits() const {
+        return hits;
+    }
+
+    /**
+     * @brief Gets the number of parses that had to run the parser.
+     * @return The number of misses.
+     */
+    std::size_t DateParseCache::getMisses() const {
+        return misses;
+    }
+
+    /**
+     * @brief Empties the cache & resets the counters.
+     */
+    void DateParseCache::clear() {
+        entries.assign(entries.size(), Entry{});
+        hits = 0;
+        misses = 0;
+    }
+
+    /**
+     * @brief @c TimeStampParseCache constructor.
+     * @param capacity
+     *          The number of @c HH:MM:SS prefixes to keep, rounded up to a power of two.
+     */
+    TimeStampParseCache::TimeStampParseCache(std::size_t capacity)
+        : entries(roundUpCapacity(capacity)),
+          mask{entries.size() - 1} {
+    }
+
+    /**
+     * @brief Gets the cache of the calling thread, created with the default capacity on first use.
+     * @return The cache of the calling thread.
+     */
+    TimeStampParseCache& TimeStampParseCache::threadLocal() {
+        thread_local TimeStampParseCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Parses a string representation of a time stamp without throwing, see @c TimeStamp::tryParse.
+     *
+     * Once the @c :mmm suffix has been checked, the result only depends on the @c HH:MM:SS prefix, so that is all
+     * that is cached. Strings with a malformed suffix bypass the cache & are counted as misses.
+     * @param timeStamp
+     *          The string representation of a time stamp to parse.
+     * @return The parsed time stamp, or why it could not be parsed.
+     */
+    ParseResult<TimeStamp> TimeStampParseCache::tryParse(std::string_view timeStamp) {
+        // XX:XX:XX:XXX
+        // 012345678901
+        const char* str{timeStamp.data()};
+        if (timeStamp.size() != consts::TIME_STAMP_STRING_LENGTH || str[8] != consts::TIME_SEPARATOR ||
+            !detail::isDigits(str + 9, 3)) {
+            ++misses;
+            return TimeStamp::tryParse(timeStamp);
+        }
+
+        std::uint64_t prefix{loadEightBytes(str)};
+        Entry& entry{entries[getSlot(prefix, 0, mask)]};
+        if (entry.used && entry.prefix == prefix) {
+            ++hits;
+        } else {
+            ++misses;
+            ParseResult<TimeStamp> result{TimeStamp::tryParse(timeStamp)};
+            TimeStamp time{*result};
+            time.millisecond = 0;
+            entry.prefix = prefix;
+            entry.used = true;
+            entry.timeStamp = result ? ParseResult<TimeStamp>{time} : result;
+        }
+
+        if (!entry.timeStamp) {
+            return entry.timeStamp;
+        }
+        TimeStamp result{*entry.timeStamp};
+        result.millisecond = detail::parseThreeDigits(str + 9);
+        return result;
+    }
+
+    /**
+     * @brief Gets the number of prefixes the cache can hold.
+     * @return The capacity.
+     */
+    std::size_t TimeStampParseCache::getCapacity() const {
+        return entries.size();
+    }
+
+    /**
+     * @brief Gets the number of parses answered from the cache.
+     * @return The number of hits.
+     */
+    std::size_t TimeStampParseCache::getHits() const {
+        return hits;
+    }
+
+    /**
+     * @brief Gets the number of parses that had to run the parser.
+     * @return The number of misses.
+     */
+    std::size_t TimeStampParseCache::getMisses() const {
+        return misses;
+    }
+
+    /**
+     * @brief Empties the cache & resets the counters.
+     */
+    void TimeStampParseCache::clear() {
+        entries.assign(entries.size(), Entry{});
+        hits = 0;
+        misses = 0;
+    }
+}
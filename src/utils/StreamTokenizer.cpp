@@ -0,0 +1,82 @@
+/**
+ * @file StreamTokenizer.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/StreamTokenizer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace dt {
+    /**
+     * @brief Gets the number of bytes fed so far.
+     * @return The offset of the next byte of the stream.
+     */
+    std::uint64_t StreamTokenizer::getOffset() const {
+        return offset;
+    }
+
+    /**
+     * @brief Drops any carried over token & starts a new stream at offset 0.
+     */
+    void StreamTokenizer::reset() {
+        pendingLength = 0;
+        pendingOffset = 0;
+        offset = 0;
+    }
+
+    /**
+     * @brief Checks if a character can be part of a date or time stamp.
+     * @param c
+     *          The character to check.
+     * @return @c true if the character is a digit or a date or time separator, @c false otherwise.
+     */
+    bool StreamTokenizer::isTokenChar(char c) {
+        return detail::isDigit(c) || detail::isDateSeparator(c) || c == consts::TIME_SEPARATOR;
+    }
+
+    /**
+     * @brief Parses a token if it has the length of a date or time stamp.
+     * @param text
+     *          The characters of the token.
+     * @param offset
+     *          The offset of the token from the start of the stream.
+     * @param token
+     *          Set to the parsed token.
+     * @return @c true if the token should be reported, @c false if it is skipped.
+     */
+    bool StreamTokenizer::makeToken(std::string_view text, std::uint64_t offset, StreamToken& token) {
+        token = StreamToken{};
+        token.offset = offset;
+        token.length = text.size();
+        if (text.size() == consts::DATE_STRING_LENGTH) {
+            token.type = StreamTokenType::Date;
+            token.date = Date::tryParse(text);
+            return true;
+        }
+        if (text.size() == consts::TIME_STAMP_STRING_LENGTH) {
+            token.type = StreamTokenType::TimeStamp;
+            token.timeStamp = TimeStamp::tryParse(text);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Appends the part of a token that is in the current chunk to the carried over characters. Only the first
+     * @c MAX_TOKEN_LENGTH characters are kept, a longer token is skipped anyway.
+     * @param text
+     *          The characters to append.
+     */
+    void StreamTokenizer::carry(std::string_view text) {
+        // An empty chunk can have a null data pointer, which memcpy must not be given.
+        if (!text.empty() && pendingLength < MAX_TOKEN_LENGTH) {
+            std::size_t count{std::min(text.size(), MAX_TOKEN_LENGTH - pendingLength)};
+            std::memcpy(pending + pendingLength, text.data(), count);
+        }
+        pendingLength += text.size();
+    }
+}
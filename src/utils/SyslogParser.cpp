@@ -0,0 +1,184 @@
+/**
+ * @file SyslogParser.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include "../../include/dt/utils/SyslogParser.hpp"
+
+#include "../../include/dt/utils/ParseUtils.hpp"
+
+namespace dt {
+    namespace {
+        // Mmm dd hh:mm:ss, for detail::findLayoutMismatch.
+        constexpr std::string_view RFC_3164_LAYOUT{"AAA _D DD:DD:DD"};
+
+        static_assert(RFC_3164_LAYOUT.size() == consts::SYSLOG_TIMESTAMP_STRING_LENGTH);
+
+        constexpr std::size_t RFC_5424_MAX_FRACTION_DIGITS{6};
+    }
+
+    /**
+     * @brief @c SyslogParser constructor.
+     * @param reference
+     *          The date the years of BSD syslog time stamps are inferred from, e.g. today.
+     */
+    SyslogParser::SyslogParser(const Date& reference) {
+        setReference(reference);
+    }
+
+    /**
+     * @brief Parses a syslog time stamp in either format without throwing, see @c tryParseRfc3164 &
+     * @c tryParseRfc5424. A time stamp starting with a letter is a BSD one.
+     * @param timeStamp
+     *          The time stamp, without the rest of the line.
+     * @return The parsed date time, or why it could not be parsed.
+     */
+    ParseResult<DateTime> SyslogParser::tryParse(std::string_view timeStamp) const noexcept {
+        if (!timeStamp.empty() && detail::isLetter(timeStamp[0])) {
+            return tryParseRfc3164(timeStamp);
+        }
+        return tryParseRfc5424(timeStamp);
+    }
+
+    /**
+     * @brief Parses a BSD syslog (RFC 3164) time stamp without throwing, e.g. @c Oct @c 17 @c 12:34:56. The year is
+     * inferred from the reference date & the date time is local. The month name is case-insensitive.
+     * @param timeStamp
+     *          The time stamp, exactly @c consts::SYSLOG_TIMESTAMP_STRING_LENGTH characters long.
+     * @return The parsed date time, or why it could not be parsed.
+     */
+    ParseResult<DateTime> SyslogParser::tryParseRfc3164(std::string_view timeStamp) const noexcept {
+        // Mmm dd hh:mm:ss
+        // 012345678901234
+        const char* str{timeStamp.data()};
+        const bool matched{timeStamp.size() == RFC_3164_LAYOUT.size() && str[3] == ' ' &&
+                           (detail::isDigit(str[4]) || str[4] == ' ') && detail::isDigit(str[5]) && str[6] == ' ' &&
+                           detail::isTimeLayout(str + 7)};
+        if (!matched) {
+            std::size_t mismatch{detail::findLayoutMismatch(timeStamp, RFC_3164_LAYOUT)};
+            ParseError error{detail::getLayoutError(timeStamp, RFC_3164_LAYOUT, mismatch)};
+            return {error, error == ParseError::InvalidMonthName ? 0 : mismatch};
+        }
+
+        int m{detail::parseMonthName(str, 3)};
+        if (m == 0) {
+            return {ParseError::InvalidMonthName, 0};
+        }
+        int d{str[4] == ' ' ? str[5] - '0' : detail::parseTwoDigits(str + 4)};
+        int y{years[m - 1]};
+        if (!detail::isValidDate(d, m, y)) {
+            return {ParseError::InvalidDate, 4};
+        }
+
+        int h{detail::parseTwoDigits(str + 7)};
+        int mi{detail::parseTwoDigits(str + 10)};
+        int s{detail::parseTwoDigits(str + 13)};
+        if (h > consts::HOUR_MAX) {
+            return {ParseError::InvalidTime, 7};
+        }
+        if (mi > consts::MINUTE_MAX) {
+            return {ParseError::InvalidTime, 10};
+        }
+        if (s > consts::SECOND_MAX) {
+            return {ParseError::InvalidTime, 13};
+        }
+        Date date;
+        date.assignDate(d, m, y);
+        return DateTime{date, h, mi, s, 0, 0, false};
+    }
+
+    /**
+     * @brief Parses an RFC 5424 syslog time stamp without throwing, e.g. @c 2023-10-17T12:34:56.123456+01:00. This is
+     * @c DateTime::tryParse restricted to what RFC 5424 allows: the date & time must be separated by an upper case
+     * 'T', the UTC offset is required, a 'Z' must be upper case & the fraction has at most 6 digits. The nil value
+     * @c - is rejected like any other string that isn't a time stamp.
+     * @param timeStamp
+     *          The time stamp, without the rest of the line.
+     * @return The parsed date time, or why it could not be parsed.
+     */
+    ParseResult<DateTime> SyslogParser::tryParseRfc5424(std::string_view timeStamp) noexcept {
+        ParseResult<DateTime> result{DateTime::tryParse(timeStamp)};
+        if (!result) {
+            return result;
+        }
+
+        // YYYY-MM-DDTHH:MM:SS[.ffffff](Z|±HH:MM)
+        // 01234567890123456789
+        const std::size_t size{timeStamp.size()};
+        const std::size_t timeEnd{detail::DATE_TIME_LAYOUT.size()};
+        if (timeStamp[10] != consts::DATE_TIME_SEPARATOR) {
+            return {ParseError::ExpectedSeparator, 10};
+        }
+        std::size_t i{timeEnd};
+        if (i < size && timeStamp[i] == '.') {
+            ++i;
+            while (i < size && detail::isDigit(timeStamp[i])) {
+                ++i;
+            }
+            if (i - timeEnd - 1 > RFC_5424_MAX_FRACTION_DIGITS) {
+                return {ParseError::TooLong, timeEnd + 1 + RFC_5424_MAX_FRACTION_DIGITS};
+            }
+        } else if (i < size && timeStamp[i] == ',') {
+            return {ParseError::ExpectedSeparator, i};
+        }
+        if (i == size) {
+            return {ParseError::TooShort, i};
+        }
+        // RFC 3339 offsets only: 'Z' or ±HH:MM.
+        if (timeStamp[i] == 'z') {
+            return {ParseError::ExpectedSeparator, i};
+        }
+        if (timeStamp[i] != consts::UTC_DESIGNATOR) {
+            if (i + 3 >= size) {
+                return {ParseError::TooShort, size};
+            }
+            if (timeStamp[i + 3] != consts::TIME_SEPARATOR) {
+                return {ParseError::ExpectedSeparator, i + 3};
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the date the years of BSD syslog time stamps are inferred from.
+     * @return The reference date.
+     */
+    Date SyslogParser::getReference() const {
+        return reference;
+    }
+
+    /**
+     * @brief Sets the date the years of BSD syslog time stamps are inferred from, e.g. once a day or per log file.
+     * @param reference
+     *          The reference date.
+     */
+    void SyslogParser::setReference(const Date& reference) {
+        this->reference = reference;
+        const int referenceYear{reference.getYear()};
+        const int referenceMonth{reference.getMonth()};
+        for (int month{consts::MIN_NUMBER_OF_MONTHS}; month <= consts::MAX_NUMBER_OF_MONTHS; ++month) {
+            const int monthsAhead{(month - referenceMonth + consts::MAX_NUMBER_OF_MONTHS) %
+                                  consts::MAX_NUMBER_OF_MONTHS};
+            if (monthsAhead <= consts::SYSLOG_MAX_MONTHS_AHEAD) {
+                years[month - 1] = referenceYear + (month < referenceMonth ? 1 : 0);
+            } else {
+                years[month - 1] = referenceYear - (month > referenceMonth ? 1 : 0);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the year a BSD syslog time stamp in a month is taken to be from, see the class description.
+     * @param month
+     *          The month, 1-12.
+     * @return The inferred year, 0 if the month is out of range.
+     */
+    int SyslogParser::inferYear(int month) const {
+        if (month < consts::MIN_NUMBER_OF_MONTHS || month > consts::MAX_NUMBER_OF_MONTHS) {
+            return 0;
+        }
+        return years[month - 1];
+    }
+}
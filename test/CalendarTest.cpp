@@ -193,4 +193,59 @@ TEST(Calendar, GIVEN_calendarObject_WHEN_decrementPost_THEN_correctlyDecremented
     ASSERT_EQ(12, calendar2.getCurrentMonth());
     ASSERT_EQ(2022, calendar2.getCurrentYear());
     ASSERT_EQ(expectedDate2, calendar2.getCurrentDate());
-}
\ No newline at end of file
+}
+
+/**
+ * @brief @c Calendar test 10.
+ */
+TEST(Calendar, GIVEN_calendarObject_WHEN_renderedPlain_THEN_monthGridWritten) {
+    const std::string expected{
+            "Jul 2023\n"
+            "Mo Tu We Th Fr Sa Su\n"
+            "                1  2\n"
+            " 3  4  5  6  7  8  9\n"
+            "10 11 12 13 14 15 16\n"
+            "17 18 19 20 21 22 23\n"
+            "24 25 26 27 28 29 30\n"
+            "31"};
+    char buffer[dt::Calendar::maxLength(1, 1, dt::CalendarStyle::Plain)];
+    const dt::Calendar calendar{9, 7, 2023};
+
+    char* end{calendar.toChars(buffer, buffer + sizeof(buffer), 1, 1, dt::CalendarStyle::Plain)};
+    ASSERT_NE(nullptr, end);
+    ASSERT_EQ(expected, std::string(buffer, end));
+    ASSERT_EQ(nullptr, calendar.toChars(buffer, buffer + sizeof(buffer) - 1, 1, 1, dt::CalendarStyle::Plain));
+
+    const std::string coloured{calendar.toString()};
+    ASSERT_NE(std::string::npos, coloured.find(std::string{" "} + dt::consts::COLOR_GREEN + "9" + dt::consts::COLOR_RESET));
+    ASSERT_NE(std::string::npos, coloured.find(std::string{dt::consts::COLOR_WHITE} + "31" + dt::consts::COLOR_RESET));
+}
+
+/**
+ * @brief @c Calendar test 11.
+ */
+TEST(Calendar, GIVEN_year_WHEN_formatYearCalled_THEN_monthsWrittenSideBySide) {
+    std::vector<char> buffer(dt::Calendar::maxLength(12, 3, dt::CalendarStyle::Plain));
+    char* end{dt::Calendar::formatYear(2024, buffer.data(), buffer.data() + buffer.size())};
+    ASSERT_NE(nullptr, end);
+    const std::string year(buffer.data(), end);
+
+    const std::string firstQuarter{
+            "Jan 2024              Feb 2024              Mar 2024\n"
+            "Mo Tu We Th Fr Sa Su  Mo Tu We Th Fr Sa Su  Mo Tu We Th Fr Sa Su\n"
+            " 1  2  3  4  5  6  7            1  2  3  4               1  2  3\n"
+            " 8  9 10 11 12 13 14   5  6  7  8  9 10 11   4  5  6  7  8  9 10\n"
+            "15 16 17 18 19 20 21  12 13 14 15 16 17 18  11 12 13 14 15 16 17\n"
+            "22 23 24 25 26 27 28  19 20 21 22 23 24 25  18 19 20 21 22 23 24\n"
+            "29 30 31              26 27 28 29           25 26 27 28 29 30 31\n"
+            "\n"
+            "Apr 2024"};
+    ASSERT_EQ(firstQuarter, year.substr(0, firstQuarter.size()));
+    ASSERT_EQ(std::string::npos, year.find('\x1B'));
+    ASSERT_EQ(std::string::npos, year.find(" \n"));
+    ASSERT_EQ("30 31", year.substr(year.size() - 5));
+
+    ASSERT_EQ(nullptr, dt::Calendar::formatYear(10'000, buffer.data(), buffer.data() + buffer.size()));
+    const dt::Calendar lastMonth{12, 9'999};
+    ASSERT_EQ(nullptr, lastMonth.toChars(buffer.data(), buffer.data() + buffer.size(), 2));
+}
@@ -0,0 +1,163 @@
+/**
+ * @file CsvDateColumnTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/CsvDateColumn.hpp"
+
+namespace {
+    std::string writeTempFile(const std::string& name, const std::string& contents) {
+        const std::string path{::testing::TempDir() + name};
+        std::ofstream file{path, std::ios::binary};
+        file << contents;
+        return path;
+    }
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file{path, std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+}
+
+/**
+ * @brief @c CsvDateColumnReader test 1.
+ */
+TEST(CsvDateColumnReader, GIVEN_csvFile_WHEN_columnRead_THEN_datesAndValidMaskSet) {
+    const std::string path{writeTempFile("dates.csv",
+                                         "id,traded,note\n"
+                                         "1,2001-12-22,plain\n"
+                                         "2,\"22/12/2001\",\"quoted, with a delimiter\"\n"
+                                         "3,22-12-2001,\"spans\nlines \"\"quoted\"\"\"\r\n"
+                                         "4,2001-12-22\r\n"
+                                         "5\n"
+                                         "6,31-02-2001,invalid\n"
+                                         "\"7,\",2002-07-09")};
+
+    dt::CsvDateColumnReader reader{path, 1};
+    std::vector<dt::Date> dates;
+    std::vector<std::uint64_t> validMask;
+    ASSERT_EQ(7, reader.readAll(dates, validMask));
+
+    const std::vector<dt::Date> expected {
+        dt::Date{"2001-12-22"}, dt::Date{"22/12/2001"}, dt::Date{"22-12-2001"}, dt::Date{"2001-12-22"}, {}, {},
+        dt::Date{"2002-07-09"}
+    };
+    ASSERT_EQ(expected, dates);
+    ASSERT_EQ(1, validMask.size());
+    ASSERT_EQ(0b1001111U, validMask[0]);
+    ASSERT_TRUE(reader.isAtEnd());
+    ASSERT_EQ(7, reader.getRowsRead());
+    ASSERT_EQ(0, reader.read(dates.data(), validMask.data(), dates.size()));
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief @c CsvDateColumnReader test 2.
+ */
+TEST(CsvDateColumnReader, GIVEN_largeFile_WHEN_readInChunks_THEN_sameAsReadAll) {
+    std::string contents;
+    for (int i{0}; i < 1'000; ++i) {
+        const int day{1 + i % 28};
+        const int month{1 + i % 12};
+        contents += std::to_string(i) + ";" + (day < 10 ? "0" : "") + std::to_string(day) + "-" +
+                    (month < 10 ? "0" : "") + std::to_string(month) + "-" + std::to_string(1990 + i % 30) + "\n";
+    }
+    const std::string path{writeTempFile("chunks.csv", contents)};
+
+    std::vector<dt::Date> all;
+    std::vector<std::uint64_t> allMask;
+    dt::CsvDateColumnReader{path, 1, ';', false}.readAll(all, allMask);
+    ASSERT_EQ(1'000, all.size());
+
+    dt::CsvDateColumnReader reader{path, 1, ';', false};
+    ASSERT_EQ(contents.size(), reader.getFileSize());
+    std::vector<dt::Date> chunk(128);
+    std::vector<std::uint64_t> chunkMask(dt::DateBatchParser::validMaskSize(chunk.size()));
+    std::size_t row{0};
+    while (std::size_t rows{reader.read(chunk.data(), chunkMask.data(), chunk.size())}) {
+        for (std::size_t i{0}; i < rows; ++i, ++row) {
+            ASSERT_TRUE(dt::DateBatchParser::isValid(chunkMask.data(), i)) << row;
+            ASSERT_TRUE(dt::DateBatchParser::isValid(allMask.data(), row)) << row;
+            ASSERT_EQ(all[row], chunk[i]) << row;
+        }
+    }
+    ASSERT_EQ(1'000, row);
+    ASSERT_EQ(dt::Date(6, 2, 2015), all[985]);
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief @c CsvDateColumnReader test 3.
+ */
+TEST(CsvDateColumnReader, GIVEN_missingOrEmptyFile_WHEN_opened_THEN_errorOrNoRows) {
+    ASSERT_THROW(dt::CsvDateColumnReader(::testing::TempDir() + "missing.csv", 0), std::system_error);
+
+    const std::string path{writeTempFile("empty.csv", "")};
+    dt::CsvDateColumnReader reader{path, 0};
+    std::vector<dt::Date> dates;
+    std::vector<std::uint64_t> validMask;
+    ASSERT_TRUE(reader.isAtEnd());
+    ASSERT_EQ(0, reader.readAll(dates, validMask));
+    ASSERT_TRUE(dates.empty());
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief @c CsvDateColumnWriter test 1.
+ */
+TEST(CsvDateColumnWriter, GIVEN_dates_WHEN_written_THEN_oneFormattedDatePerLine) {
+    const std::vector<dt::Date> dates {{22, 12, 2001}, {}, {9, 7, 2002}};
+    const std::uint64_t validMask[] {0b101};
+
+    std::vector<char> buffer(dt::CsvDateColumnWriter::bufferSize(dates.size()));
+    std::size_t length{dt::CsvDateColumnWriter::write(dates.data(), dates.size(), dt::DateFormat::YYYY_MM_DD,
+                                                      buffer.data(), validMask)};
+    ASSERT_EQ("2001-12-22\n\n2002-07-09\n", std::string(buffer.data(), length));
+    length = dt::CsvDateColumnWriter::write(dates.data(), 1, dt::DateFormat::MM__DD__YYYY, buffer.data());
+    ASSERT_EQ("12/22/2001\n", std::string(buffer.data(), length));
+
+    std::vector<dt::Date> many;
+    for (int i{0}; i < 5'000; ++i) {
+        many.emplace_back(1 + i % 28, 1 + i % 12, 2000 + i % 20);
+    }
+    const std::string path{::testing::TempDir() + "written.csv"};
+    dt::CsvDateColumnWriter::writeFile(path, "date", many.data(), many.size(), dt::DateFormat::DD_MM_YYYY);
+    const std::string contents{readFile(path)};
+    ASSERT_EQ(5 + 11 * many.size(), contents.size());
+    ASSERT_EQ("date\n01-01-2000\n02-02-2001\n", contents.substr(0, 27));
+
+    std::vector<dt::Date> readBack;
+    std::vector<std::uint64_t> readBackMask;
+    dt::CsvDateColumnReader{path, 0}.readAll(readBack, readBackMask);
+    ASSERT_EQ(many, readBack);
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief @c CsvDateColumnWriter test 2.
+ */
+TEST(CsvDateColumnWriter, GIVEN_yearOutsideFourDigits_WHEN_written_THEN_sameWithOrWithoutMask) {
+    dt::Date afterMaxYear{31, 12, 9'999};
+    afterMaxYear.addDays(1);
+    const std::vector<dt::Date> dates {{22, 12, 2001}, afterMaxYear};
+    const std::uint64_t validMask[] {0b11};
+    const std::string expected{"2001-12-22\n10000-01-01\n"};
+
+    std::vector<char> buffer(dt::CsvDateColumnWriter::bufferSize(dates.size()));
+    std::size_t length{dt::CsvDateColumnWriter::write(dates.data(), dates.size(), dt::DateFormat::YYYY_MM_DD,
+                                                      buffer.data())};
+    ASSERT_EQ(expected, std::string(buffer.data(), length));
+    length = dt::CsvDateColumnWriter::write(dates.data(), dates.size(), dt::DateFormat::YYYY_MM_DD, buffer.data(),
+                                            validMask);
+    ASSERT_EQ(expected, std::string(buffer.data(), length));
+}
@@ -0,0 +1,107 @@
+/**
+ * @file CurrentTimeTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/time/CurrentTime.hpp"
+#include "../include/dt/utils/DateTimeUtils.hpp"
+
+namespace {
+    /**
+     * @brief Formats a time point the slow way, with @c std::strftime, for comparison.
+     */
+    std::string expectedLocalTime(std::chrono::system_clock::time_point time) {
+        using namespace std::chrono;
+        const std::time_t seconds{system_clock::to_time_t(floor<std::chrono::seconds>(time))};
+        std::tm local{};
+        localtime_r(&seconds, &local);
+        char buffer[32];
+        std::size_t length{std::strftime(buffer, sizeof(buffer), "%H:%M:%S:", &local)};
+        const auto milliseconds{(floor<std::chrono::milliseconds>(time.time_since_epoch()).count() % 1'000 + 1'000) %
+                                1'000};
+        std::snprintf(buffer + length, sizeof(buffer) - length, "%03d", static_cast<int>(milliseconds));
+        return buffer;
+    }
+
+    std::string format(std::chrono::system_clock::time_point time) {
+        char buffer[dt::consts::TIME_STAMP_STRING_LENGTH];
+        return {buffer, dt::CurrentTime::format(time, buffer)};
+    }
+}
+
+/**
+ * @brief @c CurrentTime test 1.
+ */
+TEST(CurrentTime, GIVEN_timePoints_WHEN_formatted_THEN_localTimeWithMilliseconds) {
+    using namespace std::chrono;
+    const system_clock::time_point time{seconds{1'688'928'397} + milliseconds{7}};
+    ASSERT_EQ(expectedLocalTime(time), format(time));
+    // The same second again comes from the cache, only the milliseconds change.
+    ASSERT_EQ(expectedLocalTime(time + milliseconds{992}), format(time + milliseconds{992}));
+    ASSERT_EQ(expectedLocalTime(time + milliseconds{993}), format(time + milliseconds{993}));
+    ASSERT_EQ(expectedLocalTime(time - milliseconds{8}), format(time - milliseconds{8}));
+    ASSERT_EQ(expectedLocalTime(system_clock::time_point{milliseconds{-1}}),
+              format(system_clock::time_point{milliseconds{-1}}));
+}
+
+/**
+ * @brief @c CurrentTime test 2.
+ */
+TEST(CurrentTime, GIVEN_manyThreads_WHEN_formattingDifferentSeconds_THEN_neverTorn) {
+    using namespace std::chrono;
+    const system_clock::time_point base{seconds{1'688'928'397}};
+    std::vector<std::string> expected;
+    for (int second{0}; second < 3; ++second) {
+        expected.push_back(expectedLocalTime(base + seconds{second} + milliseconds{second * 111}));
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(8, 0);
+    for (int t{0}; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i{0}; i < 20'000; ++i) {
+                int second{(i + t) % 3};
+                failures[t] += format(base + seconds{second} + milliseconds{second * 111}) != expected[second];
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int failure : failures) {
+        ASSERT_EQ(0, failure);
+    }
+}
+
+/**
+ * @brief @c CurrentTime test 3.
+ */
+TEST(CurrentTime, GIVEN_now_WHEN_formatted_THEN_sameAsTimeStampAndDateTimeUtils) {
+    const dt::InlineString<dt::consts::TIME_STAMP_STRING_LENGTH> now{dt::CurrentTime::toInlineString()};
+    ASSERT_EQ(dt::consts::TIME_STAMP_STRING_LENGTH, now.size());
+
+    // Retry in the unlikely case the calls straddle a second.
+    for (int attempt{0}; attempt < 3; ++attempt) {
+        const std::string text{dt::CurrentTime::toInlineString().str()};
+        dt::TimeStamp timeStamp;
+        timeStamp.setToCurrentTime();
+        const std::string utilsText{dt::DateTimeUtils::getCurrentTimeStr()};
+        if (text.substr(0, 8) == utilsText.substr(0, 8) && text.substr(0, 8) == timeStamp.toString().substr(0, 8)) {
+            SUCCEED();
+            return;
+        }
+    }
+    FAIL();
+}
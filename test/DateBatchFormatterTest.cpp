@@ -0,0 +1,128 @@
+/**
+ * @file DateBatchFormatterTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/date/FormattedDate.hpp"
+#include "../include/dt/utils/DateBatchFormatter.hpp"
+
+namespace {
+    const std::vector<dt::BatchBackend> backends {
+        dt::BatchBackend::Scalar,
+        dt::BatchBackend::SSSE3,
+        dt::BatchBackend::AVX2,
+        dt::BatchBackend::Auto,
+    };
+
+    const std::vector<dt::DateFormat> formats {
+        dt::DateFormat::DD_MM_YYYY, dt::DateFormat::MM_DD_YYYY, dt::DateFormat::YYYY_MM_DD,
+        dt::DateFormat::YYYY_DD_MM, dt::DateFormat::DD__MM__YYYY, dt::DateFormat::MM__DD__YYYY,
+        dt::DateFormat::YYYY__MM__DD, dt::DateFormat::YYYY__DD__MM,
+    };
+
+    std::vector<dt::Date> makeDates(std::size_t count) {
+        std::vector<dt::Date> dates{{}};
+        for (std::size_t i{1}; i < count; ++i) {
+            dates.emplace_back(1 + static_cast<int>(i * 7 % 28), 1 + static_cast<int>(i % 12),
+                               dt::consts::MIN_YEAR + static_cast<int>(i * 37 % 8'417));
+        }
+        return dates;
+    }
+
+    // The batch output keeps its fixed width for a default constructed date, with every digit zero.
+    std::string formatExpected(const dt::Date& date, dt::DateFormat format) {
+        if (date != dt::Date{}) {
+            return dt::FormattedDate{date, format}.toString();
+        }
+        std::string expected{dt::detail::getDateLayout(format).pattern};
+        std::replace(expected.begin(), expected.end(), 'D', '0');
+        return expected;
+    }
+}
+
+/**
+ * @brief @c DateBatchFormatter test 1.
+ */
+TEST(DateBatchFormatter, GIVEN_dates_WHEN_formattedDelimited_THEN_sameAsFormattedDate) {
+    // Not a multiple of the block or vector width, to cover the scalar tail.
+    const std::vector<dt::Date> dates{makeDates(203)};
+
+    for (auto format : formats) {
+        std::string expected;
+        for (const dt::Date& date : dates) {
+            expected += formatExpected(date, format) + '\n';
+        }
+        for (auto backend : backends) {
+            std::string buffer(expected.size(), '\0');
+            std::size_t length{dt::DateBatchFormatter::formatDelimited(dates.data(), dates.size(), format,
+                                                                       buffer.data(), '\n', backend)};
+            ASSERT_EQ(expected.size(), length);
+            ASSERT_EQ(expected, buffer) << static_cast<int>(format) << " " << static_cast<int>(backend);
+        }
+    }
+}
+
+/**
+ * @brief @c DateBatchFormatter test 2.
+ */
+TEST(DateBatchFormatter, GIVEN_stride_WHEN_formattedFixed_THEN_gapsLeftUntouched) {
+    const std::vector<dt::Date> dates{makeDates(21)};
+    constexpr std::size_t stride{14};
+
+    for (auto backend : backends) {
+        std::string buffer(dates.size() * stride, '.');
+        dt::DateBatchFormatter::formatFixed(dates.data(), dates.size(), dt::DateFormat::YYYY__DD__MM, buffer.data(),
+                                            stride, backend);
+        for (std::size_t i{0}; i < dates.size(); ++i) {
+            ASSERT_EQ(formatExpected(dates[i], dt::DateFormat::YYYY__DD__MM),
+                      buffer.substr(i * stride, dt::consts::DATE_STRING_LENGTH)) << i;
+            ASSERT_EQ("....", buffer.substr(i * stride + dt::consts::DATE_STRING_LENGTH, 4)) << i;
+        }
+        ASSERT_EQ("0000/00/00....1620/08/02....", buffer.substr(0, 2 * stride));
+    }
+}
+
+/**
+ * @brief @c DateBatchFormatter test 3.
+ */
+TEST(DateBatchFormatter, GIVEN_emptyBatch_WHEN_formatted_THEN_nothingWritten) {
+    char buffer[1]{'x'};
+    ASSERT_EQ(0, dt::DateBatchFormatter::formatDelimited(nullptr, 0, dt::DateFormat::YYYY_MM_DD, buffer, ','));
+    dt::DateBatchFormatter::formatFixed(nullptr, 0, dt::DateFormat::YYYY_MM_DD, buffer, 10);
+    ASSERT_EQ('x', buffer[0]);
+}
+
+/**
+ * @brief @c DateBatchFormatter test 4.
+ */
+TEST(DateBatchFormatter, GIVEN_yearOutsideFourDigits_WHEN_formatted_THEN_errorReported) {
+    dt::Date afterMaxYear{31, 12, 9'999};
+    afterMaxYear.addDays(1);
+    ASSERT_EQ(10'000, afterMaxYear.getYear());
+    std::vector<dt::Date> dates{makeDates(100)};
+    dates[70] = afterMaxYear;
+
+    for (auto backend : backends) {
+        std::string buffer(dates.size() * dt::consts::DATE_MAX_STRING_LENGTH, '\0');
+        ASSERT_EQ(0, dt::DateBatchFormatter::formatDelimited(dates.data(), dates.size(), dt::DateFormat::YYYY_MM_DD,
+                                                             buffer.data(), '\n', backend));
+        ASSERT_FALSE(dt::DateBatchFormatter::formatFixed(dates.data(), dates.size(), dt::DateFormat::YYYY_MM_DD,
+                                                         buffer.data(), dt::consts::DATE_STRING_LENGTH, backend));
+
+        const dt::Date defaults[2] {};
+        ASSERT_EQ(22, dt::DateBatchFormatter::formatDelimited(defaults, 2, dt::DateFormat::YYYY_MM_DD,
+                                                              buffer.data(), '\n', backend));
+        ASSERT_EQ("0000-00-00\n0000-00-00\n", buffer.substr(0, 22));
+        ASSERT_TRUE(dt::DateBatchFormatter::formatFixed(defaults, 2, dt::DateFormat::DD__MM__YYYY, buffer.data(),
+                                                        dt::consts::DATE_STRING_LENGTH, backend));
+        ASSERT_EQ("00/00/000000/00/0000", buffer.substr(0, 20));
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file DateBatchParserTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/DateBatchParser.hpp"
+
+namespace {
+    const std::vector<dt::BatchBackend> backends {
+        dt::BatchBackend::Scalar,
+        dt::BatchBackend::SSSE3,
+        dt::BatchBackend::AVX2,
+        dt::BatchBackend::Auto,
+    };
+}
+
+/**
+ * @brief @c DateBatchParser test 1.
+ */
+TEST(DateBatchParser, GIVEN_contiguousBuffer_WHEN_parsed_THEN_datesAndValidMaskSet) {
+    std::string buffer{"22-12-2001\n2001/12/22\n12/22/2001\n22-12/2001\n31-02-2001\n2002-07-09"};
+    std::vector<dt::Date> expectedDates {
+        {22, 12, 2001}, {22, 12, 2001}, {22, 12, 2001}, {}, {}, {7, 9, 2002}
+    };
+
+    for (auto backend : backends) {
+        std::vector<dt::Date> dates(expectedDates.size());
+        std::vector<std::uint64_t> validMask(dt::DateBatchParser::validMaskSize(dates.size()));
+
+        std::size_t valid{dt::DateBatchParser::parse(buffer.data(), dates.size(), 11, dates.data(),
+                                                     validMask.data(), backend)};
+
+        ASSERT_EQ(4, valid);
+        ASSERT_EQ(expectedDates, dates);
+        ASSERT_EQ(0b100111, validMask.at(0));
+    }
+}
+
+/**
+ * @brief @c DateBatchParser test 2.
+ */
+TEST(DateBatchParser, GIVEN_stringViews_WHEN_parsed_THEN_sameResultsAsDateConstructor) {
+    std::vector<std::string> strings;
+    for (int i{0}; i < 200; ++i) {
+        int a{1 + (i * 7) % 31};
+        int b{1 + (i * 5) % 13};
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), i % 2 == 0 ? "%02d-%02d-%04d" : "%04d/%02d/%02d",
+                      i % 2 == 0 ? a : 1990 + i, i % 2 == 0 ? b : a, i % 2 == 0 ? 1990 + i : b);
+        strings.emplace_back(buffer);
+    }
+    strings.emplace_back("22-12-2001 ");
+    strings.emplace_back("2001-1-022");
+    strings.emplace_back("");
+
+    std::vector<std::string_view> views{strings.begin(), strings.end()};
+    for (auto backend : backends) {
+        std::vector<dt::Date> dates(views.size());
+        std::vector<std::uint64_t> validMask(dt::DateBatchParser::validMaskSize(views.size()));
+        dt::DateBatchParser::parse(views.data(), views.size(), dates.data(), validMask.data(), backend);
+
+        for (std::size_t i{0}; i < views.size(); ++i) {
+            try {
+                dt::Date expected{views.at(i)};
+                ASSERT_TRUE(dt::DateBatchParser::isValid(validMask.data(), i));
+                ASSERT_EQ(expected, dates.at(i));
+            } catch (const std::exception&) {
+                ASSERT_FALSE(dt::DateBatchParser::isValid(validMask.data(), i));
+                ASSERT_EQ(dt::Date{}, dates.at(i));
+            }
+        }
+    }
+}
+
+/**
+ * @brief @c DateBatchParser test 3.
+ */
+TEST(DateBatchParser, GIVEN_emptyBatch_WHEN_parsed_THEN_nothingParsed) {
+    ASSERT_EQ(0, dt::DateBatchParser::validMaskSize(0));
+    ASSERT_EQ(1, dt::DateBatchParser::validMaskSize(64));
+    ASSERT_EQ(2, dt::DateBatchParser::validMaskSize(65));
+    ASSERT_EQ(0, dt::DateBatchParser::parse(static_cast<const char*>(nullptr), 0, 11, nullptr, nullptr));
+}
@@ -5,6 +5,9 @@
  * @copyright Copyright (c) 2023 liam under MIT licence.
  */
 
+#include <cstdint>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../include/dt/date/Date.hpp"
@@ -262,8 +265,343 @@ TEST(Date, GIVEN_dateObject_WHEN_parsedFromStringWithInvalidPattern_THEN_excepti
     ASSERT_THROW(dt::Date date2{"invalid_date"}, dt::DateParseException);
 }
 
+/**
+ * @brief @c Date test 20.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_parsedFromStringView_THEN_correctDateSet) {
+    dt::Date expectedDate{22, 12, 2001};
+    std::string_view line{"22-12-2001,2001/12/22,12/22/2001"};
+
+    ASSERT_EQ(expectedDate, dt::Date{line.substr(0, 10)});
+    ASSERT_EQ(expectedDate, dt::Date{line.substr(11, 10)});
+    ASSERT_EQ(expectedDate, dt::Date{line.substr(22, 10)});
+    ASSERT_EQ(expectedDate, dt::Date{std::string{"2001-22-12"}});
+}
+
+/**
+ * @brief @c Date test 21.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_parsedFromStringWithNearMissPattern_THEN_exceptionThrown) {
+    ASSERT_THROW(dt::Date date{"2001-12/22"}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{"2001-1-022"}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{"22-12-2001 "}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{" 22-12-2001"}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{"+2-12-2001"}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{"22:12:2001"}, dt::DateParseException);
+    ASSERT_THROW(dt::Date date{""}, dt::DateParseException);
+}
+
+/**
+ * @brief @c Date test 22.
+ */
+TEST(Date, GIVEN_validDateString_WHEN_tryParseCalled_THEN_dateReturned) {
+    dt::ParseResult<dt::Date> result{dt::Date::tryParse("2001/22/12")};
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(dt::ParseError::None, result.getError());
+    ASSERT_EQ(dt::Date(22, 12, 2001), result.getValue());
+    ASSERT_TRUE(dt::Date::tryParse("29-02-2024")->isLeapYear());
+}
+
+/**
+ * @brief @c Date test 23.
+ */
+TEST(Date, GIVEN_invalidDateString_WHEN_tryParseCalled_THEN_errorAndOffsetReturned) {
+    struct Case {
+        const char* date;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+            {"",            dt::ParseError::TooShort,          0},
+            {"22-12-200",   dt::ParseError::TooShort,          9},
+            {"22-12-2001 ", dt::ParseError::TooLong,           10},
+            {"2001-12/22",  dt::ParseError::ExpectedSeparator, 7},
+            {"22.12.2001",  dt::ParseError::ExpectedSeparator, 2},
+            {"22-1x-2001",  dt::ParseError::ExpectedDigit,     4},
+            {"2001-1-022",  dt::ParseError::ExpectedDigit,     6},
+            {"31-02-2001",  dt::ParseError::InvalidDate,       0},
+            {"2001-13-13",  dt::ParseError::InvalidDate,       5},
+            {"01-01-1582",  dt::ParseError::InvalidDate,       6},
+    };
+
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::Date> result{dt::Date::tryParse(c.date)};
+        ASSERT_FALSE(result) << c.date;
+        ASSERT_EQ(c.error, result.getError()) << c.date;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.date;
+        ASSERT_EQ(dt::Date{}, result.getValueOr(dt::Date{}));
+    }
+}
+
+
+/**
+ * @brief @c Date test 24.
+ */
+TEST(Date, GIVEN_dateWithMonthName_WHEN_tryParseTextCalled_THEN_correctValuesSet) {
+    const std::pair<const char*, dt::Date> cases[] {
+            {"22 Dec 2001",        {22, 12, 2001}},
+            {"2 dec 2001",         {2, 12, 2001}},
+            {"22 December 2001",   {22, 12, 2001}},
+            {"22-DEC-2001",        {22, 12, 2001}},
+            {"09-jUl-2023",        {9, 7, 2023}},
+            {"December 22, 2001",  {22, 12, 2001}},
+            {"Sep 1, 2023",        {1, 9, 2023}},
+            {"february 29, 2024",  {29, 2, 2024}},
+            {"1 May 1583",         {1, 5, 1583}},
+    };
+    for (const auto& [date, expected] : cases) {
+        dt::ParseResult<dt::Date> result{dt::Date::tryParseText(date)};
+        ASSERT_TRUE(result) << date;
+        ASSERT_EQ(expected, *result) << date;
+    }
+
+    for (int month{1}; month <= 12; ++month) {
+        std::string shortName{dt::DateTimeUtils::getMonthShortStr(month)};
+        std::string longName{dt::DateTimeUtils::getMonthLongStr(month)};
+        ASSERT_EQ(month, dt::Date::tryParseText("01 " + shortName + " 2001")->getMonth());
+        ASSERT_EQ(month, dt::Date::tryParseText(longName + " 1, 2001")->getMonth());
+    }
+}
+
+/**
+ * @brief @c Date test 25.
+ */
+TEST(Date, GIVEN_invalidDateWithMonthName_WHEN_tryParseTextCalled_THEN_errorAndOffsetReturned) {
+    struct Case {
+        const char* date;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+            {"",                   dt::ParseError::TooShort,          0},
+            {"22",                 dt::ParseError::TooShort,          2},
+            {"22/Dec/2001",        dt::ParseError::ExpectedSeparator, 2},
+            {"22 Dex 2001",        dt::ParseError::InvalidMonthName,  3},
+            {"22 Decem 2001",      dt::ParseError::InvalidMonthName,  3},
+            {"22-12-2001",         dt::ParseError::InvalidMonthName,  3},
+            {"22 Dec-2001",        dt::ParseError::ExpectedSeparator, 6},
+            {"22 Dec 201",         dt::ParseError::TooShort,          10},
+            {"22 Dec 20x1",        dt::ParseError::ExpectedDigit,     9},
+            {"22 Dec 20011",       dt::ParseError::TooLong,           11},
+            {"Decembre 22, 2001",  dt::ParseError::InvalidMonthName,  0},
+            {"December 22 2001",   dt::ParseError::ExpectedSeparator, 11},
+            {"December , 2001",    dt::ParseError::ExpectedDigit,     9},
+            {"December 22,2001",   dt::ParseError::ExpectedSeparator, 12},
+            {"December 32, 2001",  dt::ParseError::InvalidDate,       9},
+            {"31 Feb 2001",        dt::ParseError::InvalidDate,       0},
+            {"1 Jan 1582",         dt::ParseError::InvalidDate,       6},
+    };
+
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::Date> result{dt::Date::tryParseText(c.date)};
+        ASSERT_EQ(c.error, result.getError()) << c.date;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.date;
+    }
+}
+
+/**
+ * @brief @c Date test 26.
+ */
+TEST(Date, GIVEN_ymdInt_WHEN_fromYmdIntCalled_THEN_dateOrErrorReturned) {
+    dt::ParseResult<dt::Date> result{dt::Date::fromYmdInt(20231017)};
+    ASSERT_TRUE(result);
+    ASSERT_EQ(dt::Date(17, 10, 2023), *result);
+    ASSERT_EQ(20231017, result->toYmdInt());
+    ASSERT_EQ(dt::Date(29, 2, 2024), *dt::Date::fromYmdInt(20240229));
+    ASSERT_EQ(99991231, dt::Date(31, 12, 9999).toYmdInt());
+    ASSERT_EQ(0, dt::Date{}.toYmdInt());
+
+    const std::pair<std::int32_t, std::size_t> invalid[] {
+            {20230229, 6},
+            {20231032, 6},
+            {20231000, 6},
+            {20231317, 4},
+            {20230017, 4},
+            {15821017, 0},
+            {1017, 0},
+            {-20231017, 0},
+            {2'147'483'647, 0},
+    };
+    for (const auto& [ymd, offset] : invalid) {
+        result = dt::Date::fromYmdInt(ymd);
+        ASSERT_EQ(dt::ParseError::InvalidDate, result.getError()) << ymd;
+        ASSERT_EQ(offset, result.getErrorOffset()) << ymd;
+    }
+}
+
+/**
+ * @brief @c Date test 27.
+ */
+TEST(Date, GIVEN_ymdIntArray_WHEN_fromYmdIntsCalled_THEN_sameAsFromYmdIntAndRoundTrips) {
+    std::vector<std::int32_t> ymd;
+    for (int i{0}; i < 100; ++i) {
+        ymd.push_back(20230101 + (i % 12) * 100 + i % 31);
+    }
+    ymd[70] = 20230230;
+    ymd[99] = -1;
+
+    std::vector<dt::Date> dates(ymd.size());
+    std::vector<std::uint64_t> validMask(2);
+    std::size_t valid{dt::Date::fromYmdInts(ymd.data(), ymd.size(), dates.data(), validMask.data())};
+
+    std::size_t expectedValid{0};
+    for (std::size_t i{0}; i < ymd.size(); ++i) {
+        dt::ParseResult<dt::Date> expected{dt::Date::fromYmdInt(ymd[i])};
+        ASSERT_EQ(static_cast<bool>(expected), ((validMask[i / 64] >> (i % 64)) & 1) != 0) << ymd[i];
+        ASSERT_EQ(expected.getValueOr(dt::Date{}), dates[i]) << ymd[i];
+        expectedValid += static_cast<bool>(expected);
+    }
+    ASSERT_EQ(expectedValid, valid);
+    ASSERT_FALSE((validMask[1] >> (99 - 64)) & 1);
+
+    std::vector<std::int32_t> roundTrip(dates.size());
+    dt::Date::toYmdInts(dates.data(), dates.size(), roundTrip.data());
+    ASSERT_EQ(ymd[0], roundTrip[0]);
+    ASSERT_EQ(ymd[98], roundTrip[98]);
+    ASSERT_EQ(0, roundTrip[70]);
+}
+
 
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
+
+/**
+ * @brief @c Date test 28.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_toCharsCalled_THEN_sameAsToStringWithoutAllocating) {
+    char buffer[dt::consts::DATE_STRING_LENGTH];
+    const dt::Date date{9, 7, 2002};
+    char* end{date.toChars(buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("09-07-2002", std::string(buffer, end));
+    ASSERT_EQ(nullptr, date.toChars(buffer, buffer + sizeof(buffer) - 1));
+    ASSERT_EQ("09-07-2002", date.toInlineString().view());
+    ASSERT_STREQ("09-07-2002", date.toInlineString().c_str());
+    ASSERT_EQ(date.toString(), date.toInlineString().str());
+
+    const dt::Date empty;
+    ASSERT_EQ("00-00-0", empty.toString());
+    ASSERT_EQ("00-00-0", empty.toInlineString().view());
+    ASSERT_EQ(nullptr, empty.toChars(buffer, buffer + 6));
+}
+
+/**
+ * @brief @c Date test 29.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_weekdayCalled_THEN_correctWeekdayAndNamesReturned) {
+    ASSERT_EQ(dt::consts::Weekday::Saturday, (dt::Date{1, 1, 1583}.weekday()));
+    ASSERT_EQ(dt::consts::Weekday::Saturday, (dt::Date{22, 12, 2001}.weekday()));
+    ASSERT_EQ(dt::consts::Weekday::Sunday, (dt::Date{9, 7, 2023}.weekday()));
+    ASSERT_EQ(dt::consts::Weekday::Friday, (dt::Date{31, 12, 9999}.weekday()));
+
+    dt::Date date{1, 1, 2024};
+    for (int i{0}; i < 7; ++i) {
+        const dt::consts::Weekday weekday{date.weekday()};
+        ASSERT_EQ(i + 1, static_cast<int>(weekday));
+        ASSERT_EQ(dt::consts::getName(weekday), date.getDayOfWeek());
+        ASSERT_EQ(dt::consts::getName(weekday).substr(0, 3), dt::consts::getShortName(weekday));
+        date.addDays(1);
+    }
+
+    static_assert(dt::consts::getName(dt::consts::Month::September) == "September");
+    static_assert(dt::consts::getShortName(dt::consts::Month::September) == "Sep");
+    ASSERT_EQ("Dec", dt::DateTimeUtils::getMonthShortStr(12));
+    ASSERT_EQ("", dt::DateTimeUtils::getMonthShortStr(13));
+    ASSERT_EQ("", dt::DateTimeUtils::getMonthLongStr(0));
+}
+
+/**
+ * @brief @c Date test 30.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_arithmeticOverLongSpans_THEN_serialAndComponentsAgree) {
+    static_assert(sizeof(dt::Date) == 8);
+    ASSERT_EQ(0, (dt::Date{1, 1, 1970}.toDays()));
+    ASSERT_EQ(19'547, (dt::Date{9, 7, 2023}.toDays()));
+
+    dt::Date date{9, 7, 2023};
+    date.addDays(100'000);
+    ASSERT_EQ(dt::Date(23, 4, 2297), date);
+    ASSERT_TRUE(date.isLeapYear() == false);
+    date.addDays(-100'000);
+    ASSERT_EQ(dt::Date(9, 7, 2023), date);
+
+    date.addMonths(-(2023 - 1583) * 12 - 6);
+    ASSERT_EQ(dt::Date(9, 1, 1583), date);
+    date.addYears(8'416);
+    ASSERT_EQ(dt::Date(9, 1, 9999), date);
+
+    dt::Date leapDay{29, 2, 2024};
+    leapDay.addYears(1);
+    ASSERT_EQ(dt::Date(1, 3, 2025), leapDay);
+
+    const dt::Date first{1, 1, 1583};
+    const dt::Date last{31, 12, 9999};
+    ASSERT_EQ(3'074'245, dt::DateTimeUtils::daysBetween(first, last));
+    ASSERT_EQ(8'416 * 12 + 11, dt::DateTimeUtils::monthsBetween(first, last));
+    ASSERT_EQ(365, dt::DateTimeUtils::dayOfYear(last));
+    ASSERT_TRUE(dt::Date{} < first);
+
+    dt::Date unset;
+    unset.addDays(1);
+    ASSERT_EQ(dt::Date{}, unset);
+    ASSERT_EQ(0, unset.getYear());
+}
+
+/**
+ * @brief @c Date test 31.
+ */
+TEST(Date, GIVEN_dateObject_WHEN_arithmeticLeavesYearRange_THEN_exceptionThrownAndDateUnchanged) {
+    dt::Date date{1, 1, 2000};
+    ASSERT_THROW(date.addYears(40'000), dt::InvalidDateException);
+    ASSERT_THROW(date.addDays(2'000'000'000), dt::InvalidDateException);
+    ASSERT_THROW(date.addMonths(-2'000'000'000), dt::InvalidDateException);
+    ASSERT_EQ(dt::Date(1, 1, 2000), date);
+    ASSERT_EQ(2000, date.getYear());
+
+    date.addYears(32'767 - 2000);
+    ASSERT_EQ(32'767, date.getYear());
+    ASSERT_THROW(date.addYears(1), dt::InvalidDateException);
+    ASSERT_EQ(32'767, date.getYear());
+
+    dt::Date early{1, 1, 2000};
+    early.addYears(-32'768 - 2000);
+    ASSERT_EQ(-32'768, early.getYear());
+    ASSERT_THROW(early.addDays(-1), dt::InvalidDateException);
+    ASSERT_TRUE(early < dt::Date(1, 1, 1583));
+
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    ASSERT_EQ(10'000, late.getYear());
+    ASSERT_EQ(1, late.getMonth());
+    ASSERT_EQ(1, late.getDay());
+    ASSERT_TRUE(late > dt::Date(31, 12, 9999));
+}
+
+/**
+ * @brief @c Date test 32.
+ */
+TEST(Date, GIVEN_dateWithYearOutsideFourDigits_WHEN_formatted_THEN_fullYearWritten) {
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    ASSERT_EQ("01-01-10000", late.toString());
+    ASSERT_EQ("01-01-10000", late.toInlineString().view());
+    std::ostringstream lateStream;
+    lateStream << late;
+    ASSERT_EQ("01-01-10000", lateStream.str());
+
+    char buffer[dt::consts::DATE_STRING_LENGTH];
+    ASSERT_EQ(nullptr, late.toChars(buffer, buffer + sizeof(buffer)));
+
+    dt::Date early{1, 1, 2000};
+    early.addYears(-2'100);
+    ASSERT_EQ("01-01--100", early.toString());
+    ASSERT_EQ("01-01--100", early.toInlineString().view());
+    std::ostringstream earlyStream;
+    earlyStream << early;
+    ASSERT_EQ("01-01--100", earlyStream.str());
+
+    early.addYears(-32'768 + 100);
+    ASSERT_EQ("01-01--32768", early.toString());
+}
@@ -0,0 +1,116 @@
+/**
+ * @file DateTimePatternTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/time/DateTimePattern.hpp"
+
+/**
+ * @brief @c DateTimePattern test 1.
+ */
+TEST(DateTimePattern, GIVEN_pattern_WHEN_formatCalled_THEN_fieldsAndLiteralsWritten) {
+    const dt::DateTime dateTime{"2001-12-22T18:46:37.123456789+01:00"};
+
+    ASSERT_EQ("20011222", dt::DateTimePattern{"%Y%m%d"}.toString(dateTime));
+    ASSERT_EQ("22 Dec 2001 18:46:37.123456", dt::DateTimePattern{"%d %b %Y %H:%M:%S.%f"}.toString(dateTime));
+    ASSERT_EQ("Saturday, December 22 2001 18:46:37 +0100",
+              dt::DateTimePattern{"%A, %B %d %Y %T %z"}.toString(dateTime));
+    ASSERT_EQ("Sat 2001-12-22 18:46:37.123 / 123456789 100%",
+              dt::DateTimePattern{"%a %F %T.%L / %N 100%%"}.toString(dateTime));
+    ASSERT_EQ("2002-07-09 00:00:00", dt::DateTimePattern{"%F %T%z"}.toString(dt::Date{9, 7, 2002}));
+    ASSERT_EQ("-0930", dt::DateTimePattern{"%z"}.toString(dt::DateTime{dt::Date{9, 7, 2002}, 0, 0, 0, 0, -570}));
+    ASSERT_EQ("", dt::DateTimePattern{""}.toString(dateTime));
+
+    const dt::DateTimePattern pattern{"%d/%m/%Y"};
+    ASSERT_EQ(12, pattern.getMaxLength());
+    ASSERT_EQ("%d/%m/%Y", pattern.getPattern());
+    char buffer[12];
+    char* end{pattern.format(dateTime, buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("22/12/2001", std::string(buffer, end));
+    ASSERT_EQ(nullptr, pattern.format(dateTime, buffer, buffer + 11));
+    ASSERT_EQ(25, dt::DateTimePattern{"%A %B %z"}.getMaxLength());
+}
+
+/**
+ * @brief @c DateTimePattern test 2.
+ */
+TEST(DateTimePattern, GIVEN_invalidPattern_WHEN_compiled_THEN_exceptionThrown) {
+    ASSERT_THROW(dt::DateTimePattern{"%Y-%Q"}, dt::DateParseException);
+    ASSERT_THROW(dt::DateTimePattern{"%Y%"}, dt::DateParseException);
+    ASSERT_NO_THROW(dt::DateTimePattern{"%%"});
+}
+
+/**
+ * @brief @c DateTimePattern test 3.
+ */
+TEST(DateTimePattern, GIVEN_matchingString_WHEN_tryParseCalled_THEN_dateTimeReturned) {
+    const dt::DateTime dateTime{"2001-12-22T18:46:37.123456+01:00"};
+    const dt::DateTimePattern pattern{"%A, %d %b %Y %H:%M:%S.%f %z"};
+    ASSERT_EQ(dateTime, *pattern.tryParse(pattern.toString(dateTime)));
+    ASSERT_EQ(dateTime, *pattern.tryParse("sat, 22 DECEMBER 2001 18:46:37.123456 +01:00"));
+    ASSERT_EQ(dt::DateTime{"2001-12-22T18:46:37.123456Z"},
+              *pattern.tryParse("Saturday, 22 Dec 2001 18:46:37.123456 Z"));
+
+    ASSERT_EQ(dt::DateTime{"2001-12-22T00:00:00"}, *dt::DateTimePattern{"%Y%m%d"}.tryParse("20011222"));
+    ASSERT_EQ(dt::DateTime{"1970-01-01T18:46:37.123"}, *dt::DateTimePattern{"%T.%L"}.tryParse("18:46:37.123"));
+    ASSERT_EQ(dt::DateTime{"2001-12-22T18:46:37.123456789"},
+              *dt::DateTimePattern{"%F %T.%N"}.tryParse("2001-12-22 18:46:37.123456789"));
+    ASSERT_FALSE(dt::DateTimePattern{"%Y%m%d"}.tryParse("20011222")->hasUtcOffset());
+}
+
+/**
+ * @brief @c DateTimePattern test 4.
+ */
+TEST(DateTimePattern, GIVEN_mismatchingString_WHEN_tryParseCalled_THEN_errorAndOffsetReturned) {
+    struct Case {
+        std::string_view pattern;
+        std::string_view dateTime;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+        {"%Y-%m-%d", "2001-12-2", dt::ParseError::TooShort, 9},
+        {"%Y-%m-%d", "2001-12", dt::ParseError::TooShort, 7},
+        {"%Y-%m-%d", "2001/12/22", dt::ParseError::ExpectedSeparator, 4},
+        {"%Y-%m-%d", "2001-1x-22", dt::ParseError::ExpectedDigit, 6},
+        {"%Y-%m-%d", "2001-12-22T", dt::ParseError::TooLong, 10},
+        {"%Y-%m-%d", "2001-02-30", dt::ParseError::InvalidDate, 0},
+        {"on %d %b %Y", "on 22 Dez 2001", dt::ParseError::InvalidMonthName, 6},
+        {"%a %F", "Sad 2001-12-22", dt::ParseError::InvalidDate, 0},
+        {"%F %T", "2001-12-22 24:00:00", dt::ParseError::InvalidTime, 11},
+        {"%T%z", "18:46:37+1", dt::ParseError::TooShort, 10},
+        {"%T%z", "18:46:37 01:00", dt::ParseError::InvalidUtcOffset, 8},
+        {"%T%z", "18:46:37+01:60", dt::ParseError::InvalidUtcOffset, 8},
+        {"%T%z", "18:46:37+24:00", dt::ParseError::InvalidUtcOffset, 8},
+    };
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{dt::DateTimePattern{c.pattern}.tryParse(c.dateTime)};
+        ASSERT_EQ(c.error, result.getError()) << c.pattern << " " << c.dateTime;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.pattern << " " << c.dateTime;
+    }
+}
+
+/**
+ * @brief @c DateTimePattern test 5.
+ */
+TEST(DateTimePattern, GIVEN_yearOutsideFourDigits_WHEN_formatted_THEN_fullYearWrittenWithinMaxLength) {
+    const dt::DateTimePattern pattern{"%Y-%m-%d %b"};
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    ASSERT_EQ("10000-01-01 Jan", pattern.toString(late));
+
+    dt::Date early{1, 1, 2000};
+    early.addYears(-32'768 - 2000);
+    ASSERT_EQ("-32768-01-01 Jan", pattern.toString(early));
+
+    std::string buffer(pattern.getMaxLength(), '.');
+    char* end{pattern.format(early, buffer.data(), buffer.data() + buffer.size())};
+    ASSERT_EQ("-32768-01-01 Jan", std::string(buffer.data(), end));
+}
@@ -0,0 +1,185 @@
+/**
+ * @file DateTimeTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/time/DateTime.hpp"
+
+/**
+ * @brief @c DateTime test 1.
+ */
+TEST(DateTime, GIVEN_defaultDateTimeObject_WHEN_created_THEN_defaultValuesSet) {
+    dt::DateTime dateTime;
+
+    ASSERT_EQ(dt::Date{}, dateTime.getDate());
+    ASSERT_EQ(0, dateTime.getHour());
+    ASSERT_EQ(0, dateTime.getNanosecond());
+    ASSERT_FALSE(dateTime.hasUtcOffset());
+}
+
+/**
+ * @brief @c DateTime test 2.
+ */
+TEST(DateTime, GIVEN_dateTimeObject_WHEN_createdWithInvalidTime_THEN_defaultValuesSet) {
+    ASSERT_EQ(dt::DateTime{}, dt::DateTime(dt::Date{22, 12, 2001}, 24, 0, 0, 0));
+    ASSERT_EQ(dt::DateTime{}, dt::DateTime(dt::Date{22, 12, 2001}, 0, 0, 0, 1'000'000'000));
+    ASSERT_EQ(dt::DateTime{}, dt::DateTime(dt::Date{22, 12, 2001}, 0, 0, 0, 0, 24 * 60));
+}
+
+/**
+ * @brief @c DateTime test 3.
+ */
+TEST(DateTime, GIVEN_rfc3339String_WHEN_parsed_THEN_correctValuesSet) {
+    dt::DateTime dateTime{"2023-07-09T18:46:37.123456Z"};
+
+    ASSERT_EQ(dt::Date(9, 7, 2023), dateTime.getDate());
+    ASSERT_EQ(18, dateTime.getHour());
+    ASSERT_EQ(46, dateTime.getMinute());
+    ASSERT_EQ(37, dateTime.getSecond());
+    ASSERT_EQ(123, dateTime.getMillisecond());
+    ASSERT_EQ(123'456'000, dateTime.getNanosecond());
+    ASSERT_TRUE(dateTime.hasUtcOffset());
+    ASSERT_EQ(0, dateTime.getUtcOffsetMinutes());
+    ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), dateTime.getTimeStamp());
+}
+
+/**
+ * @brief @c DateTime test 4.
+ */
+TEST(DateTime, GIVEN_iso8601Variants_WHEN_parsed_THEN_fractionAndOffsetCorrectlySet) {
+    dt::Date date{9, 7, 2023};
+
+    ASSERT_EQ(dt::DateTime(date, 18, 46, 37, 0), dt::DateTime{"2023-07-09T18:46:37"});
+    ASSERT_EQ(dt::DateTime(date, 18, 46, 37, 500'000'000, 60), dt::DateTime{"2023-07-09t18:46:37,5+01:00"});
+    ASSERT_EQ(dt::DateTime(date, 18, 46, 37, 123'456'789, -330), dt::DateTime{"2023-07-09 18:46:37.1234567899-0530"});
+    ASSERT_EQ(dt::DateTime(date, 18, 46, 37, 1, 120), dt::DateTime{"2023-07-09T18:46:37.000000001+02"});
+    ASSERT_EQ(dt::DateTime(date, 0, 0, 0, 0, 0), dt::DateTime{"2023-07-09T00:00:00z"});
+}
+
+/**
+ * @brief @c DateTime test 5.
+ */
+TEST(DateTime, GIVEN_invalidString_WHEN_tryParseCalled_THEN_errorAndOffsetReturned) {
+    struct Case {
+        const char* dateTime;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+            {"2023-07-09",                   dt::ParseError::TooShort,          10},
+            {"2023-07-09X18:46:37Z",         dt::ParseError::ExpectedSeparator, 10},
+            {"2023-07-09T18:4:37Z",          dt::ParseError::ExpectedDigit,     15},
+            {"2023-07-09T18:46:37.Z",        dt::ParseError::ExpectedDigit,     20},
+            {"2023-07-09T18:46:37+1",        dt::ParseError::TooShort,          21},
+            {"2023-07-09T18:46:37+01:0",     dt::ParseError::TooShort,          24},
+            {"2023-07-09T18:46:37Z ",        dt::ParseError::TooLong,           20},
+            {"2023-02-29T18:46:37Z",         dt::ParseError::InvalidDate,       8},
+            {"2023-07-09T18:60:37Z",         dt::ParseError::InvalidTime,       14},
+            {"2023-07-09T18:46:60Z",         dt::ParseError::InvalidTime,       17},
+            {"2023-07-09T18:46:37+24:00",    dt::ParseError::InvalidUtcOffset,  20},
+    };
+
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{dt::DateTime::tryParse(c.dateTime)};
+        ASSERT_EQ(c.error, result.getError()) << c.dateTime;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.dateTime;
+    }
+    ASSERT_THROW(dt::DateTime{"2023-07-09T18:46"}, dt::DateParseException);
+    ASSERT_THROW(dt::DateTime{"2023-13-09T18:46:37"}, dt::InvalidDateException);
+    ASSERT_THROW(dt::DateTime{"2023-07-09T25:46:37"}, dt::InvalidTimeException);
+}
+
+/**
+ * @brief @c DateTime test 6.
+ */
+TEST(DateTime, GIVEN_dateTimeObject_WHEN_toStringCalled_THEN_roundTrips) {
+    const char* dateTimes[] {
+            "2023-07-09T18:46:37",
+            "2023-07-09T18:46:37Z",
+            "2023-07-09T18:46:37.120+01:00",
+            "2023-07-09T18:46:37.123456-05:30",
+            "1583-01-01T00:00:00.000000001Z",
+    };
+
+    for (const auto* d : dateTimes) {
+        ASSERT_EQ(d, dt::DateTime{d}.toString());
+    }
+
+    std::ostringstream ss;
+    ss << dt::DateTime{dt::Date{22, 12, 2001}, dt::TimeStamp{1, 2, 3, 4}};
+    ASSERT_EQ("2001-12-22T01:02:03.004", ss.str());
+}
+
+/**
+ * @brief @c DateTime test 7.
+ */
+TEST(DateTime, GIVEN_precisionAndUtcStyle_WHEN_toCharsCalled_THEN_rfc3339Written) {
+    const dt::DateTime utc{dt::Date{9, 7, 2023}, 18, 46, 37, 123'456'789, 0};
+    ASSERT_EQ("2023-07-09T18:46:37Z", utc.toString(dt::FractionPrecision::Seconds));
+    ASSERT_EQ("2023-07-09T18:46:37.123Z", utc.toString(dt::FractionPrecision::Milliseconds));
+    ASSERT_EQ("2023-07-09T18:46:37.123456+00:00",
+              utc.toString(dt::FractionPrecision::Microseconds, dt::UtcStyle::Numeric));
+    ASSERT_EQ("2023-07-09T18:46:37.123456789Z", utc.toInlineString().view());
+
+    const dt::DateTime offset{dt::Date{9, 7, 2023}, 18, 46, 37, 0, -330};
+    ASSERT_EQ("2023-07-09T18:46:37.000000000-05:30", offset.toString(dt::FractionPrecision::Nanoseconds));
+    ASSERT_EQ("2023-07-09T18:46:37-05:30", offset.toString(dt::FractionPrecision::Auto, dt::UtcStyle::Numeric));
+
+    const dt::DateTime local{dt::Date{9, 7, 2023}, 18, 46, 37, 5'000'000};
+    ASSERT_EQ("2023-07-09T18:46:37.005", local.toString(dt::FractionPrecision::Milliseconds, dt::UtcStyle::Numeric));
+}
+
+/**
+ * @brief @c DateTime test 8.
+ */
+TEST(DateTime, GIVEN_smallBuffer_WHEN_toCharsCalled_THEN_nullptrReturned) {
+    const dt::DateTime dateTime{dt::Date{9, 7, 2023}, 18, 46, 37, 120'000'000, 60};
+    char buffer[dt::consts::DATE_TIME_MAX_STRING_LENGTH];
+
+    char* end{dateTime.toChars(buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("2023-07-09T18:46:37.120+01:00", std::string(buffer, end));
+    ASSERT_EQ(nullptr, dateTime.toChars(buffer, end - 1));
+    ASSERT_EQ(buffer + 25, dateTime.toChars(buffer, buffer + 25, dt::FractionPrecision::Seconds));
+}
+
+/**
+ * @brief @c DateTime test 9.
+ */
+TEST(DateTime, GIVEN_yearOutsideRfc3339Range_WHEN_toCharsCalled_THEN_nothingWritten) {
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    dt::Date early{1, 1, 2000};
+    early.addYears(-2'001);
+
+    char buffer[dt::consts::DATE_TIME_MAX_STRING_LENGTH];
+    for (const dt::Date& date : {late, early}) {
+        const dt::DateTime dateTime{date, 18, 46, 37, 0, 60};
+        ASSERT_EQ(nullptr, dateTime.toChars(buffer, buffer + sizeof(buffer)));
+        ASSERT_EQ("", dateTime.toString());
+        ASSERT_EQ("", dateTime.toInlineString().view());
+    }
+
+    dt::Date last{30, 12, 9999};
+    last.addDays(1);
+    ASSERT_EQ("9999-12-31T00:00:00Z", (dt::DateTime{last, 0, 0, 0, 0, 0}.toString()));
+}
+
+/**
+ * @brief @c DateTime test 10.
+ */
+TEST(DateTime, GIVEN_noDate_WHEN_toCharsCalled_THEN_nothingWritten) {
+    char buffer[dt::consts::DATE_TIME_MAX_STRING_LENGTH];
+    for (const dt::DateTime& dateTime : {dt::DateTime{}, dt::DateTime{dt::Date{}, 18, 46, 37, 0}}) {
+        ASSERT_EQ(nullptr, dateTime.toChars(buffer, buffer + sizeof(buffer)));
+        ASSERT_EQ("", dateTime.toString());
+        ASSERT_EQ("", dateTime.toInlineString().view());
+
+        std::stringstream ss;
+        ss << dateTime;
+        ASSERT_EQ("", ss.str());
+    }
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "../include/dt/utils/DateTimeUtils.hpp"
+#include "../include/dt/utils/DateBatchParser.hpp"
 
 /**
  * @brief @c DateTimeUtils test 1.
@@ -148,3 +149,107 @@ TEST(DateTimeUtils, GIVEN_dateTimeUtils_WHEN_parseDateStrings_THEN_datesCorrectl
         ASSERT_EQ(expectedDates.at(i), result.at(i));
     }
 }
+
+/**
+ * @brief @c DateTimeUtils test 12.
+ */
+TEST(DateTimeUtils, GIVEN_dateTimeUtils_WHEN_tryParseDateStrings_THEN_statusReturnedForEveryRow) {
+    std::vector<std::string> dateStrings {
+            "22-12-2001",
+            "22.12.2001",
+            "2001/12/22",
+            "31-02-2001",
+    };
+
+    std::vector<dt::ParseResult<dt::Date>> result{dt::DateTimeUtils::tryParseDateStrings(dateStrings)};
+    ASSERT_EQ(dateStrings.size(), result.size());
+    ASSERT_EQ(dt::Date(22, 12, 2001), result.at(0).getValue());
+    ASSERT_EQ(dt::ParseError::ExpectedSeparator, result.at(1).getError());
+    ASSERT_EQ(dt::Date(22, 12, 2001), result.at(2).getValue());
+    ASSERT_EQ(dt::ParseError::InvalidDate, result.at(3).getError());
+}
+
+/**
+ * @brief @c DateTimeUtils test 13.
+ */
+TEST(DateTimeUtils, GIVEN_dateTimeUtils_WHEN_parseDateStringsCalledWithThreads_THEN_resultAlignedWithInput) {
+    std::vector<std::string> dateStrings;
+    for (int i{0}; i < 100'000; ++i) {
+        dateStrings.push_back(i % 7 == 0 ? "22.12.2001" : dt::Date{1 + i % 28, 1 + i % 12, 1990 + i % 30}.toString());
+    }
+
+    for (unsigned int threads : {0U, 1U, 3U, 8U}) {
+        std::vector<std::uint64_t> validMask;
+        std::vector<dt::Date> result{dt::DateTimeUtils::parseDateStrings(dateStrings, validMask, threads)};
+        ASSERT_EQ(dateStrings.size(), result.size());
+        ASSERT_EQ(dt::DateBatchParser::validMaskSize(dateStrings.size()), validMask.size());
+        for (int i{0}; i < static_cast<int>(dateStrings.size()); ++i) {
+            bool valid{i % 7 != 0};
+            ASSERT_EQ(valid, dt::DateBatchParser::isValid(validMask.data(), i)) << i;
+            ASSERT_EQ(valid ? dt::Date(1 + i % 28, 1 + i % 12, 1990 + i % 30) : dt::Date{}, result.at(i)) << i;
+        }
+    }
+
+    std::vector<std::uint64_t> validMask{1, 2, 3};
+    ASSERT_TRUE(dt::DateTimeUtils::parseDateStrings({}, validMask, 4).empty());
+    ASSERT_TRUE(validMask.empty());
+}
+
+/**
+ * @brief @c DateTimeUtils test 14.
+ */
+TEST(DateTimeUtils, GIVEN_dateColumns_WHEN_inferDateFormatCalled_THEN_correctFormatReturned) {
+    using Column = std::vector<std::string>;
+
+    ASSERT_EQ(dt::DateFormat::DD__MM__YYYY, dt::DateTimeUtils::inferDateFormat(Column{"12/01/2023", "25/01/2023"}));
+    ASSERT_EQ(dt::DateFormat::MM_DD_YYYY, dt::DateTimeUtils::inferDateFormat(Column{"01-12-2023", "01-25-2023"}));
+    ASSERT_EQ(dt::DateFormat::YYYY_MM_DD, dt::DateTimeUtils::inferDateFormat(Column{"2023-01-12", "", "2023-01-25"}));
+    ASSERT_EQ(dt::DateFormat::YYYY__DD__MM, dt::DateTimeUtils::inferDateFormat(Column{"2023/25/01", "2023/12/01"}));
+    ASSERT_EQ(dt::DateFormat::DD_MM_YYYY, dt::DateTimeUtils::inferDateFormat(Column{"01-02-2023", "03-04-2023"}));
+    ASSERT_EQ(dt::DateFormat::DD_MM_YYYY,
+              dt::DateTimeUtils::inferDateFormat(Column{"25-01-2023", "01-25-2023", "26-01-2023"}));
+    ASSERT_EQ(dt::DateFormat::DD_MM_YYYY, dt::DateTimeUtils::inferDateFormat(Column{"01-02-2023", "01-25-2023"}, 1));
+    ASSERT_FALSE(dt::DateTimeUtils::inferDateFormat(Column{"22.12.2001", "", "31-02-2001"}).has_value());
+    ASSERT_FALSE(dt::DateTimeUtils::inferDateFormat(Column{}).has_value());
+}
+
+/**
+ * @brief @c DateTimeUtils test 15.
+ */
+TEST(DateTimeUtils, GIVEN_dateColumn_WHEN_parseDateStringsCalledWithFormat_THEN_contradictingRowsReported) {
+    std::vector<std::string> dateStrings {
+            "12/01/2023",
+            "25/01/2023",
+            "01/25/2023",
+            "2023/01/25",
+            "22-12-2001",
+            "05/06/2023",
+    };
+    std::vector<std::size_t> contradictingRows{99};
+
+    std::vector<dt::Date> result{dt::DateTimeUtils::parseDateStrings(dateStrings, dt::DateFormat::DD__MM__YYYY,
+                                                                    contradictingRows)};
+    ASSERT_EQ(dateStrings.size(), result.size());
+    ASSERT_EQ((std::vector<std::size_t>{2, 3, 4}), contradictingRows);
+    ASSERT_EQ(dt::Date(12, 1, 2023), result.at(0));
+    ASSERT_EQ(dt::Date(25, 1, 2023), result.at(1));
+    ASSERT_EQ(dt::Date{}, result.at(2));
+    ASSERT_EQ(dt::Date(5, 6, 2023), result.at(5));
+
+    result = dt::DateTimeUtils::parseDateStrings(dateStrings, dt::DateFormat::MM__DD__YYYY, contradictingRows);
+    ASSERT_EQ((std::vector<std::size_t>{1, 3, 4}), contradictingRows);
+    ASSERT_EQ(dt::Date(1, 12, 2023), result.at(0));
+    ASSERT_EQ(dt::Date(6, 5, 2023), result.at(5));
+}
+
+/**
+ * @brief @c DateTimeUtils test 16.
+ */
+TEST(DateTimeUtils, GIVEN_defaultDate_WHEN_daysBetweenCalled_THEN_countedFromDayBeforeReferenceDate) {
+    const dt::Date date{1, 1, 2000};
+
+    ASSERT_EQ(152'307, dt::DateTimeUtils::daysBetween(dt::Date{}, date));
+    ASSERT_EQ(152'307, dt::DateTimeUtils::daysBetween(date, dt::Date{}));
+    ASSERT_EQ(1, dt::DateTimeUtils::daysBetween(dt::Date{}, dt::Date{1, 1, 1583}));
+    ASSERT_EQ(0, dt::DateTimeUtils::daysBetween(dt::Date{}, dt::Date{}));
+}
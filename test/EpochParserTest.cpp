@@ -0,0 +1,127 @@
+/**
+ * @file EpochParserTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/EpochParser.hpp"
+
+/**
+ * @brief @c EpochParser test 1.
+ */
+TEST(EpochParser, GIVEN_epochValues_WHEN_unitDetected_THEN_unitFromMagnitude) {
+    ASSERT_EQ(dt::EpochUnit::Seconds, dt::EpochParser::detectUnit(1697545200));
+    ASSERT_EQ(dt::EpochUnit::Seconds, dt::EpochParser::detectUnit(-1697545200));
+    ASSERT_EQ(dt::EpochUnit::Milliseconds, dt::EpochParser::detectUnit(1697545200123));
+    ASSERT_EQ(dt::EpochUnit::Microseconds, dt::EpochParser::detectUnit(1697545200123456));
+    ASSERT_EQ(dt::EpochUnit::Nanoseconds, dt::EpochParser::detectUnit(1697545200123456789));
+    ASSERT_EQ(dt::EpochUnit::Nanoseconds, dt::EpochParser::detectUnit(INT64_MIN));
+
+    const std::int64_t column[] {86'400'000, 1697545200123, 0};
+    ASSERT_EQ(dt::EpochUnit::Seconds, dt::EpochParser::detectUnit(column[0]));
+    ASSERT_EQ(dt::EpochUnit::Milliseconds, dt::EpochParser::detectUnit(column, 3));
+    ASSERT_EQ(dt::EpochUnit::Seconds, dt::EpochParser::detectUnit(column, 0));
+}
+
+/**
+ * @brief @c EpochParser test 2.
+ */
+TEST(EpochParser, GIVEN_epochInEachUnit_WHEN_converted_THEN_sameUtcDateTime) {
+    ASSERT_EQ(dt::DateTime{"2023-10-17T12:20:00Z"}, *dt::EpochParser::fromValue(1697545200));
+    ASSERT_EQ(dt::DateTime{"2023-10-17T12:20:00.123Z"}, *dt::EpochParser::fromValue(1697545200123));
+    ASSERT_EQ(dt::DateTime{"2023-10-17T12:20:00.123456Z"}, *dt::EpochParser::fromValue(1697545200123456));
+    ASSERT_EQ(dt::DateTime{"2023-10-17T12:20:00.123456789Z"}, *dt::EpochParser::fromValue(1697545200123456789));
+    ASSERT_EQ(dt::DateTime{"1970-01-02T00:00:00Z"},
+              *dt::EpochParser::fromValue(86'400'000, dt::EpochUnit::Milliseconds));
+    ASSERT_EQ(dt::DateTime{"1969-12-31T23:59:59.999Z"},
+              *dt::EpochParser::fromValue(-1, dt::EpochUnit::Milliseconds));
+    ASSERT_EQ(dt::DateTime{"1600-02-29T00:00:00Z"}, *dt::EpochParser::fromValue(-11670998400));
+
+    dt::ParseResult<dt::DateTime> result{dt::EpochParser::fromValue(1697545200123456789, dt::EpochUnit::Seconds)};
+    ASSERT_EQ(dt::ParseError::InvalidDate, result.getError());
+    ASSERT_EQ(0, result.getErrorOffset());
+
+    dt::DateTime dateTime{*dt::EpochParser::fromValue(1697545200123)};
+    ASSERT_EQ(dt::Date(17, 10, 2023), dateTime.getDate());
+    ASSERT_EQ(dt::TimeStamp(12, 20, 0, 123), dateTime.getTimeStamp());
+}
+
+/**
+ * @brief @c EpochParser test 3.
+ */
+TEST(EpochParser, GIVEN_epochString_WHEN_tryParseCalled_THEN_dateTimeOrErrorReturned) {
+    ASSERT_EQ(dt::DateTime{"2023-10-17T12:20:00.123Z"}, *dt::EpochParser::tryParse("1697545200123"));
+    ASSERT_EQ(dt::DateTime{"1969-12-31T23:59:59Z"}, *dt::EpochParser::tryParse("-1"));
+    ASSERT_EQ(dt::DateTime{"1970-01-01T00:00:01.697545200Z"},
+              *dt::EpochParser::tryParse("1697545200", dt::EpochUnit::Nanoseconds));
+
+    struct Case {
+        std::string_view epoch;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+        {"", dt::ParseError::TooShort, 0},
+        {"-", dt::ParseError::TooShort, 1},
+        {"16975x5200", dt::ParseError::ExpectedDigit, 5},
+        {"1697545200 ", dt::ParseError::ExpectedDigit, 10},
+        {"16975452001234567890", dt::ParseError::TooLong, 19},
+        {"9300000000000000000", dt::ParseError::TooLong, 18},
+        {"-9223372036854775809", dt::ParseError::TooLong, 19},
+        {"-12300000000", dt::ParseError::InvalidDate, 0},
+    };
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{dt::EpochParser::tryParse(c.epoch)};
+        ASSERT_EQ(c.error, result.getError()) << c.epoch;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.epoch;
+    }
+}
+
+/**
+ * @brief @c EpochParser test 4.
+ */
+TEST(EpochParser, GIVEN_mixedUnitColumn_WHEN_parsed_THEN_sameAsOneAtATime) {
+    std::vector<std::int64_t> values;
+    std::vector<std::string> strings;
+    for (std::int64_t i{0}; i < 100; ++i) {
+        const std::int64_t seconds{1'600'000'000 + i * 86'399};
+        const std::int64_t scales[] {1, 1'000, 1'000'000, 1'000'000'000};
+        values.push_back(seconds * scales[i % 4] + (i % 4 == 0 ? 0 : i));
+        strings.push_back(std::to_string(values.back()));
+    }
+    values[50] = -12'300'000'000;
+    strings[50] = "x";
+    std::vector<std::string_view> views(strings.begin(), strings.end());
+
+    std::vector<dt::DateTime> fromValues(values.size());
+    std::vector<dt::DateTime> fromStrings(values.size());
+    std::vector<std::uint64_t> valueMask(2);
+    std::vector<std::uint64_t> stringMask(2);
+    ASSERT_EQ(99, dt::EpochParser::parse(values.data(), values.size(), dt::EpochUnit::Auto, fromValues.data(),
+                                         valueMask.data()));
+    ASSERT_EQ(99, dt::EpochParser::parse(views.data(), views.size(), dt::EpochUnit::Auto, fromStrings.data(),
+                                         stringMask.data()));
+
+    for (std::size_t i{0}; i < values.size(); ++i) {
+        dt::ParseResult<dt::DateTime> expected{dt::EpochParser::fromValue(values[i])};
+        if (i == 50) {
+            ASSERT_FALSE((valueMask[0] >> 50) & 1);
+            ASSERT_FALSE((stringMask[0] >> 50) & 1);
+            ASSERT_EQ(dt::DateTime{}, fromStrings[i]);
+            continue;
+        }
+        ASSERT_TRUE((valueMask[i / 64] >> (i % 64)) & 1) << i;
+        ASSERT_EQ(*expected, fromValues[i]) << i;
+        ASSERT_EQ(*expected, fromStrings[i]) << i;
+    }
+    ASSERT_EQ(dt::Date(13, 9, 2020), fromValues[0].getDate());
+    ASSERT_EQ(dt::DateTime{"2020-09-14T12:26:39.001Z"}, fromValues[1]);
+}
@@ -136,3 +136,113 @@ TEST(FormattedDate, GIVEN_formattedDateObject_WHEN_pasredFromStringWithValidPatt
     ASSERT_EQ(2002, date2.getYear());
 }
 
+
+/**
+ * @brief @c FormattedDate test 9.
+ */
+TEST(FormattedDate, GIVEN_basicFormattedDateObject_WHEN_toStringCalled_THEN_dateCorrectlyFormatted) {
+    ASSERT_EQ("22-12-2001", (dt::BasicFormattedDate<dt::DateFormat::DD_MM_YYYY>{22, 12, 2001}.toString()));
+    ASSERT_EQ("12-22-2001", (dt::BasicFormattedDate<dt::DateFormat::MM_DD_YYYY>{22, 12, 2001}.toString()));
+    ASSERT_EQ("2001-12-22", (dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{22, 12, 2001}.toString()));
+    ASSERT_EQ("2001-22-12", (dt::BasicFormattedDate<dt::DateFormat::YYYY_DD_MM>{22, 12, 2001}.toString()));
+    ASSERT_EQ("09/07/2002", (dt::BasicFormattedDate<dt::DateFormat::DD__MM__YYYY>{9, 7, 2002}.toString()));
+    ASSERT_EQ("07/09/2002", (dt::BasicFormattedDate<dt::DateFormat::MM__DD__YYYY>{9, 7, 2002}.toString()));
+    ASSERT_EQ("2002/07/09", (dt::BasicFormattedDate<dt::DateFormat::YYYY__MM__DD>{9, 7, 2002}.toString()));
+    ASSERT_EQ("2002/09/07", (dt::BasicFormattedDate<dt::DateFormat::YYYY__DD__MM>{9, 7, 2002}.toString()));
+
+    std::ostringstream ss;
+    ss << dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{1, 1, 1583};
+    ASSERT_EQ("1583-01-01", ss.str());
+}
+
+/**
+ * @brief @c FormattedDate test 10.
+ */
+TEST(FormattedDate, GIVEN_basicFormattedDateObject_WHEN_parsedFromString_THEN_onlyItsLayoutAccepted) {
+    using IsoDate = dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>;
+    using UsDate = dt::BasicFormattedDate<dt::DateFormat::MM__DD__YYYY>;
+
+    ASSERT_EQ(IsoDate(22, 12, 2001), IsoDate{"2001-12-22"});
+    ASSERT_EQ(UsDate(22, 12, 2001), UsDate{"12/22/2001"});
+    ASSERT_THROW(IsoDate{"2001-22-12"}, dt::InvalidDateException);
+    ASSERT_THROW(IsoDate{"2001/12/22"}, dt::DateParseException);
+    ASSERT_THROW(UsDate{"22/12/2001"}, dt::InvalidDateException);
+
+    dt::ParseResult<UsDate> result{UsDate::tryParse("12-22-2001")};
+    ASSERT_EQ(dt::ParseError::ExpectedSeparator, result.getError());
+    ASSERT_EQ(2, result.getErrorOffset());
+
+    result = UsDate::tryParse("02/30/2001");
+    ASSERT_EQ(dt::ParseError::InvalidDate, result.getError());
+    ASSERT_EQ(3, result.getErrorOffset());
+}
+
+/**
+ * @brief @c FormattedDate test 11.
+ */
+TEST(FormattedDate, GIVEN_formattedDateObject_WHEN_formatCalled_THEN_sameAsBasicFormattedDate) {
+    dt::Date date{9, 7, 2002};
+    for (auto format : {dt::DateFormat::DD_MM_YYYY, dt::DateFormat::MM_DD_YYYY, dt::DateFormat::YYYY_MM_DD,
+                        dt::DateFormat::YYYY_DD_MM, dt::DateFormat::DD__MM__YYYY, dt::DateFormat::MM__DD__YYYY,
+                        dt::DateFormat::YYYY__MM__DD, dt::DateFormat::YYYY__DD__MM}) {
+        dt::FormattedDate formattedDate{date, format};
+        char buffer[dt::consts::DATE_STRING_LENGTH];
+        char* end{formattedDate.format(buffer)};
+
+        ASSERT_EQ(format, formattedDate.getFormat());
+        ASSERT_EQ(dt::consts::DATE_STRING_LENGTH, end - buffer);
+        ASSERT_EQ(formattedDate.toString(), std::string(buffer, end));
+    }
+}
+
+/**
+ * @brief @c FormattedDate test 12.
+ */
+TEST(FormattedDate, GIVEN_formattedDateObject_WHEN_toCharsCalled_THEN_sameAsToStringWithoutAllocating) {
+    char buffer[dt::consts::DATE_STRING_LENGTH];
+    const dt::FormattedDate date{22, 12, 2001, dt::DateFormat::YYYY__MM__DD};
+    char* end{date.toChars(buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("2001/12/22", std::string(buffer, end));
+    ASSERT_EQ(nullptr, date.toChars(buffer, buffer + 4));
+    ASSERT_EQ(date.toString(), date.toInlineString().str());
+
+    const dt::BasicFormattedDate<dt::DateFormat::MM_DD_YYYY> basic{22, 12, 2001};
+    end = basic.toChars(buffer, buffer + sizeof(buffer));
+    ASSERT_EQ("12-22-2001", std::string(buffer, end));
+    ASSERT_EQ(nullptr, basic.toChars(buffer, buffer + 9));
+    ASSERT_EQ("12-22-2001", basic.toInlineString().view());
+
+    std::ostringstream os;
+    os << date << ' ' << date.toInlineString();
+    ASSERT_EQ("2001/12/22 2001/12/22", os.str());
+}
+
+/**
+ * @brief @c FormattedDate test 13.
+ */
+TEST(FormattedDate, GIVEN_yearOutsideFourDigits_WHEN_formatted_THEN_writtenLikeDate) {
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    ASSERT_EQ("01-01-10000", (dt::BasicFormattedDate<dt::DateFormat::DD_MM_YYYY>{late}.toString()));
+    ASSERT_EQ("10000/01/01", (dt::BasicFormattedDate<dt::DateFormat::YYYY__MM__DD>{late}.toString()));
+    ASSERT_EQ("10000-01-01", (dt::FormattedDate{late, dt::DateFormat::YYYY_MM_DD}.toInlineString().view()));
+
+    dt::Date early{1, 1, 2000};
+    early.addYears(-2'100);
+    ASSERT_EQ("-100-01-01", (dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{early}.toString()));
+    ASSERT_EQ("01/01/-100", (dt::FormattedDate{early, dt::DateFormat::MM__DD__YYYY}.toString()));
+
+    char buffer[dt::consts::DATE_STRING_LENGTH + 1];
+    const dt::BasicFormattedDate<dt::DateFormat::YYYY_DD_MM> basic{late};
+    char* end{basic.toChars(buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("10000-01-01", std::string(buffer, end));
+    ASSERT_EQ(nullptr, basic.toChars(buffer, buffer + dt::consts::DATE_STRING_LENGTH));
+    const dt::FormattedDate formatted{late, dt::DateFormat::DD__MM__YYYY};
+    end = formatted.toChars(buffer, buffer + sizeof(buffer));
+    ASSERT_EQ("01/01/10000", std::string(buffer, end));
+    ASSERT_EQ(nullptr, formatted.toChars(buffer, buffer + dt::consts::DATE_STRING_LENGTH));
+
+    ASSERT_EQ(dt::Date{}.toString(), (dt::BasicFormattedDate<dt::DateFormat::DD_MM_YYYY>{}.toString()));
+    ASSERT_EQ("0-00-00", (dt::BasicFormattedDate<dt::DateFormat::YYYY_MM_DD>{}.toString()));
+    ASSERT_EQ("00-00-0", dt::FormattedDate{}.toString());
+}
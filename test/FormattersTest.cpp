@@ -0,0 +1,97 @@
+/**
+ * @file FormattersTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/Formatters.hpp"
+
+namespace {
+    dt::detail::DateFormatSpec parseSpec(std::string_view spec, bool allowFormat = true) {
+        dt::detail::DateFormatSpec parsed;
+        const char* end{parsed.parse(spec.data(), spec.data() + spec.size(), allowFormat)};
+        EXPECT_EQ(spec.find('}') == std::string_view::npos ? spec.size() : spec.find('}'),
+                  static_cast<std::size_t>(end - spec.data()));
+        return parsed;
+    }
+}
+
+/**
+ * @brief @c DateFormatSpec test 1.
+ */
+TEST(DateFormatSpec, GIVEN_specs_WHEN_parsed_THEN_dateFormatOrInvalid) {
+    ASSERT_TRUE(parseSpec("}").valid);
+    ASSERT_FALSE(parseSpec("}").hasFormat);
+
+    const dt::detail::DateFormatSpec iso{parseSpec("YYYY-MM-DD}")};
+    ASSERT_TRUE(iso.valid);
+    ASSERT_TRUE(iso.hasFormat);
+    ASSERT_EQ(dt::DateFormat::YYYY_MM_DD, iso.format);
+    ASSERT_EQ(dt::DateFormat::YYYY__DD__MM, parseSpec("YYYY/DD/MM}").format);
+    ASSERT_EQ(dt::DateFormat::DD_MM_YYYY, parseSpec("DD-MM-YYYY").format);
+
+    ASSERT_FALSE(parseSpec("YYYY-MM-DX}").valid);
+    ASSERT_FALSE(parseSpec("YYYY-MM}").valid);
+    ASSERT_FALSE(parseSpec(">20}").valid);
+    ASSERT_FALSE(parseSpec("YYYY-MM-DD}", false).valid);
+}
+
+#ifdef DT_HAS_FMT
+/**
+ * @brief @c fmt::formatter test 1.
+ */
+TEST(FmtFormatter, GIVEN_dateTypes_WHEN_formatted_THEN_sameAsStream) {
+    const dt::Date date{22, 12, 2001};
+    const dt::TimeStamp timeStamp{18, 46, 37, 123};
+    const dt::FormattedDate formattedDate{date, dt::DateFormat::MM__DD__YYYY};
+    const dt::Calendar calendar{date};
+
+    std::ostringstream stream;
+    stream << date << ' ' << timeStamp << ' ' << formattedDate;
+    ASSERT_EQ(stream.str(), fmt::format("{} {} {}", date, timeStamp, formattedDate));
+    ASSERT_EQ(calendar.toString(), fmt::format("{}", calendar));
+    ASSERT_EQ("00-00-0", fmt::format("{}", dt::Date{}));
+
+    ASSERT_EQ("2001-12-22", fmt::format("{:YYYY-MM-DD}", date));
+    ASSERT_EQ("22/12/2001", fmt::format("{:DD/MM/YYYY}", date));
+    ASSERT_EQ("2001/22/12", fmt::format("{:YYYY/DD/MM}", formattedDate));
+
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "[{:MM-DD-YYYY}]", date);
+    ASSERT_EQ("[12-22-2001]", fmt::to_string(buffer));
+}
+
+/**
+ * @brief @c fmt::formatter test 2.
+ */
+TEST(FmtFormatter, GIVEN_unsupportedSpec_WHEN_formatted_THEN_formatErrorThrown) {
+    const dt::Date date{22, 12, 2001};
+    ASSERT_THROW(static_cast<void>(fmt::format(fmt::runtime("{:YYYY.MM.DD}"), date)), fmt::format_error);
+    ASSERT_THROW(static_cast<void>(fmt::format(fmt::runtime("{:YYYY-MM-DD}"), dt::TimeStamp{})), fmt::format_error);
+}
+#endif
+
+#ifdef DT_HAS_STD_FORMAT
+/**
+ * @brief @c std::formatter test 1.
+ */
+TEST(StdFormatter, GIVEN_dateTypes_WHEN_formatted_THEN_sameAsStream) {
+    const dt::Date date{22, 12, 2001};
+    const dt::TimeStamp timeStamp{18, 46, 37, 123};
+    const dt::FormattedDate formattedDate{date, dt::DateFormat::MM__DD__YYYY};
+
+    std::ostringstream stream;
+    stream << date << ' ' << timeStamp << ' ' << formattedDate;
+    ASSERT_EQ(stream.str(), std::format("{} {} {}", date, timeStamp, formattedDate));
+    ASSERT_EQ("2001-12-22", std::format("{:YYYY-MM-DD}", date));
+    ASSERT_EQ(dt::Calendar{date}.toString(), std::format("{}", dt::Calendar{date}));
+    ASSERT_THROW(static_cast<void>(std::vformat("{:YYYY.MM.DD}", std::make_format_args(date))), std::format_error);
+}
+#endif
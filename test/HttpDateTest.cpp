@@ -0,0 +1,158 @@
+/**
+ * @file HttpDateTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/time/HttpDate.hpp"
+
+/**
+ * @brief @c HttpDate test 1.
+ */
+TEST(HttpDate, GIVEN_dateTime_WHEN_formatted_THEN_imfFixdate) {
+    ASSERT_EQ("Sun, 09 Jul 2023 18:46:37 GMT", dt::HttpDate::toString(dt::DateTime{"2023-07-09T18:46:37.123Z"}));
+    ASSERT_EQ("Sat, 22 Dec 2001 00:00:00 GMT", dt::HttpDate::toString(dt::DateTime{"2001-12-22T00:00:00"}));
+    ASSERT_EQ("Thu, 29 Feb 2024 23:59:59 GMT", dt::HttpDate::toString(dt::DateTime{"2024-02-29T23:59:59Z"}));
+
+    char buffer[dt::consts::HTTP_DATE_STRING_LENGTH];
+    char* end{dt::HttpDate::format(dt::DateTime{"1994-11-06T08:49:37Z"}, buffer)};
+    ASSERT_EQ(buffer + dt::consts::HTTP_DATE_STRING_LENGTH, end);
+    ASSERT_EQ("Sun, 06 Nov 1994 08:49:37 GMT", std::string(buffer, end));
+}
+
+/**
+ * @brief @c HttpDate test 2.
+ */
+TEST(HttpDate, GIVEN_dateTimeWithUtcOffset_WHEN_formatted_THEN_convertedToGmt) {
+    ASSERT_EQ("Sun, 09 Jul 2023 17:46:37 GMT", dt::HttpDate::toString(dt::DateTime{"2023-07-09T18:46:37+01:00"}));
+    ASSERT_EQ("Mon, 10 Jul 2023 00:16:37 GMT", dt::HttpDate::toString(dt::DateTime{"2023-07-09T18:46:37-05:30"}));
+    ASSERT_EQ("Sat, 31 Dec 2022 23:30:00 GMT", dt::HttpDate::toString(dt::DateTime{"2023-01-01T01:00:00+01:30"}));
+}
+
+/**
+ * @brief @c HttpDate test 3.
+ */
+TEST(HttpDate, GIVEN_timePoint_WHEN_formatted_THEN_sameAsDateTimeAndCached) {
+    using namespace std::chrono;
+    system_clock::time_point time{seconds{1'688'928'397} + milliseconds{999}};
+    char first[dt::consts::HTTP_DATE_STRING_LENGTH];
+    char second[dt::consts::HTTP_DATE_STRING_LENGTH];
+    dt::HttpDate::format(time, first);
+    dt::HttpDate::format(time - milliseconds{500}, second);
+
+    ASSERT_EQ("Sun, 09 Jul 2023 18:46:37 GMT", std::string(first, dt::consts::HTTP_DATE_STRING_LENGTH));
+    ASSERT_EQ(std::string(first, dt::consts::HTTP_DATE_STRING_LENGTH),
+              std::string(second, dt::consts::HTTP_DATE_STRING_LENGTH));
+
+    dt::HttpDate::format(system_clock::time_point{seconds{-1}}, first);
+    ASSERT_EQ("Wed, 31 Dec 1969 23:59:59 GMT", std::string(first, dt::consts::HTTP_DATE_STRING_LENGTH));
+}
+
+/**
+ * @brief @c HttpDate test 4.
+ */
+TEST(HttpDate, GIVEN_manyThreads_WHEN_formattingDifferentSeconds_THEN_neverTorn) {
+    using namespace std::chrono;
+    const system_clock::time_point base{seconds{1'688'928'397}};
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (int t{0}; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            char buffer[dt::consts::HTTP_DATE_STRING_LENGTH];
+            for (int i{0}; i < 20'000; ++i) {
+                int second{(i + t) % 3};
+                dt::HttpDate::format(base + seconds{second}, buffer);
+                std::string expected{"Sun, 09 Jul 2023 18:46:3" + std::to_string(7 + second) + " GMT"};
+                failures[t] += std::string(buffer, dt::consts::HTTP_DATE_STRING_LENGTH) != expected;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int failure : failures) {
+        ASSERT_EQ(0, failure);
+    }
+}
+
+/**
+ * @brief @c HttpDate test 5.
+ */
+TEST(HttpDate, GIVEN_httpDateInEachFormat_WHEN_parsed_THEN_sameDateTimeInGmt) {
+    const dt::DateTime expected{"1994-11-06T08:49:37Z"};
+    for (const auto& httpDate : {"Sun, 06 Nov 1994 08:49:37 GMT", "Sunday, 06-Nov-94 08:49:37 GMT",
+                                 "Sun Nov  6 08:49:37 1994", "sun, 06 NOV 1994 08:49:37 GMT"}) {
+        dt::ParseResult<dt::DateTime> result{dt::HttpDate::tryParse(httpDate)};
+        ASSERT_TRUE(result) << httpDate;
+        ASSERT_EQ(expected, *result) << httpDate;
+        ASSERT_TRUE(result->hasUtcOffset());
+    }
+
+    ASSERT_EQ(dt::DateTime{"2023-07-09T18:46:37Z"}, *dt::HttpDate::tryParse("Sun Jul 09 18:46:37 2023"));
+
+    char buffer[dt::consts::HTTP_DATE_STRING_LENGTH];
+    dt::DateTime dateTime{"2024-02-29T23:59:59Z"};
+    char* end{dt::HttpDate::format(dateTime, buffer)};
+    ASSERT_EQ(dateTime, *dt::HttpDate::tryParse({buffer, static_cast<std::size_t>(end - buffer)}));
+}
+
+/**
+ * @brief @c HttpDate test 6.
+ */
+TEST(HttpDate, GIVEN_malformedHttpDate_WHEN_parsed_THEN_errorAndOffset) {
+    struct Case {
+        const char* httpDate;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+        {"", dt::ParseError::InvalidDate, 0},
+        {"Sun", dt::ParseError::TooShort, 3},
+        {"Sun, 06 Nov 1994 08:49:37", dt::ParseError::TooShort, 25},
+        {"Sun, 06 Nov 1994 08:49:37 GMT ", dt::ParseError::TooLong, 29},
+        {"Sun, 06 Nov 1994 08:49:37 UTC", dt::ParseError::ExpectedSeparator, 26},
+        {"Sun, 6 Nov 1994 08:49:37 GMT", dt::ParseError::ExpectedDigit, 6},
+        {"Sun, 06 N0v 1994 08:49:37 GMT", dt::ParseError::InvalidMonthName, 8},
+        {"Sun, 06 Nob 1994 08:49:37 GMT", dt::ParseError::InvalidMonthName, 8},
+        {"Sux, 06 Nov 1994 08:49:37 GMT", dt::ParseError::InvalidDate, 0},
+        {"Sun, 31 Nov 1994 08:49:37 GMT", dt::ParseError::InvalidDate, 5},
+        {"Sun, 06 Nov 1994 24:49:37 GMT", dt::ParseError::InvalidTime, 17},
+        {"Sun, 06 Nov 1994 08:49:60 GMT", dt::ParseError::InvalidTime, 23},
+        {"Sunday, 06 Nov 1994 08:49:37 GMT", dt::ParseError::ExpectedSeparator, 10},
+        {"Sun Nov  6 08:49:37 94", dt::ParseError::TooShort, 22},
+    };
+
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{dt::HttpDate::tryParse(c.httpDate)};
+        ASSERT_FALSE(result) << c.httpDate;
+        ASSERT_EQ(c.error, result.getError()) << c.httpDate;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.httpDate;
+    }
+}
+
+/**
+ * @brief @c HttpDate test 7.
+ */
+TEST(HttpDate, GIVEN_dateTimeWithoutDateOrFourDigitYear_WHEN_formatCalled_THEN_nothingWritten) {
+    char buffer[dt::consts::HTTP_DATE_STRING_LENGTH];
+    ASSERT_EQ(nullptr, dt::HttpDate::format(dt::DateTime{}, buffer));
+    ASSERT_EQ("", dt::HttpDate::toString(dt::DateTime{}));
+
+    dt::Date late{31, 12, 9999};
+    late.addDays(1);
+    ASSERT_EQ(nullptr, dt::HttpDate::format(dt::DateTime{late, 0, 0, 0, 0}, buffer));
+
+    // The conversion to GMT moves the year past 9999.
+    ASSERT_EQ(nullptr, dt::HttpDate::format(dt::DateTime{dt::Date{31, 12, 9999}, 23, 0, 0, 0, -60}, buffer));
+    ASSERT_EQ("Fri, 31 Dec 9999 23:59:59 GMT",
+              dt::HttpDate::toString(dt::DateTime{dt::Date{31, 12, 9999}, 23, 59, 59, 0}));
+}
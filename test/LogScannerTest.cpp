@@ -0,0 +1,121 @@
+/**
+ * @file LogScannerTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/LogScanner.hpp"
+
+namespace {
+    const dt::BatchBackend backends[] {dt::BatchBackend::Scalar, dt::BatchBackend::SSSE3, dt::BatchBackend::AVX2};
+
+    std::vector<dt::StreamToken> tokenize(std::string_view buffer) {
+        std::vector<dt::StreamToken> tokens;
+        dt::StreamTokenizer tokenizer;
+        auto onToken = [&tokens](const dt::StreamToken& token) {
+            tokens.push_back(token);
+        };
+        tokenizer.feed(buffer, onToken);
+        tokenizer.finish(onToken);
+        return tokens;
+    }
+
+    void expectSameTokens(const std::vector<dt::StreamToken>& expected, const std::vector<dt::StreamToken>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (std::size_t i{0}; i < expected.size(); ++i) {
+            ASSERT_EQ(expected[i].type, actual[i].type) << i;
+            ASSERT_EQ(expected[i].offset, actual[i].offset) << i;
+            ASSERT_EQ(expected[i].length, actual[i].length) << i;
+            ASSERT_EQ(expected[i].date.getError(), actual[i].date.getError()) << i;
+            ASSERT_EQ(expected[i].timeStamp.getError(), actual[i].timeStamp.getError()) << i;
+            if (expected[i].type == dt::StreamTokenType::Date && expected[i].date) {
+                ASSERT_EQ(*expected[i].date, *actual[i].date) << i;
+            }
+            if (expected[i].type == dt::StreamTokenType::TimeStamp && expected[i].timeStamp) {
+                ASSERT_EQ(*expected[i].timeStamp, *actual[i].timeStamp) << i;
+            }
+        }
+    }
+}
+
+/**
+ * @brief @c LogScanner test 1.
+ */
+TEST(LogScanner, GIVEN_logLines_WHEN_scanned_THEN_datesAndTimeStampsWithOffsets) {
+    const std::string log {
+        "2001-12-22 18:46:37:123 login id=12345678901 from 10.0.0.1\n"
+        "host 22/12/2001 18:46:38:000 retry 31-02-2001 ref 2001-12-22-01 v1.2001-12-22\n"
+        "09-07-2023"
+    };
+
+    for (auto backend : backends) {
+        std::vector<dt::StreamToken> tokens{dt::LogScanner::scan(log, backend)};
+        ASSERT_EQ(7, tokens.size());
+        ASSERT_EQ(0, tokens.at(0).offset);
+        ASSERT_EQ(dt::Date(22, 12, 2001), *tokens.at(0).date);
+        ASSERT_EQ(dt::StreamTokenType::TimeStamp, tokens.at(1).type);
+        ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), *tokens.at(1).timeStamp);
+        ASSERT_EQ(log.find("22/12/2001"), tokens.at(2).offset);
+        ASSERT_EQ(log.find("31-02-2001"), tokens.at(4).offset);
+        ASSERT_EQ(dt::ParseError::InvalidDate, tokens.at(4).date.getError());
+        ASSERT_EQ(log.find("v1.") + 3, tokens.at(5).offset);
+        ASSERT_EQ(log.size() - 10, tokens.at(6).offset);
+        ASSERT_EQ(dt::Date(9, 7, 2023), *tokens.at(6).date);
+    }
+}
+
+/**
+ * @brief @c LogScanner test 2.
+ */
+TEST(LogScanner, GIVEN_randomText_WHEN_scannedWithEachBackend_THEN_sameTokensAsStreamTokenizer) {
+    const std::string pieces[] {
+        "2001-12-22", "22/12/2001", "18:46:37:123", "99:00:00:000", "12345", ".", " ", "\n", "-", ":", "/",
+        "ab", "2001-13-01", "0", "T", "7"
+    };
+    std::mt19937 random{2001};
+    std::uniform_int_distribution<std::size_t> pick{0, std::size(pieces) - 1};
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 127, 128, 1'000, 10'000}) {
+        std::string text;
+        while (text.size() < size) {
+            text += pieces[pick(random)];
+        }
+        text.resize(size);
+
+        std::vector<dt::StreamToken> expected{tokenize(text)};
+        for (auto backend : backends) {
+            expectSameTokens(expected, dt::LogScanner::scan(text, backend));
+        }
+    }
+}
+
+/**
+ * @brief @c LogScanner test 3.
+ */
+TEST(LogScanner, GIVEN_tokenAcrossBlockBoundary_WHEN_scanned_THEN_foundOnce) {
+    for (std::size_t start{50}; start <= 64; ++start) {
+        std::string text(start, 'x');
+        text += "2001-12-22";
+        text.resize(128 - (start % 2), ' ');
+
+        for (auto backend : backends) {
+            std::vector<dt::StreamToken> tokens;
+            ASSERT_EQ(1, dt::LogScanner::scan(text, tokens, backend));
+            ASSERT_EQ(start, tokens.at(0).offset);
+            ASSERT_EQ(dt::Date(22, 12, 2001), *tokens.at(0).date);
+        }
+    }
+
+    std::string endsOnBlock(54, ' ');
+    endsOnBlock += "2001-12-22";
+    for (auto backend : backends) {
+        ASSERT_EQ(1, dt::LogScanner::scan(endsOnBlock, backend).size());
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file ParseCacheTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/ParseCache.hpp"
+
+/**
+ * @brief @c ParseCache test 1.
+ */
+TEST(ParseCache, GIVEN_dateParseCache_WHEN_sameStringsParsed_THEN_resultsMatchTryParseAndHitsCounted) {
+    dt::DateParseCache cache{100};
+    ASSERT_EQ(128, cache.getCapacity());
+
+    const std::vector<std::string> dates{"22-12-2001", "2001/12/22", "22.12.2001", "31-02-2001", "2001-12-2"};
+    for (int round{0}; round < 3; ++round) {
+        for (const auto& d : dates) {
+            dt::ParseResult<dt::Date> expected{dt::Date::tryParse(d)};
+            dt::ParseResult<dt::Date> result{cache.tryParse(d)};
+            ASSERT_EQ(expected.getValue(), result.getValue()) << d;
+            ASSERT_EQ(expected.getError(), result.getError()) << d;
+            ASSERT_EQ(expected.getErrorOffset(), result.getErrorOffset()) << d;
+        }
+    }
+    // The 9 character string can't be cached.
+    ASSERT_EQ(8, cache.getHits());
+    ASSERT_EQ(7, cache.getMisses());
+
+    cache.clear();
+    ASSERT_EQ(0, cache.getHits());
+    ASSERT_EQ(0, cache.getMisses());
+    ASSERT_EQ(dt::Date(22, 12, 2001), *cache.tryParse("22-12-2001"));
+    ASSERT_EQ(1, cache.getMisses());
+}
+
+/**
+ * @brief @c ParseCache test 2.
+ */
+TEST(ParseCache, GIVEN_dateParseCacheOfOneSlot_WHEN_stringsAlternate_THEN_slotEvicted) {
+    dt::DateParseCache cache{1};
+
+    ASSERT_EQ(dt::Date(22, 12, 2001), *cache.tryParse("22-12-2001"));
+    ASSERT_EQ(dt::Date(23, 12, 2001), *cache.tryParse("23-12-2001"));
+    ASSERT_EQ(dt::Date(22, 12, 2001), *cache.tryParse("22-12-2001"));
+    ASSERT_EQ(dt::Date(22, 12, 2001), *cache.tryParse("22-12-2001"));
+    ASSERT_EQ(1, cache.getHits());
+    ASSERT_EQ(3, cache.getMisses());
+}
+
+/**
+ * @brief @c ParseCache test 3.
+ */
+TEST(ParseCache, GIVEN_timeStampParseCache_WHEN_samePrefixParsed_THEN_millisecondsDecodedAndHitsCounted) {
+    dt::TimeStampParseCache cache;
+
+    const std::vector<std::string> timeStamps {
+        "18:46:37:123", "18:46:37:999", "18:46:37:000", "24:46:37:123", "24:46:37:456",
+        "18:46:3x:123", "18:46:37.123", "18:46:37:12"
+    };
+    for (const auto& t : timeStamps) {
+        dt::ParseResult<dt::TimeStamp> expected{dt::TimeStamp::tryParse(t)};
+        dt::ParseResult<dt::TimeStamp> result{cache.tryParse(t)};
+        ASSERT_EQ(expected.getValue(), result.getValue()) << t;
+        ASSERT_EQ(expected.getError(), result.getError()) << t;
+        ASSERT_EQ(expected.getErrorOffset(), result.getErrorOffset()) << t;
+    }
+    ASSERT_EQ(3, cache.getHits());
+    ASSERT_EQ(5, cache.getMisses());
+}
+
+/**
+ * @brief @c ParseCache test 4.
+ */
+TEST(ParseCache, GIVEN_threadLocalCaches_WHEN_usedFromTwoThreads_THEN_eachThreadHasItsOwnCache) {
+    dt::DateParseCache* mainCache{&dt::DateParseCache::threadLocal()};
+    dt::DateParseCache* otherCache{nullptr};
+    std::thread thread{[&] {
+        otherCache = &dt::DateParseCache::threadLocal();
+        otherCache->tryParse("22-12-2001");
+    }};
+    thread.join();
+
+    ASSERT_NE(mainCache, otherCache);
+    ASSERT_EQ(mainCache, &dt::DateParseCache::threadLocal());
+    ASSERT_EQ(&dt::TimeStampParseCache::threadLocal(), &dt::TimeStampParseCache::threadLocal());
+}
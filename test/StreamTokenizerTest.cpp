@@ -0,0 +1,108 @@
+/**
+ * @file StreamTokenizerTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/StreamTokenizer.hpp"
+
+namespace {
+    const std::string log {
+        "2001-12-22 18:46:37:123 login id=12345678901 from 10.0.0.1\n"
+        "22/12/2001 18:46:38:000 retry 31-02-2001 99:00:00:000 ref 2001-12-22-01\n"
+        "09-07-2023"
+    };
+
+    std::vector<dt::StreamToken> tokenize(const std::vector<std::string_view>& chunks) {
+        std::vector<dt::StreamToken> tokens;
+        dt::StreamTokenizer tokenizer;
+        auto onToken = [&tokens](const dt::StreamToken& token) {
+            tokens.push_back(token);
+        };
+        for (const auto& chunk : chunks) {
+            tokenizer.feed(chunk, onToken);
+        }
+        tokenizer.finish(onToken);
+        return tokens;
+    }
+}
+
+/**
+ * @brief @c StreamTokenizer test 1.
+ */
+TEST(StreamTokenizer, GIVEN_wholeBuffer_WHEN_fed_THEN_datesAndTimeStampsReportedWithOffsets) {
+    std::vector<dt::StreamToken> tokens{tokenize({log})};
+
+    ASSERT_EQ(7, tokens.size());
+    ASSERT_EQ(dt::StreamTokenType::Date, tokens.at(0).type);
+    ASSERT_EQ(0, tokens.at(0).offset);
+    ASSERT_EQ(dt::Date(22, 12, 2001), *tokens.at(0).date);
+    ASSERT_EQ(dt::StreamTokenType::TimeStamp, tokens.at(1).type);
+    ASSERT_EQ(11, tokens.at(1).offset);
+    ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), *tokens.at(1).timeStamp);
+    ASSERT_EQ(log.find("22/12/2001"), tokens.at(2).offset);
+    ASSERT_EQ(dt::Date(22, 12, 2001), *tokens.at(2).date);
+    ASSERT_EQ(dt::TimeStamp(18, 46, 38, 0), *tokens.at(3).timeStamp);
+    ASSERT_EQ(log.find("31-02-2001"), tokens.at(4).offset);
+    ASSERT_EQ(dt::ParseError::InvalidDate, tokens.at(4).date.getError());
+    ASSERT_EQ(log.find("99:00"), tokens.at(5).offset);
+    ASSERT_EQ(dt::ParseError::InvalidTime, tokens.at(5).timeStamp.getError());
+    ASSERT_EQ(log.size() - 10, tokens.at(6).offset);
+    ASSERT_EQ(dt::Date(9, 7, 2023), *tokens.at(6).date);
+}
+
+/**
+ * @brief @c StreamTokenizer test 2.
+ */
+TEST(StreamTokenizer, GIVEN_bufferSplitAnywhere_WHEN_fed_THEN_sameTokensReported) {
+    std::vector<dt::StreamToken> expected{tokenize({log})};
+    std::string_view view{log};
+
+    for (std::size_t chunkSize{1}; chunkSize <= 16; ++chunkSize) {
+        std::vector<std::string_view> chunks;
+        for (std::size_t i{0}; i < view.size(); i += chunkSize) {
+            chunks.push_back(view.substr(i, chunkSize));
+            chunks.push_back({});
+        }
+
+        std::vector<dt::StreamToken> tokens{tokenize(chunks)};
+        ASSERT_EQ(expected.size(), tokens.size()) << chunkSize;
+        for (std::size_t i{0}; i < tokens.size(); ++i) {
+            ASSERT_EQ(expected.at(i).type, tokens.at(i).type) << chunkSize;
+            ASSERT_EQ(expected.at(i).offset, tokens.at(i).offset) << chunkSize;
+            ASSERT_EQ(expected.at(i).date.getValue(), tokens.at(i).date.getValue()) << chunkSize;
+            ASSERT_EQ(expected.at(i).date.getError(), tokens.at(i).date.getError()) << chunkSize;
+            ASSERT_EQ(expected.at(i).timeStamp.getValue(), tokens.at(i).timeStamp.getValue()) << chunkSize;
+        }
+    }
+}
+
+/**
+ * @brief @c StreamTokenizer test 3.
+ */
+TEST(StreamTokenizer, GIVEN_tokenizer_WHEN_finishedOrReset_THEN_newStreamStartsAtOffsetZero) {
+    dt::StreamTokenizer tokenizer;
+    std::vector<dt::StreamToken> tokens;
+    auto onToken = [&tokens](const dt::StreamToken& token) {
+        tokens.push_back(token);
+    };
+
+    tokenizer.feed("x 2001-12", onToken);
+    ASSERT_EQ(9, tokenizer.getOffset());
+    tokenizer.reset();
+    ASSERT_EQ(0, tokenizer.getOffset());
+    tokenizer.feed("-22 ", onToken);
+    ASSERT_TRUE(tokens.empty());
+
+    tokenizer.feed("2001-12-22", onToken);
+    tokenizer.finish(onToken);
+    ASSERT_EQ(1, tokens.size());
+    ASSERT_EQ(4, tokens.at(0).offset);
+    ASSERT_EQ(0, tokenizer.getOffset());
+}
@@ -0,0 +1,116 @@
+/**
+ * @file SyslogParserTest.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2023 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../include/dt/utils/SyslogParser.hpp"
+
+/**
+ * @brief @c SyslogParser test 1.
+ */
+TEST(SyslogParser, GIVEN_referenceDate_WHEN_inferringYears_THEN_rolloverAroundNewYear) {
+    dt::SyslogParser january{dt::Date{5, 1, 2024}};
+    ASSERT_EQ(2024, january.inferYear(1));
+    ASSERT_EQ(2024, january.inferYear(2));
+    ASSERT_EQ(2023, january.inferYear(3));
+    ASSERT_EQ(2023, january.inferYear(12));
+
+    dt::SyslogParser december{dt::Date{31, 12, 2023}};
+    ASSERT_EQ(2024, december.inferYear(1));
+    ASSERT_EQ(2023, december.inferYear(2));
+    ASSERT_EQ(2023, december.inferYear(12));
+
+    dt::SyslogParser july{dt::Date{17, 7, 2023}};
+    ASSERT_EQ(2023, july.inferYear(1));
+    ASSERT_EQ(2023, july.inferYear(8));
+    ASSERT_EQ(2022, july.inferYear(9));
+    ASSERT_EQ(0, july.inferYear(13));
+
+    july.setReference(dt::Date{1, 2, 2024});
+    ASSERT_EQ(dt::Date(1, 2, 2024), july.getReference());
+    ASSERT_EQ(2024, july.inferYear(3));
+    ASSERT_EQ(2023, july.inferYear(4));
+}
+
+/**
+ * @brief @c SyslogParser test 2.
+ */
+TEST(SyslogParser, GIVEN_bsdTimeStamp_WHEN_parsed_THEN_localDateTimeInInferredYear) {
+    dt::SyslogParser parser{dt::Date{5, 1, 2024}};
+
+    ASSERT_EQ(dt::DateTime{"2023-12-31T23:59:59"}, *parser.tryParseRfc3164("Dec 31 23:59:59"));
+    ASSERT_EQ(dt::DateTime{"2024-01-05T08:00:01"}, *parser.tryParseRfc3164("Jan  5 08:00:01"));
+    ASSERT_EQ(dt::DateTime{"2024-01-05T08:00:01"}, *parser.tryParseRfc3164("jan 05 08:00:01"));
+    ASSERT_EQ(dt::DateTime{"2024-02-29T12:00:00"}, *parser.tryParse("Feb 29 12:00:00"));
+    ASSERT_FALSE(parser.tryParse("Oct 17 12:34:56")->hasUtcOffset());
+
+    parser.setReference(dt::Date{1, 1, 2023});
+    dt::ParseResult<dt::DateTime> leapDay{parser.tryParse("Feb 29 12:00:00")};
+    ASSERT_EQ(dt::ParseError::InvalidDate, leapDay.getError());
+    ASSERT_EQ(4, leapDay.getErrorOffset());
+}
+
+/**
+ * @brief @c SyslogParser test 3.
+ */
+TEST(SyslogParser, GIVEN_malformedBsdTimeStamp_WHEN_parsed_THEN_errorAndOffset) {
+    struct Case {
+        const char* timeStamp;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+        {"Oct 17 12:34", dt::ParseError::TooShort, 12},
+        {"Oct 17 12:34:56 host", dt::ParseError::TooLong, 15},
+        {"Oct 7 12:34:56", dt::ParseError::ExpectedDigit, 5},
+        {"Oct 17 12-34-56", dt::ParseError::ExpectedSeparator, 9},
+        {"Ocx 17 12:34:56", dt::ParseError::InvalidMonthName, 0},
+        {"Oct  0 12:34:56", dt::ParseError::InvalidDate, 4},
+        {"Oct 17 24:34:56", dt::ParseError::InvalidTime, 7},
+        {"Oct 17 12:34:60", dt::ParseError::InvalidTime, 13},
+    };
+
+    dt::SyslogParser parser{dt::Date{17, 10, 2023}};
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{parser.tryParse(c.timeStamp)};
+        ASSERT_FALSE(result) << c.timeStamp;
+        ASSERT_EQ(c.error, result.getError()) << c.timeStamp;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.timeStamp;
+    }
+}
+
+/**
+ * @brief @c SyslogParser test 4.
+ */
+TEST(SyslogParser, GIVEN_rfc5424TimeStamp_WHEN_parsed_THEN_onlyRfc3339FormAccepted) {
+    dt::SyslogParser parser{dt::Date{17, 10, 2023}};
+    ASSERT_EQ(dt::DateTime{"2003-10-11T22:14:15.003Z"}, *parser.tryParse("2003-10-11T22:14:15.003Z"));
+    ASSERT_EQ(dt::DateTime{"2003-08-24T05:14:15.000003-07:00"},
+              *dt::SyslogParser::tryParseRfc5424("2003-08-24T05:14:15.000003-07:00"));
+
+    struct Case {
+        const char* timeStamp;
+        dt::ParseError error;
+        std::size_t offset;
+    };
+    const Case cases[] {
+        {"-", dt::ParseError::ExpectedDigit, 0},
+        {"2003-10-11 22:14:15Z", dt::ParseError::ExpectedSeparator, 10},
+        {"2003-10-11T22:14:15", dt::ParseError::TooShort, 19},
+        {"2003-10-11T22:14:15.0000003Z", dt::ParseError::TooLong, 26},
+        {"2003-10-11T22:14:15,003Z", dt::ParseError::ExpectedSeparator, 19},
+        {"2003-10-11T22:14:15z", dt::ParseError::ExpectedSeparator, 19},
+        {"2003-10-11T22:14:15+0700", dt::ParseError::ExpectedSeparator, 22},
+        {"2003-10-11T22:14:15+07", dt::ParseError::TooShort, 22},
+    };
+    for (const auto& c : cases) {
+        dt::ParseResult<dt::DateTime> result{parser.tryParse(c.timeStamp)};
+        ASSERT_FALSE(result) << c.timeStamp;
+        ASSERT_EQ(c.error, result.getError()) << c.timeStamp;
+        ASSERT_EQ(c.offset, result.getErrorOffset()) << c.timeStamp;
+    }
+}
@@ -5,6 +5,9 @@
  * @copyright Copyright (c) 2023 liam under MIT licence.
  */
 
+#include <cstdint>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../include/dt/time/TimeStamp.hpp"
@@ -235,3 +238,102 @@ TEST(TimeStamp, GIVEN_twoDifferentTimeStampObjects_WHEN_compared_THEN_correctVal
     ASSERT_LT(time1, time2);
     ASSERT_GT(time2, time1);
 }
+
+/**
+ * @brief @c TimeStamp test 18.
+ */
+TEST(TimeStamp, GIVEN_timeStamp_WHEN_parsedFromStringView_THEN_correctTimeSet) {
+    std::string_view line{"event at 18:46:37:123 ok"};
+    dt::TimeStamp time{line.substr(9, 12)};
+
+    ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), time);
+    ASSERT_THROW(dt::TimeStamp time2{"18:46:37.123"}, dt::DateParseException);
+    ASSERT_THROW(dt::TimeStamp time3{"18:46:37:12a"}, dt::DateParseException);
+    ASSERT_THROW(dt::TimeStamp time4{"25:00:00:000"}, dt::InvalidTimeException);
+}
+
+/**
+ * @brief @c TimeStamp test 19.
+ */
+TEST(TimeStamp, GIVEN_timeStampString_WHEN_tryParseCalled_THEN_timeStampOrErrorReturned) {
+    dt::ParseResult<dt::TimeStamp> result{dt::TimeStamp::tryParse("18:46:37:123")};
+    ASSERT_TRUE(result);
+    ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), *result);
+
+    result = dt::TimeStamp::tryParse("18:46:37.123");
+    ASSERT_EQ(dt::ParseError::ExpectedSeparator, result.getError());
+    ASSERT_EQ(8, result.getErrorOffset());
+
+    result = dt::TimeStamp::tryParse("18:46:37:1");
+    ASSERT_EQ(dt::ParseError::TooShort, result.getError());
+    ASSERT_EQ(10, result.getErrorOffset());
+
+    result = dt::TimeStamp::tryParse("18:61:37:123");
+    ASSERT_EQ(dt::ParseError::InvalidTime, result.getError());
+    ASSERT_EQ(3, result.getErrorOffset());
+}
+
+/**
+ * @brief @c TimeStamp test 20.
+ */
+TEST(TimeStamp, GIVEN_hmsmInt_WHEN_fromHmsmIntCalled_THEN_timeStampOrErrorReturned) {
+    dt::ParseResult<dt::TimeStamp> result{dt::TimeStamp::fromHmsmInt(184637123)};
+    ASSERT_TRUE(result);
+    ASSERT_EQ(dt::TimeStamp(18, 46, 37, 123), *result);
+    ASSERT_EQ(184637123, result->toHmsmInt());
+    ASSERT_EQ(dt::TimeStamp(0, 0, 0, 7), *dt::TimeStamp::fromHmsmInt(7));
+    ASSERT_EQ(235959999, dt::TimeStamp(23, 59, 59, 999).toHmsmInt());
+
+    const std::pair<std::int32_t, std::size_t> invalid[] {
+            {240000000, 0},
+            {186037123, 2},
+            {184660123, 4},
+            {-1, 0},
+    };
+    for (const auto& [hmsm, offset] : invalid) {
+        result = dt::TimeStamp::fromHmsmInt(hmsm);
+        ASSERT_EQ(dt::ParseError::InvalidTime, result.getError()) << hmsm;
+        ASSERT_EQ(offset, result.getErrorOffset()) << hmsm;
+    }
+}
+
+/**
+ * @brief @c TimeStamp test 21.
+ */
+TEST(TimeStamp, GIVEN_hmsmIntArray_WHEN_fromHmsmIntsCalled_THEN_sameAsFromHmsmIntAndRoundTrips) {
+    std::vector<std::int32_t> hmsm;
+    for (int i{0}; i < 70; ++i) {
+        hmsm.push_back((i % 24) * 10'000'000 + (i * 7 % 60) * 100'000 + (i * 13 % 60) * 1'000 + i * 11);
+    }
+    hmsm[3] = 246000000;
+    hmsm[65] = 120075000;
+
+    std::vector<dt::TimeStamp> timeStamps(hmsm.size());
+    std::vector<std::uint64_t> validMask(2);
+    ASSERT_EQ(68, dt::TimeStamp::fromHmsmInts(hmsm.data(), hmsm.size(), timeStamps.data(), validMask.data()));
+
+    for (std::size_t i{0}; i < hmsm.size(); ++i) {
+        dt::ParseResult<dt::TimeStamp> expected{dt::TimeStamp::fromHmsmInt(hmsm[i])};
+        ASSERT_EQ(static_cast<bool>(expected), ((validMask[i / 64] >> (i % 64)) & 1) != 0) << hmsm[i];
+        ASSERT_EQ(expected.getValueOr(dt::TimeStamp{}), timeStamps[i]) << hmsm[i];
+    }
+
+    std::vector<std::int32_t> roundTrip(timeStamps.size());
+    dt::TimeStamp::toHmsmInts(timeStamps.data(), timeStamps.size(), roundTrip.data());
+    ASSERT_EQ(hmsm[10], roundTrip[10]);
+    ASSERT_EQ(0, roundTrip[3]);
+}
+
+/**
+ * @brief @c TimeStamp test 22.
+ */
+TEST(TimeStamp, GIVEN_timeStampObject_WHEN_toCharsCalled_THEN_sameAsToStringWithoutAllocating) {
+    char buffer[dt::consts::TIME_STAMP_STRING_LENGTH];
+    const dt::TimeStamp timeStamp{8, 5, 3, 7};
+    char* end{timeStamp.toChars(buffer, buffer + sizeof(buffer))};
+    ASSERT_EQ("08:05:03:007", std::string(buffer, end));
+    ASSERT_EQ(nullptr, timeStamp.toChars(buffer, buffer + sizeof(buffer) - 1));
+    ASSERT_EQ("08:05:03:007", timeStamp.toString());
+    ASSERT_EQ("08:05:03:007", timeStamp.toInlineString().view());
+    ASSERT_EQ(dt::TimeStamp(23, 59, 59, 999).toString(), dt::TimeStamp(23, 59, 59, 999).toInlineString().str());
+}